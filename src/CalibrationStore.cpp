@@ -0,0 +1,74 @@
+#include "CalibrationStore.h"
+#include <Preferences.h>
+#include <stddef.h>
+
+namespace {
+
+static const char* const kNamespace = "imu";
+static const char* const kKey = "calib";
+static constexpr uint16_t kLayoutVersion = 1;  // Bump when the record or its units change
+
+struct CalibrationRecord {
+    uint16_t version;
+    uint16_t reserved;
+    int32_t biasX;
+    int32_t biasY;
+    uint32_t checksum;
+};
+
+uint32_t recordChecksum(const CalibrationRecord& r) {
+    // FNV-1a over everything before the checksum field
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&r);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(CalibrationRecord, checksum); i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+}
+
+bool CalibrationStore::load(int32_t& biasX, int32_t& biasY) {
+    Preferences prefs;
+    if (!prefs.begin(kNamespace, true)) return false;
+
+    CalibrationRecord record;
+    const bool read = prefs.getBytes(kKey, &record, sizeof(record)) == sizeof(record);
+    prefs.end();
+
+    if (!read || record.version != kLayoutVersion || record.checksum != recordChecksum(record)) {
+        return false;
+    }
+    biasX = record.biasX;
+    biasY = record.biasY;
+    m_source = Source::Nvs;
+    return true;
+}
+
+void CalibrationStore::save(int32_t biasX, int32_t biasY, Source source) {
+    CalibrationRecord record = {};
+    record.version = kLayoutVersion;
+    record.biasX = biasX;
+    record.biasY = biasY;
+    record.checksum = recordChecksum(record);
+
+    Preferences prefs;
+    if (!prefs.begin(kNamespace, false)) {
+        Serial.println("[CALIB] NVS unavailable, calibration not saved");
+        return;
+    }
+    prefs.putBytes(kKey, &record, sizeof(record));
+    prefs.end();
+
+    m_source = source;
+    m_saves++;
+    Serial.printf("[CALIB] saved bias x=%ld y=%ld\n", (long)biasX, (long)biasY);
+}
+
+String CalibrationStore::toJson() const {
+    static const char* const kSources[] = { "none", "measured", "nvs", "rtc", "drift" };
+    String json = "{\"source\":\"" + String(kSources[static_cast<int>(m_source)]) + "\"";
+    json += ",\"saves\":" + String(m_saves);
+    json += "}";
+    return json;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief Keeps the accelerometer biases (SensorFilter state units) in NVS so
+ * a cold boot can skip the 1 s calibration pause.
+ * The record carries a layout version and a checksum; anything that fails
+ * either is treated as "never calibrated".
+ */
+class CalibrationStore {
+public:
+    enum class Source : uint8_t { None, Measured, Nvs, Rtc, Drift };
+
+    // Loads the stored biases; false when missing or invalid
+    bool load(int32_t& biasX, int32_t& biasY);
+
+    void save(int32_t biasX, int32_t biasY, Source source);
+
+    // Records where the biases in use came from (for stats)
+    void noteSource(Source source) { m_source = source; }
+
+    String toJson() const;
+
+private:
+    Source m_source = Source::None;
+    uint32_t m_saves = 0;
+};
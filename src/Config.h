@@ -22,4 +22,102 @@
 #define CHAR_CONTROL_UUID   "00009ABF-0000-1000-8000-00805F9B34FB"
 #define CHAR_ACK_UUID       "00009AC0-0000-1000-8000-00805F9B34FB"
 
-#define FW_SEMVER           "v1.0.7"
\ No newline at end of file
+#define FW_SEMVER           "v1.0.7"
+
+// Static task stacks (bytes). Re-measure with -D STACK_STRESS: the build cycles
+// every mode and prints reserved vs. peak use; keep ~1 KB above the peak.
+#define GAME_TASK_STACK      8192
+#define COMMS_TASK_STACK     6144
+#define MONITOR_TASK_STACK   4096
+#define IMU_TASK_STACK       3072
+#define GESTURE_TASK_STACK   2048
+#define STACK_STRESS_DWELL_MS 3000  // Time spent in each mode during the stress run
+
+// Game engine frame budget
+#define FRAME_BUDGET_US      2000   // Default per-frame loop() budget
+#define FRAME_HALVE_COOLDOWN 200    // Frames run at half rate after an overrun
+#define MODE_TRANSITION_MS   240    // Wipe/dissolve between outgoing and incoming mode
+
+// Event-driven idle (game task blocks on an event group while the frame is static)
+#define IDLE_STATIC_FRAMES   250    // Unchanged frames before a WhenStatic mode idles
+#define IDLE_TICK_MS         50     // WhenStatic: loop() + tilt check rate while idle
+#define IDLE_EVENT_TICK_MS   250    // UntilEvent: tilt check rate while idle
+#define IDLE_TILT_WAKE       2500   // Filtered accel change (raw LSB, 16384 = 1 g) that ends idle
+
+// Power classes (esp_pm dynamic frequency scaling)
+#define PM_MAX_CPU_MHZ       240
+#define PM_MIN_CPU_MHZ       80     // Keeps APB at 80 MHz, so the refresh timer never retimes
+
+// IMU sampling task (MPU6050 FIFO, DRDY on MPU_INT_PIN)
+#define IMU_SAMPLE_HZ        500    // 1 kHz / (1 + divider); must divide 1000
+#define IMU_BATCH            4      // Samples per FIFO drain while frames are changing
+#define IMU_IDLE_BATCH       32     // Samples per drain while the game task idles
+#define FUSION_TAU_MS        500    // Gyro/accel fusion: how fast tilt follows the accelerometer
+
+// Gesture recognizer (tilt thresholds in calibrated LSB, 16384 = 1 g)
+#define GESTURE_TILT_ENTER   3000   // ~10.5 deg of lean starts a tilt ...
+#define GESTURE_TILT_EXIT    2000   // ... which holds until it falls below ~7 deg
+#define GESTURE_HOLD_MS      2000   // Tilt held this long emits TiltHold
+#define GESTURE_MOTION_LSB   6000   // Linear acceleration (L1) counted as a jolt (shake / tap)
+#define GESTURE_FACE_DOWN_MS 500
+
+// Learned gestures (int8 network on core 0, model in engine/GestureModelData.h)
+#define GESTURE_NET_HOP      4      // Frames (20 ms each) between inferences while moving
+#define GESTURE_NET_MARGIN_Q8 512   // Winning logit must lead the runner-up by 2.0
+#define GESTURE_NET_BUDGET_US 1000  // Inference slower than this is counted as over budget
+
+// Sensor trace recorder (RAM buffer, allocated on first use)
+#define TRACE_BUFFER_BYTES   65536  // ~13 s of 500 Hz samples
+
+// Life Universe mode (HashLife node pool, allocated only while the mode is active)
+#define HASHLIFE_NODES       4096   // 20 B per node plus an 8 KB hash table: ~88 KB
+#define HASHLIFE_STEP_MS     250    // One step (2^n generations) this often
+#define HASHLIFE_MAX_STEP_LOG2 16   // Tap doubles the step up to 2^16 generations, then wraps to 1
+#define HASHLIFE_PAN_CELLS   24     // Pan speed at 1 g of lean (cells per second)
+#define HASHLIFE_BUDGET_US   20000  // Life Universe frame budget (a step can take ms)
+
+// 360 Sand mode
+#define SAND_GRAINS          40     // Grains on the board (never added or lost)
+#define SAND_STEP_MS         8      // One step this often (125 steps/s)
+#define SAND_MAX_CATCH_UP    4      // Steps run at most per frame after a stall
+#define SAND_DEADZONE_LSB    1500   // Less lean than this (|x| + |y|, ~5 deg) holds the pile still
+
+// Water mode
+#define WATER_STEP_US        16667  // Fixed 60 Hz step
+#define WATER_FILL_PERCENT   45     // Share of the panel filled with water
+#define WATER_STIFFNESS_Q8   38     // Wave speed: ~0.4 cells per step at 1 g (keep under 256)
+#define WATER_DAMP_SHIFT     7      // Sloshing loses 1/128 of its flow per step
+#define WATER_SPLASH_Q16     65536  // Shake kicks each flow by up to one cell per step
+
+// 3D Cube mode (wireframe solids)
+#define WIRE_DISTANCE_Q8     768    // Eye to the solid's centre: 3 radii (Q8; 0 = orthographic)
+#define WIRE_FOCAL           12     // Pixels per unit at unit depth: ~4 px radius at 3 radii
+
+// Ball games (Marble, Pong, Breakout, Maze, Lander): shared fixed-step physics
+#define PHYSICS_STEP_US      16667  // 60 steps/s whatever the frame rate
+#define PHYSICS_MAX_CATCH_UP 4      // Steps run at most per frame after a stall
+
+// Accelerometer calibration (stored in NVS; re-run on request). Between
+// calibrations the zero follows slow sensor drift in small, bounded steps.
+#define CALIB_STILL_SAMPLES  (IMU_SAMPLE_HZ * 5) // Still window used for drift checks
+#define CALIB_STILL_SPREAD   160    // Max per-axis range (LSB) inside a still window
+#define CALIB_FLAT_LSB       300    // Windows further than ~1 deg from the zero are real tilt, not drift
+#define CALIB_FLAT_Z_TOL     1500   // ... and Z must read about +1 g (lying flat, face up)
+#define CALIB_DRIFT_LSB      48     // Window error below this (~0.17 deg) is noise
+#define CALIB_DRIFT_AGREE    3      // Windows in a row that must agree before the zero moves
+#define CALIB_DRIFT_GAP_MS   600000 // ... each at least 10 min after the previous one
+#define CALIB_DRIFT_STEP_LSB 4      // Zero moves this much per agreeing window
+#define CALIB_DRIFT_MAX_LSB  160    // Total drift correction (~0.6 deg) until the next recalibration
+
+// Deep sleep with MPU6050 motion wake
+#define MPU_INT_PIN          34     // MPU6050 INT: DRDY while awake, motion ext0 wake in deep sleep
+#define SLEEP_FACE_DOWN_MS   10000  // Face-down this long after the FaceDown gesture -> deep sleep
+#define SLEEP_INACTIVE_MS    300000 // No button / comms / tilt activity this long -> deep sleep
+#define FACE_DOWN_Z          -12000 // Gravity Z below this (about -0.75 g) counts as face-down (FaceDown gesture)
+#define MOTION_WAKE_THRESHOLD 20    // MPU motion threshold, 2 mg/LSB
+#define MOTION_WAKE_DURATION 1      // Time above threshold before INT fires, 1 ms/LSB
+
+// Button timing (edges are timestamped in the GPIO ISR)
+#define BUTTON_DEBOUNCE_MS   15
+#define BUTTON_CLICK_MS      300    // Max gap between clicks of a double click
+#define BUTTON_LONG_MS       800
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "engine/SpscQueue.h"
+
+// Commands posted to the game engine. Producers never touch engine state;
+// the engine drains its mailboxes once per frame and applies them in order.
+enum class EngineCommandType : uint8_t {
+    SetMode,             // value = mode index (wrapped)
+    StepMode,            // value = +/- offset from the active mode
+    SetScrollText,       // data = text; value != 0 also switches to the scroller
+    SetScrollDirection,  // value = ScrollDir, or -1 for AUTO (tilt controlled)
+    ShowText,            // data = text; scroller gets it, otherwise app mode renders it
+    SetCanvas,           // data = 20-byte packed 10x16 bitmap, shown in app mode
+    Recalibrate,         // Re-measure accelerometer offsets (device must lie flat)
+    Trace,               // value = TraceAction
+};
+
+// Sensor trace recorder control (see SensorRecorder)
+enum class TraceAction : int16_t {
+    Stop = 0,
+    Record = 1,   // Restart the active mode and record its sensor input
+    Replay = 2,   // Restart the recorded mode and feed it the stored trace
+};
+
+static constexpr size_t kEngineCommandPayload = 160;
+// Longest text a command carries (one byte goes to the terminating NUL);
+// longer text is refused, never cut short
+static constexpr size_t kEngineTextMax = kEngineCommandPayload - 1;
+static constexpr size_t kCanvasPackedBytes = 20;
+
+struct EngineCommand {
+    EngineCommandType type;
+    int16_t value;
+    uint16_t length;
+    uint8_t data[kEngineCommandPayload];
+};
+
+// One mailbox per producer keeps every queue single-producer/single-consumer
+typedef SpscQueue<EngineCommand, 8> EngineMailbox;
+
+// Fills a slot in place (no copy of the payload buffer, no heap). False if
+// the mailbox is full or the payload is longer than kEngineTextMax.
+inline bool postEngineCommand(EngineMailbox& box, EngineCommandType type, int16_t value,
+                              const uint8_t* data = nullptr, size_t length = 0) {
+    if (length > kEngineTextMax) return false;
+    EngineCommand* cmd = box.claim();
+    if (cmd == nullptr) return false;
+    cmd->type = type;
+    cmd->value = value;
+    cmd->length = static_cast<uint16_t>(length);
+    if (length > 0) memcpy(cmd->data, data, length);
+    cmd->data[length] = 0;  // Text payloads are always NUL-terminated
+    box.commit();
+    return true;
+}
@@ -0,0 +1,89 @@
+#include "FrameBudget.h"
+#include "Config.h"
+
+bool FrameBudget::shouldRun(int modeIndex) {
+    if (modeIndex < 0 || modeIndex >= kMaxModes) return true;
+
+    if (m_skipNext) {
+        m_skipNext = false;
+        m_stats[modeIndex].shed++;
+        return false;
+    }
+
+    if (m_halveFrames > 0) {
+        m_halveFrames--;
+        m_halveToggle = !m_halveToggle;
+        if (m_halveToggle) {
+            m_stats[modeIndex].shed++;
+            return false;
+        }
+    }
+    return true;
+}
+
+void FrameBudget::record(int modeIndex, Mode* mode, uint32_t elapsedUs) {
+    if (modeIndex < 0 || modeIndex >= kMaxModes || mode == nullptr) return;
+
+    Stats& s = m_stats[modeIndex];
+    if (s.name == nullptr) s.name = mode->getName();
+    s.frames++;
+    s.lastUs = elapsedUs;
+    if (elapsedUs > s.maxUs) s.maxUs = elapsedUs;
+    s.avgUs = s.avgUs - (s.avgUs >> 3) + (elapsedUs >> 3);
+
+    uint32_t budget = mode->frameBudgetUs();
+    if (budget == 0) budget = FRAME_BUDGET_US;
+    if (elapsedUs <= budget) return;
+
+    s.overruns++;
+    m_totalOverruns++;
+
+    switch (mode->overloadPolicy()) {
+        case OverloadPolicy::Warn:
+            break;
+        case OverloadPolicy::SkipRender:
+            m_skipNext = true;
+            break;
+        case OverloadPolicy::HalveRate:
+            // Each new overrun re-arms the cooldown
+            m_halveFrames = FRAME_HALVE_COOLDOWN;
+            break;
+    }
+
+    // Rate-limited so a mode that always overruns can't flood the console
+    if (millis() - m_lastWarnMs > 1000) {
+        m_lastWarnMs = millis();
+        Serial.printf("[ENGINE] %s overran %luus > %luus (total %lu)\n",
+                      s.name,
+                      (unsigned long)elapsedUs,
+                      (unsigned long)budget,
+                      (unsigned long)s.overruns);
+    }
+}
+
+void FrameBudget::resetPolicy() {
+    m_skipNext = false;
+    m_halveFrames = 0;
+    m_halveToggle = false;
+}
+
+String FrameBudget::toJson() const {
+    String json = "[";
+    bool first = true;
+    for (int i = 0; i < kMaxModes; i++) {
+        const Stats& s = m_stats[i];
+        if (s.frames == 0) continue;
+        if (!first) json += ",";
+        first = false;
+        json += "{\"mode\":" + String(i);
+        json += ",\"name\":\"" + String(s.name) + "\"";
+        json += ",\"frames\":" + String(s.frames);
+        json += ",\"overruns\":" + String(s.overruns);
+        json += ",\"shed\":" + String(s.shed);
+        json += ",\"avg_us\":" + String(s.avgUs);
+        json += ",\"max_us\":" + String(s.maxUs);
+        json += "}";
+    }
+    json += "]";
+    return json;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+#include "modes/Mode.h"
+
+/**
+ * @brief Measures each mode's loop() cost against a per-frame budget and
+ * applies the mode's OverloadPolicy when it runs long.
+ * Game task only. toJson() may catch a mode's Stats slot between two
+ * fields of one record(); the next push is consistent again.
+ */
+class FrameBudget {
+public:
+    static constexpr int kMaxModes = 32;
+
+    struct Stats {
+        const char* name = nullptr;
+        uint32_t frames = 0;     // loop() calls measured
+        uint32_t overruns = 0;   // calls that exceeded the budget
+        uint32_t shed = 0;       // calls skipped by the overload policy
+        uint32_t lastUs = 0;
+        uint32_t maxUs = 0;
+        uint32_t avgUs = 0;      // EWMA, 1/8 weight
+    };
+
+    // Returns false when the overload policy wants this frame shed
+    bool shouldRun(int modeIndex);
+
+    void record(int modeIndex, Mode* mode, uint32_t elapsedUs);
+
+    // Drops any pending degradation (called on mode switch)
+    void resetPolicy();
+
+    const Stats& stats(int modeIndex) const { return m_stats[modeIndex]; }
+    uint32_t totalOverruns() const { return m_totalOverruns; }
+
+    String toJson() const;
+
+private:
+    Stats m_stats[kMaxModes];
+    uint32_t m_totalOverruns = 0;
+    bool m_skipNext = false;
+    uint16_t m_halveFrames = 0;  // frames left at half rate
+    bool m_halveToggle = false;
+    unsigned long m_lastWarnMs = 0;
+};
@@ -0,0 +1,110 @@
+#include "GestureClassifier.h"
+#include "Config.h"
+#include "StaticTasks.h"
+#include "engine/GestureModelData.h"
+#include <esp_timer.h>
+
+STATIC_TASK_BUFFERS(gestureTask, GESTURE_TASK_STACK);
+
+bool GestureClassifier::begin(UBaseType_t priority, BaseType_t core) {
+    if (!m_model.load(kGestureModel, sizeof(kGestureModel))) {
+        Serial.println("[Gesture] model blob rejected; learned gestures off");
+        return false;
+    }
+    m_window.configure(m_model.header(), IMU_SAMPLE_HZ);
+    m_trigger = gesturenet::Trigger(m_model.marginLsb(GESTURE_NET_MARGIN_Q8), m_model.header().frames);
+    m_task = createStaticTask(taskEntry, "Gesture", gestureTaskStack, GESTURE_TASK_STACK, &gestureTaskTcb,
+                              this, priority, core);
+    return true;
+}
+
+void GestureClassifier::addSample(const int16_t accel[3], const int16_t gravity[3], const int16_t gyro[3]) {
+    if (m_task == nullptr) return;
+    const int16_t linear[3] = {
+        (int16_t)constrain(accel[0] - gravity[0], -32768, 32767),
+        (int16_t)constrain(accel[1] - gravity[1], -32768, 32767),
+        (int16_t)constrain(accel[2] - gravity[2], -32768, 32767)
+    };
+    if (!m_window.add(linear, gyro)) return;
+    if (!m_window.full() || m_window.count() % GESTURE_NET_HOP != 0) return;
+
+    m_windows++;
+    if (!m_window.active()) {
+        m_still++;
+        return;
+    }
+    Job* job = m_jobs.claim();
+    if (job == nullptr) return;  // Task still busy with the last two; counted in dropped
+    job->frame = m_window.count();
+    job->generation = m_generation.load(std::memory_order_relaxed);
+    m_window.copy(job->input);
+    m_jobs.commit();
+    xTaskNotifyGive(m_task);
+}
+
+void GestureClassifier::reset() {
+    m_generation.fetch_add(1, std::memory_order_relaxed);
+    m_window.reset();
+    Gesture stale;
+    while (m_results.pop(stale)) {}
+}
+
+void GestureClassifier::taskEntry(void* arg) {
+    static_cast<GestureClassifier*>(arg)->run();
+}
+
+void GestureClassifier::run() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (const Job* job = m_jobs.front()) {
+            classify(*job);
+            m_jobs.release();
+        }
+    }
+}
+
+void GestureClassifier::classify(const Job& job) {
+    if (job.generation != m_taskGeneration) {
+        m_taskGeneration = job.generation;
+        m_trigger.reset();
+    }
+    const int64_t t0 = esp_timer_get_time();
+    gesturenet::Result result;
+    m_model.classify(job.input, result);
+    m_lastUs = (uint32_t)(esp_timer_get_time() - t0);
+    m_usX8 = m_usX8 - (m_usX8 >> 3) + m_lastUs;
+    if (m_lastUs > m_maxUs) m_maxUs = m_lastUs;
+    if (m_lastUs > GESTURE_NET_BUDGET_US) m_overBudget++;
+    m_inferences++;
+
+    if (!m_trigger.accept(result, job.frame)) return;
+    if (job.generation != m_generation.load(std::memory_order_relaxed)) return;  // Mode switched meanwhile
+
+    Gesture g = { GestureType::Flick, TiltDir::None };
+    switch (result.label) {
+        case gesturenet::NetClass::FlickLeft:  g.dir = TiltDir::Left; break;
+        case gesturenet::NetClass::FlickRight: g.dir = TiltDir::Right; break;
+        case gesturenet::NetClass::DoubleTap:  g.type = GestureType::DoubleTap; break;
+        case gesturenet::NetClass::Circle:     g.type = GestureType::Circle; break;
+        default: return;
+    }
+    m_counts[static_cast<int>(result.label)]++;
+    m_results.push(g);
+}
+
+String GestureClassifier::toJson() const {
+    String json = "{\"loaded\":" + String(m_task != nullptr ? 1 : 0);
+    json += ",\"macs\":" + String(m_model.macs());
+    json += ",\"windows\":" + String(m_windows);
+    json += ",\"still\":" + String(m_still);
+    json += ",\"inferences\":" + String(m_inferences);
+    json += ",\"last_us\":" + String(m_lastUs);
+    json += ",\"avg_us\":" + String(m_usX8 / 8);
+    json += ",\"max_us\":" + String(m_maxUs);
+    json += ",\"over_budget\":" + String(m_overBudget);
+    json += ",\"dropped\":" + String(m_jobs.dropped() + m_results.dropped());
+    json += ",\"flick\":" + String(count(gesturenet::NetClass::FlickLeft) + count(gesturenet::NetClass::FlickRight));
+    json += ",\"double_tap\":" + String(count(gesturenet::NetClass::DoubleTap));
+    json += ",\"circle\":" + String(count(gesturenet::NetClass::Circle)) + "}";
+    return json;
+}
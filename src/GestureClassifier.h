@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "engine/GestureNet.h"
+#include "engine/GestureRecognizer.h"
+#include "engine/SpscQueue.h"
+
+/**
+ * @brief Learned gestures (flick left/right, double tap, circle) from the
+ * int8 network in engine/GestureNet.h, with the model blob in flash.
+ * The game task feeds every fused sample into the window; every
+ * GESTURE_NET_HOP frames that contain motion, the window goes to a task on
+ * core 0 that runs the model (GESTURE_NET_BUDGET_US) and queues accepted
+ * gestures back. Still windows never wake the task.
+ */
+class GestureClassifier {
+public:
+    // Loads the compiled-in model and starts the inference task
+    bool begin(UBaseType_t priority, BaseType_t core);
+
+    // Game task: one sample (raw accel, fused gravity, raw gyro; LSB / Q14)
+    void addSample(const int16_t accel[3], const int16_t gravity[3], const int16_t gyro[3]);
+
+    // Game task: returns true and fills `gesture` while results are pending
+    bool poll(Gesture& gesture) { return m_results.pop(gesture); }
+
+    // Game task, on mode switch: drops pending results and the current window
+    void reset();
+
+    String toJson() const;
+
+private:
+    struct Job {
+        uint32_t frame;       // Newest frame in the window
+        uint32_t generation;
+        int8_t input[gesturenet::kMaxInputs];
+    };
+
+    static void taskEntry(void* arg);
+    void run();
+    void classify(const Job& job);
+    uint32_t count(gesturenet::NetClass c) const { return m_counts[static_cast<int>(c)]; }
+
+    gesturenet::Model m_model;
+    gesturenet::Window m_window;
+    gesturenet::Trigger m_trigger;
+    TaskHandle_t m_task = nullptr;
+    SpscQueue<Job, 2> m_jobs;          // Game task -> inference task
+    SpscQueue<Gesture, 8> m_results;   // Inference task -> game task
+    std::atomic<uint32_t> m_generation{0};
+    uint32_t m_taskGeneration = 0;
+
+    // Stats
+    uint32_t m_windows = 0;            // Game task: windows due
+    uint32_t m_still = 0;              // ... of which skipped as still
+    uint32_t m_inferences = 0;         // Inference task from here on
+    uint32_t m_lastUs = 0, m_maxUs = 0, m_usX8 = 0;
+    uint32_t m_overBudget = 0;
+    uint32_t m_counts[gesturenet::kClasses] = {};
+};
@@ -4,6 +4,9 @@
 #include <Adafruit_GFX.h>
 #include <Wire.h>
 #include <MPU6050.h>
+#include "EngineCommands.h"
+#include "engine/SensorFilter.h"
+#include "engine/OrientationFilter.h"
 
 // Display Settings
 #define MATRIX_WIDTH 10
@@ -13,9 +16,10 @@
 // --- Global Objects (Defined in main.cpp) ---
 extern GFXcanvas1 canvas;  // The drawing surface
 extern MPU6050 mpu;        // The sensor
-extern float accX;         // Filtered X Acceleration
-extern float accY;         // Filtered Y Acceleration
-extern int16_t offsetX, offsetY; //Calibration Offsets
+extern int32_t accX;       // Filtered, calibrated X acceleration (raw LSB, 16384 = 1 g)
+extern int32_t accY;       // Filtered, calibrated Y acceleration (sign flipped for the panel)
+extern SensorFilter sensorFilter;  // Fixed-point pipeline behind accX/accY (game task only)
+extern OrientationFilter orientation;  // Gyro/accel fusion feeding sensorFilter (game task only)
 
 // --- Helper Functions for Modes ---
 inline void setPixel(int r, int c, bool on) {
@@ -29,23 +33,63 @@ inline bool getPixel(int r, int c) {
     return canvas.getPixel(r, c);
 }
 
+// Tilt in mode units: 1 g of lean == unitsPerG (e.g. tiltX(5) = pixels of drift).
+// Built from the fused gravity vector, so shakes and taps do not read as tilt.
+inline int32_t tiltX(int32_t unitsPerG) { return sensorFilter.units(SensorFilter::X, unitsPerG); }
+inline int32_t tiltY(int32_t unitsPerG) { return sensorFilter.units(SensorFilter::Y, unitsPerG); }
+
+// Fused attitude in binary angles (65536 = one turn; 16384 = 90 deg)
+inline int16_t tiltRoll() { return orientation.roll(); }
+inline int16_t tiltPitch() { return orientation.pitch(); }
+
 inline void clearDisplay() {
     canvas.fillScreen(0);
 }
 
+// Packs the canvas into panel row words: rows[x] bit y = pixel (x, y).
+// This is the layout the display ISR shifts out (one word per row pin).
+inline void canvasToPanelRows(uint16_t rows[MATRIX_WIDTH]) {
+    const uint8_t* buf = canvas.getBuffer();
+    const int stride = (MATRIX_WIDTH + 7) / 8;
+    for (int x = 0; x < MATRIX_WIDTH; x++) rows[x] = 0;
+    for (int y = 0; y < MATRIX_HEIGHT; y++) {
+        const uint8_t* line = buf + y * stride;
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            if (line[x >> 3] & (0x80 >> (x & 7))) rows[x] |= (1u << y);
+        }
+    }
+}
+
+// Copies row words into the canvas: rows[y] holds pixel (x, y) in bit
+// 0x8000 >> x, which is the canvas's own byte order, two bytes per row
+inline void rowsToCanvas(const uint16_t rows[MATRIX_HEIGHT]) {
+    uint8_t* buf = canvas.getBuffer();
+    const int stride = (MATRIX_WIDTH + 7) / 8;
+    for (int y = 0; y < MATRIX_HEIGHT; y++) {
+        for (int b = 0; b < stride; b++) buf[y * stride + b] = (uint8_t)(rows[y] >> (8 - 8 * b));
+    }
+}
 
 // Shared Canvas (The "Screen" in memory)
 
 // Mutex to prevent writing to canvas while it's being cleared/drawn
 extern SemaphoreHandle_t dispMutex;
 
-// Flag to trigger a mode switch
-extern volatile bool modeChangeRequest;
-extern volatile int requestedModeIndex;
+// Command mailboxes into the game engine (one per producer task)
+extern EngineMailbox commsMailbox;   // Producer: comms task
+extern EngineMailbox inputMailbox;   // Producer: button dispatch (game task)
+
+// Written by the game engine only; other tasks may read it for status
 extern volatile int activeModeIndex;
 
-extern String appScrollText;
-extern volatile int appScrollDirection;
-extern volatile bool appScrollDirectionOverride;
+// App scroller state. Owned and written by the game task (via SetScrollText /
+// SetScrollDirection commands), so modes can read it without locking.
+struct AppScrollState {
+    char text[kEngineCommandPayload];
+    uint32_t revision;     // Bumped on every text change
+    int direction;         // ScrollDir
+    bool directionOverride;
+};
+extern AppScrollState appScroll;
 
 #define BUZZER_CHANNEL 4
\ No newline at end of file
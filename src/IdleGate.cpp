@@ -0,0 +1,109 @@
+#include "IdleGate.h"
+#include "Config.h"
+
+EventGroupHandle_t IdleGate::begin() {
+    m_events = xEventGroupCreateStatic(&m_eventsBuffer);
+    m_windowStartMs = millis();
+    return m_events;
+}
+
+TickType_t IdleGate::tickTicks(IdlePolicy policy) const {
+    const uint32_t ms = policy == IdlePolicy::UntilEvent ? IDLE_EVENT_TICK_MS : IDLE_TICK_MS;
+    return pdMS_TO_TICKS(ms);
+}
+
+EventBits_t IdleGate::wait(TickType_t timeout) {
+    const EventBits_t bits = xEventGroupWaitBits(m_events, ENGINE_WAKE_ALL, pdTRUE, pdFALSE, timeout);
+    if (bits & ENGINE_WAKE_COMMS) m_wakes.comms++;
+    if (bits & ENGINE_WAKE_BUTTON) m_wakes.button++;
+    if (bits & ENGINE_WAKE_ALL) {
+        resume();
+    } else {
+        m_wakes.timer++;
+    }
+    return bits;
+}
+
+void IdleGate::checkTilt(int32_t x, int32_t y) {
+    if (!m_idle) return;
+    if (!m_tiltRefValid) {
+        m_tiltRefX = x;
+        m_tiltRefY = y;
+        m_tiltRefValid = true;
+        return;
+    }
+    if (abs(x - m_tiltRefX) + abs(y - m_tiltRefY) > IDLE_TILT_WAKE) {
+        m_wakes.tilt++;
+        resume();
+    }
+}
+
+void IdleGate::resume() {
+    if (m_idle) m_idleMsWindow += millis() - m_idleSinceMs;
+    m_idle = false;
+    m_staticFrames = 0;
+}
+
+void IdleGate::enterIdle() {
+    m_idle = true;
+    m_idleSinceMs = millis();
+    m_tiltRefValid = false;
+    // Anything posted before this point is already in a mailbox or edge ring
+    // and is handled before the next wait; only newer bits should wake us.
+    xEventGroupClearBits(m_events, ENGINE_WAKE_ALL);
+}
+
+void IdleGate::framePresented(const uint16_t* rows, int count, IdlePolicy policy, bool animating) {
+    // FNV-1a over the panel words
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < count; i++) {
+        hash = (hash ^ rows[i]) * 16777619u;
+    }
+    const bool unchanged = hash == m_lastHash;
+    m_lastHash = hash;
+
+    if (m_idle) {
+        // A WhenStatic tick frame that changed the picture resumes full rate
+        if (!unchanged) resume();
+        return;
+    }
+    if (policy == IdlePolicy::Never || animating) {
+        m_staticFrames = 0;
+        return;
+    }
+    if (policy == IdlePolicy::UntilEvent) {
+        enterIdle();
+        return;
+    }
+    m_staticFrames = unchanged ? m_staticFrames + 1 : 0;
+    if (m_staticFrames >= IDLE_STATIC_FRAMES) enterIdle();
+}
+
+void IdleGate::countWakeup() {
+    m_wakeupsWindow++;
+
+    const unsigned long now = millis();
+    const unsigned long elapsed = now - m_windowStartMs;
+    if (elapsed < 1000) return;
+
+    if (m_idle) {
+        m_idleMsWindow += now - m_idleSinceMs;
+        m_idleSinceMs = now;
+    }
+    m_wakeupsPerSec = m_wakeupsWindow * 1000UL / elapsed;
+    m_idlePermille = m_idleMsWindow * 1000UL / elapsed;
+    m_wakeupsWindow = 0;
+    m_idleMsWindow = 0;
+    m_windowStartMs = now;
+}
+
+String IdleGate::toJson() const {
+    String json = "{\"idle\":" + String(m_idle ? 1 : 0);
+    json += ",\"wakeups_s\":" + String(m_wakeupsPerSec);
+    json += ",\"idle_permille\":" + String(m_idlePermille);
+    json += ",\"wakes\":{\"comms\":" + String(m_wakes.comms);
+    json += ",\"button\":" + String(m_wakes.button);
+    json += ",\"tilt\":" + String(m_wakes.tilt);
+    json += ",\"timer\":" + String(m_wakes.timer) + "}}";
+    return json;
+}
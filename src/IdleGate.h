@@ -0,0 +1,81 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/event_groups.h>
+#include "modes/Mode.h"
+
+// Bits set on the engine event group by producers outside the game task
+#define ENGINE_WAKE_COMMS   (1 << 0)
+#define ENGINE_WAKE_BUTTON  (1 << 1)
+#define ENGINE_WAKE_ALL     (ENGINE_WAKE_COMMS | ENGINE_WAKE_BUTTON)
+
+// Created by IdleGate::begin() in setup() (defined in main.cpp)
+extern EventGroupHandle_t engineEvents;
+
+/**
+ * @brief Lets the game task sleep while the picture is not changing.
+ * After each presented frame the gate hashes the panel rows; once the mode's
+ * IdlePolicy says the frame is static, the task blocks on an event group
+ * instead of spinning at the 1 kHz tick. Comms posts and button edges set
+ * bits to wake it, a timeout covers tilt checks and slow animations.
+ * Other tasks only set bits on events(); everything else is game-task state.
+ */
+class IdleGate {
+public:
+    struct WakeCounts {
+        uint32_t comms = 0;
+        uint32_t button = 0;
+        uint32_t tilt = 0;
+        uint32_t timer = 0;
+    };
+
+    // Creates the (static) event group; call before any producer starts
+    EventGroupHandle_t begin();
+    EventGroupHandle_t events() const { return m_events; }
+
+    bool idle() const { return m_idle; }
+
+    // Idle timeout for the active mode, in ticks
+    TickType_t tickTicks(IdlePolicy policy) const;
+
+    // Blocks until a wake bit or the timeout. Any bit ends idle.
+    EventBits_t wait(TickType_t timeout);
+
+    // Ends idle when the filtered tilt moved far from where idle started
+    void checkTilt(int32_t x, int32_t y);
+
+    // Leaves idle (mode switch, consumed button event, ...)
+    void resume();
+
+    // Whether loop() should run this iteration
+    bool shouldRunFrame(IdlePolicy policy) const { return !m_idle || policy != IdlePolicy::UntilEvent; }
+
+    // Called after every presented frame
+    void framePresented(const uint16_t* rows, int count, IdlePolicy policy, bool animating);
+
+    // Per-iteration bookkeeping for the rate counters
+    void countWakeup();
+
+    String toJson() const;
+
+private:
+    void enterIdle();
+
+    EventGroupHandle_t m_events = nullptr;
+    StaticEventGroup_t m_eventsBuffer;
+
+    bool m_idle = false;
+    uint32_t m_lastHash = 0;
+    uint16_t m_staticFrames = 0;
+
+    bool m_tiltRefValid = false;
+    int32_t m_tiltRefX = 0, m_tiltRefY = 0;
+
+    WakeCounts m_wakes;
+
+    // One-second windows
+    unsigned long m_windowStartMs = 0;
+    uint32_t m_wakeupsWindow = 0;
+    uint32_t m_wakeupsPerSec = 0;
+    uint32_t m_idleMsWindow = 0, m_idlePermille = 0;
+    unsigned long m_idleSinceMs = 0;
+};
@@ -0,0 +1,77 @@
+#include "PowerManager.h"
+#include "Config.h"
+
+void PowerManager::begin() {
+    m_sinceMs = millis();
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t config;
+    config.max_freq_mhz = PM_MAX_CPU_MHZ;
+    config.min_freq_mhz = PM_MIN_CPU_MHZ;
+    config.light_sleep_enable = true;
+
+    // Automatic light sleep needs tickless idle in the SDK build; fall back to DFS only
+    esp_err_t err = esp_pm_configure(&config);
+    if (err != ESP_OK) {
+        config.light_sleep_enable = false;
+        err = esp_pm_configure(&config);
+    }
+    m_dfs = err == ESP_OK;
+    m_lightSleep = m_dfs && config.light_sleep_enable;
+
+    if (m_dfs) {
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "mode_cpu", &m_cpuLock);
+        esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "mode_awake", &m_sleepLock);
+        esp_pm_lock_acquire(m_cpuLock);
+        esp_pm_lock_acquire(m_sleepLock);
+    }
+#endif
+
+    Serial.printf("[POWER] DFS %s, light sleep %s\n",
+                  m_dfs ? "on" : "unavailable",
+                  m_lightSleep ? "on" : "off");
+}
+
+void PowerManager::account() {
+    const unsigned long now = millis();
+    const uint32_t elapsed = now - m_sinceMs;
+    m_sinceMs = now;
+    if (m_class == PowerClass::Performance || !m_dfs) {
+        m_msAtMax += elapsed;
+    } else {
+        m_msAtMin += elapsed;
+    }
+}
+
+void PowerManager::apply(PowerClass cls) {
+    if (cls == m_class) return;
+    account();
+
+#if CONFIG_PM_ENABLE
+    if (m_dfs) {
+        if (cls == PowerClass::Performance) {
+            esp_pm_lock_acquire(m_cpuLock);
+            esp_pm_lock_acquire(m_sleepLock);
+        } else {
+            esp_pm_lock_release(m_sleepLock);
+            esp_pm_lock_release(m_cpuLock);
+        }
+    }
+#endif
+
+    m_class = cls;
+}
+
+String PowerManager::toJson() const {
+    // Read-only so the monitor task never races apply(); add the open interval here
+    const uint32_t open = millis() - m_sinceMs;
+    const bool atMax = m_class == PowerClass::Performance || !m_dfs;
+    String json = "{\"class\":\"";
+    json += m_class == PowerClass::Performance ? "performance" : "low";
+    json += "\",\"cpu_mhz\":" + String(getCpuFrequencyMhz());
+    json += ",\"dfs\":" + String(m_dfs ? 1 : 0);
+    json += ",\"light_sleep\":" + String(m_lightSleep ? 1 : 0);
+    json += ",\"ms_at_mhz\":{\"" + String(PM_MAX_CPU_MHZ) + "\":" + String(m_msAtMax + (atMax ? open : 0));
+    json += ",\"" + String(PM_MIN_CPU_MHZ) + "\":" + String(m_msAtMin + (atMax ? 0 : open)) + "}}";
+    return json;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <Arduino.h>
+#include "modes/Mode.h"
+
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+/**
+ * @brief Applies a mode's PowerClass through esp_pm locks.
+ * Dynamic frequency scaling is configured once (PM_MIN_CPU_MHZ..PM_MAX_CPU_MHZ);
+ * the Performance class holds a CPU_FREQ_MAX and a NO_LIGHT_SLEEP lock, the Low
+ * class releases both and lets the idle task drop the clock between frames.
+ * apply() runs on the game task at mode switch. toJson() writes nothing:
+ * it adds the interval since the last switch to the totals it reports.
+ */
+class PowerManager {
+public:
+    // Configures DFS (light sleep if the SDK supports it) and starts in Performance
+    void begin();
+
+    // Takes or releases the locks for `cls`; no-op if already applied
+    void apply(PowerClass cls);
+
+    PowerClass active() const { return m_class; }
+    bool dfsEnabled() const { return m_dfs; }
+    bool lightSleepEnabled() const { return m_lightSleep; }
+
+    String toJson() const;
+
+private:
+    void account();
+
+    PowerClass m_class = PowerClass::Performance;
+    bool m_dfs = false;
+    bool m_lightSleep = false;
+
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t m_cpuLock = nullptr;
+    esp_pm_lock_handle_t m_sleepLock = nullptr;
+#endif
+
+    // Time spent with each class applied, i.e. capped at PM_MAX / PM_MIN MHz
+    uint32_t m_msAtMax = 0;
+    uint32_t m_msAtMin = 0;
+    unsigned long m_sinceMs = 0;
+};
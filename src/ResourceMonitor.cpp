@@ -1,4 +1,8 @@
 #include "ResourceMonitor.h"
+#include "StaticTasks.h"
+#include "Config.h"
+
+STATIC_TASK_BUFFERS(monitorTask, MONITOR_TASK_STACK);
 
 ResourceMonitor::ResourceMonitor() {}
 
@@ -16,14 +20,15 @@ void ResourceMonitor::begin() {
     startAP();
     setupWebServer();
     
-    // Start monitoring task on Core 1 (App Core)
-    xTaskCreatePinnedToCore(
+    // Start monitoring task on Core 0 (stack reserved statically)
+    createStaticTask(
         monitorTaskStatic,   // Function
         "Resource Monitor",  // Name
-        4096,                // Stack size
+        monitorTaskStack,    // Stack buffer
+        MONITOR_TASK_STACK,  // Stack size (bytes)
+        &monitorTaskTcb,     // TCB
         this,                // Parameter
         1,                   // Priority
-        nullptr,             // Handle
         0                    // Core ID
     );
     
@@ -39,6 +44,20 @@ void ResourceMonitor::setSamplingInterval(unsigned long interval) {
     samplingInterval = interval;
 }
 
+void ResourceMonitor::addStatsSource(const char* key, StatsSource source) {
+    if (statsSourceCount >= kMaxStatsSources) return;
+    statsKeys[statsSourceCount] = key;
+    statsSources[statsSourceCount] = source;
+    statsSourceCount++;
+}
+
+void ResourceMonitor::addBlobEndpoint(const char* path, const BlobEndpoint& endpoint) {
+    if (blobCount >= kMaxBlobs) return;
+    blobPaths[blobCount] = path;
+    blobs[blobCount] = endpoint;
+    blobCount++;
+}
+
 void ResourceMonitor::startAP() {
     WiFi.mode(WIFI_AP);
     // You can change the SSID and Password here
@@ -71,6 +90,35 @@ void ResourceMonitor::setupWebServer() {
     server->on("/espinfo", HTTP_GET, [this](AsyncWebServerRequest* request) {
         sendESPInfo(request);
     });
+
+    // Binary blobs (download / raw-body upload)
+    for (int i = 0; i < blobCount; i++) {
+        server->on(blobPaths[i], HTTP_GET, [this, i](AsyncWebServerRequest* request) {
+            const uint8_t* data = nullptr;
+            size_t length = 0;
+            if (!blobs[i].read(data, length)) {
+                request->send(409, "text/plain", "unavailable");
+                return;
+            }
+            if (blobs[i].release) request->onDisconnect(blobs[i].release);
+            request->send_P(200, "application/octet-stream", data, length);
+        });
+        server->on(blobPaths[i], HTTP_POST,
+            [this, i](AsyncWebServerRequest* request) {
+                request->send(blobUploadOk[i] ? 200 : 400, "text/plain", blobUploadOk[i] ? "ok" : "rejected");
+            },
+            nullptr,
+            [this, i](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+                if (index == 0) blobUploadOk[i] = blobs[i].begin(total);
+                if (!blobUploadOk[i]) return;
+                if (!blobs[i].write(index, data, len)) {
+                    blobUploadOk[i] = false;
+                    blobs[i].end();  // Releases the blob; the partial upload is dropped
+                    return;
+                }
+                if (index + len == total) blobUploadOk[i] = blobs[i].end();
+            });
+    }
     
     // Main Dashboard HTML
     server->on("/", HTTP_GET, [this](AsyncWebServerRequest* request) {
@@ -96,6 +144,7 @@ void ResourceMonitor::setupWebServer() {
   <div id='heap' class='card'></div>
   <div id='psram' class='card'></div>
   <div id='cpu' class='card'></div>
+  <div id='frame' class='card'></div>
   <div id='uptime' class='card' style='text-align:center;color:#888;font-size:12px;'>Waiting for data...</div>
 
 <script>
@@ -123,6 +172,13 @@ events.onmessage = function(event) {
          <div class='meter'><div class='fill' style='width:${data.cpu_usage}%'></div></div>
          <div class='data-row' style='margin-top:5px;font-size:12px;'><span class='label'>Freq</span><span>${data.cpu_freq} MHz</span></div>`;
 
+    // Update Frame Budget (per-mode loop cost)
+    if (data.frame) {
+        let rows = data.frame.map(m =>
+            `<div class='data-row'><span class='label'>${m.name}</span><span class='value'>${m.avg_us}/${m.max_us}us &middot; ${m.overruns} over</span></div>`);
+        document.getElementById('frame').innerHTML = rows.join('');
+    }
+
     // Update Uptime
     document.getElementById('uptime').innerText = 'Uptime: ' + (data.uptime / 1000).toFixed(1) + 's';
 };
@@ -235,7 +291,12 @@ void ResourceMonitor::sendResourceStats(AsyncEventSourceClient* client) {
     json += "\"psram_size\":" + String(psramSize) + ",";
     json += "\"cpu_usage\":" + String(cpuUsage, 1) + ",";
     json += "\"cpu_freq\":" + String(ESP.getCpuFreqMHz()) + ",";
-    json += "\"uptime\":" + String(millis());
+    json += "\"uptime\":" + String(millis()) + ",";
+    json += "\"tasks\":" + taskStackReportJson() + ",";
+    json += "\"buffers\":" + bufferReportJson();
+    for (int i = 0; i < statsSourceCount; i++) {
+        json += ",\"" + String(statsKeys[i]) + "\":" + statsSources[i]();
+    }
     json += "}";
     
     if (client) {
@@ -12,6 +12,7 @@
 #include <esp_timer.h>
 #include <esp_heap_caps.h>
 #include <esp_partition.h>
+#include <functional>
 
 class ResourceMonitor {
 public:
@@ -22,6 +23,25 @@ public:
     void setPort(uint16_t port);
     void setSamplingInterval(unsigned long interval);
 
+    // Adds a JSON value (object/array/number) to every stats push under `key`.
+    // Sources run on the monitor's task and read their owners' counters
+    // without locking: word-sized fields, so a push is at worst one update stale.
+    typedef std::function<String()> StatsSource;
+    void addStatsSource(const char* key, StatsSource source);
+
+    // Binary blob at `path`: GET downloads it, POST (raw body) replaces it.
+    // read() returns false while the blob is unavailable (answered with 409).
+    // The response streams straight from `data`, so it must stay valid until
+    // release(), called when the request ends (sent or disconnected).
+    struct BlobEndpoint {
+        std::function<bool(const uint8_t*& data, size_t& length)> read;
+        std::function<void()> release;
+        std::function<bool(size_t total)> begin;
+        std::function<bool(size_t index, const uint8_t* data, size_t length)> write;
+        std::function<bool()> end;
+    };
+    void addBlobEndpoint(const char* path, const BlobEndpoint& endpoint);
+
 private:
     uint16_t port = 8080;
     unsigned long samplingInterval = 1000;
@@ -38,6 +58,17 @@ private:
     unsigned long lastCpuTime = 0;
     float cpuUsage = 0.0f;
 
+    static constexpr int kMaxStatsSources = 16;
+    const char* statsKeys[kMaxStatsSources] = {};
+    StatsSource statsSources[kMaxStatsSources];
+    int statsSourceCount = 0;
+
+    static constexpr int kMaxBlobs = 2;
+    const char* blobPaths[kMaxBlobs] = {};
+    BlobEndpoint blobs[kMaxBlobs];
+    bool blobUploadOk[kMaxBlobs] = {};
+    int blobCount = 0;
+
     // Internal methods
     void startAP();
     void setupWebServer();
@@ -0,0 +1,123 @@
+#include "SensorRecorder.h"
+#include "Config.h"
+
+bool SensorRecorder::ensureBuffer() {
+    if (m_buffer == nullptr) m_buffer = static_cast<uint8_t*>(malloc(TRACE_BUFFER_BYTES));
+    return m_buffer != nullptr;
+}
+
+bool SensorRecorder::transition(State from, State to) {
+    uint8_t expected = static_cast<uint8_t>(from);
+    return m_state.compare_exchange_strong(expected, static_cast<uint8_t>(to));
+}
+
+bool SensorRecorder::startRecording(uint8_t modeIndex, uint32_t seed, int32_t biasX, int32_t biasY) {
+    if (!ensureBuffer() || !transition(State::Idle, State::Recording)) return false;
+
+    sensortrace::Header h = {};
+    h.sampleHz = IMU_SAMPLE_HZ;
+    h.seed = seed;
+    h.biasX = biasX;
+    h.biasY = biasY;
+    h.modeIndex = modeIndex;
+    m_writer = sensortrace::Writer(m_buffer, TRACE_BUFFER_BYTES);
+    m_writer.begin(h);
+    m_header = m_writer.header();
+    m_length = m_writer.size();
+    m_truncated = false;
+    return true;
+}
+
+void SensorRecorder::recordSample(const ImuSample& sample) {
+    if (!recording()) return;
+    const int16_t imu[sensortrace::kAxes] = { sample.ax, sample.ay, sample.az, sample.gx, sample.gy, sample.gz };
+    if (!m_writer.addSample(sample.tUs, imu)) stop();
+}
+
+void SensorRecorder::recordEdge(bool pressed, uint32_t tUs) {
+    if (!recording()) return;
+    if (!m_writer.addEdge(tUs, pressed)) stop();
+}
+
+void SensorRecorder::stop() {
+    if (recording()) {
+        m_truncated = m_writer.full();
+        m_length = m_writer.finish();
+        m_header = m_writer.header();
+        Serial.printf("[Trace] recorded %u records, %u bytes%s\n", (unsigned)m_header.records,
+                      (unsigned)m_length, m_truncated ? " (buffer full)" : "");
+        transition(State::Recording, State::Idle);
+    } else if (replaying()) {
+        m_player.stop();
+        transition(State::Replaying, State::Idle);
+    }
+}
+
+bool SensorRecorder::startReplay(uint32_t nowUs) {
+    if (m_buffer == nullptr || m_length == 0 || !transition(State::Idle, State::Replaying)) return false;
+    if (!m_player.start(m_buffer, m_length, nowUs)) {
+        transition(State::Replaying, State::Idle);
+        return false;
+    }
+    m_header = m_player.header();
+    m_replays++;
+    return true;
+}
+
+bool SensorRecorder::poll(uint32_t nowUs, sensortrace::Record& out) {
+    return replaying() && m_player.poll(nowUs, out);
+}
+
+bool SensorRecorder::readTrace(const uint8_t*& data, size_t& length) {
+    if (m_buffer == nullptr || m_length == 0 || !transition(State::Idle, State::Sending)) return false;
+    data = m_buffer;
+    length = m_length;
+    return true;
+}
+
+void SensorRecorder::releaseTrace() {
+    transition(State::Sending, State::Idle);
+}
+
+bool SensorRecorder::beginUpload(size_t total) {
+    if (total < sizeof(sensortrace::Header) || total > TRACE_BUFFER_BYTES) return false;
+    if (!ensureBuffer()) return false;
+    // An abandoned upload (dropped connection) never reached endUpload(); let a new one take over
+    if (!transition(State::Idle, State::Loading) && state() != State::Loading) return false;
+    m_length = 0;
+    return true;
+}
+
+bool SensorRecorder::writeUpload(size_t index, const uint8_t* data, size_t length) {
+    if (state() != State::Loading || index + length > TRACE_BUFFER_BYTES) return false;
+    memcpy(m_buffer + index, data, length);
+    if (index + length > m_length) m_length = index + length;
+    return true;
+}
+
+bool SensorRecorder::endUpload() {
+    if (state() != State::Loading) return false;
+    sensortrace::Reader reader(m_buffer, m_length);
+    if (reader.valid()) {
+        m_header = reader.header();
+        m_length = m_header.bytes;
+    } else {
+        m_length = 0;
+    }
+    transition(State::Loading, State::Idle);
+    return m_length > 0;
+}
+
+String SensorRecorder::toJson() const {
+    static const char* const kStates[5] = { "idle", "recording", "replaying", "loading", "sending" };
+    const sensortrace::Header& h = recording() ? m_writer.header() : m_header;
+    const size_t bytes = recording() ? m_writer.size() : m_length;
+    String json = "{\"state\":\"" + String(kStates[static_cast<int>(state())]) + "\"";
+    json += ",\"bytes\":" + String((uint32_t)bytes);
+    json += ",\"records\":" + String(h.records);
+    json += ",\"duration_ms\":" + String(h.durationUs / 1000);
+    json += ",\"bytes_per_record\":" + String(h.records > 0 ? (float)(bytes - sizeof(h)) / h.records : 0.0f, 1);
+    json += ",\"truncated\":" + String(m_truncated ? 1 : 0);
+    json += ",\"replays\":" + String(m_replays) + "}";
+    return json;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "engine/SensorTrace.h"
+#include "drivers/ImuSampler.h"
+
+/**
+ * @brief Records the game task's sensor input (raw IMU samples and debounced
+ * button edges) into a RAM trace, and plays a trace back in its place.
+ * Replay restarts the recorded mode with the recorded random seed and
+ * calibration, so a mode sees identical input on every run.
+ * The trace buffer (TRACE_BUFFER_BYTES, allocated on first use) can be
+ * downloaded or replaced over HTTP while the recorder is idle.
+ * Recording and replay are driven by the game task only.
+ */
+class SensorRecorder {
+public:
+    // Sending: an HTTP download is streaming m_buffer; nothing may write it
+    enum class State : uint8_t { Idle, Recording, Replaying, Loading, Sending };
+
+    State state() const { return static_cast<State>(m_state.load()); }
+    bool recording() const { return state() == State::Recording; }
+    bool replaying() const { return state() == State::Replaying; }
+
+    // Starts a new trace (drops the previous one). `seed` must already be applied.
+    bool startRecording(uint8_t modeIndex, uint32_t seed, int32_t biasX, int32_t biasY);
+    void recordSample(const ImuSample& sample);
+    void recordEdge(bool pressed, uint32_t tUs);
+
+    // Ends recording or replay
+    void stop();
+
+    // Starts replaying the stored trace; header() describes it
+    bool startReplay(uint32_t nowUs);
+    const sensortrace::Header& header() const { return m_header; }
+
+    // Next record due at `nowUs` (timestamps on the caller's clock).
+    // False when nothing is due; finished() turns true at the end.
+    bool poll(uint32_t nowUs, sensortrace::Record& out);
+    bool finished() const { return replaying() && m_player.done(); }
+
+    // HTTP side (any task). readTrace() pins the buffer (Idle -> Sending)
+    // until releaseTrace(), which the server calls once the response is
+    // done or the client is gone.
+    bool readTrace(const uint8_t*& data, size_t& length);
+    void releaseTrace();
+    bool beginUpload(size_t total);
+    bool writeUpload(size_t index, const uint8_t* data, size_t length);
+    bool endUpload();
+
+    String toJson() const;
+
+private:
+    bool ensureBuffer();
+    bool transition(State from, State to);
+
+    std::atomic<uint8_t> m_state{ static_cast<uint8_t>(State::Idle) };
+    uint8_t* m_buffer = nullptr;
+    size_t m_length = 0;        // Bytes of the stored trace
+    sensortrace::Header m_header = {};
+    sensortrace::Writer m_writer;
+    sensortrace::Player m_player;
+    bool m_truncated = false;   // Last recording hit the buffer limit
+    uint32_t m_replays = 0;
+};
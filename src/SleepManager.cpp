@@ -0,0 +1,161 @@
+#include "SleepManager.h"
+#include "Config.h"
+#include "Globals.h"
+#include "drivers/DisplayDriver.h"
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <stddef.h>
+
+namespace {
+
+// Survives deep sleep; zeroed by the loader on power-on
+struct HibernationRecord {
+    uint32_t magic;
+    uint8_t modeIndex;
+    uint8_t stateLength;
+    uint16_t reserved;
+    int32_t biasX;
+    int32_t biasY;
+    uint32_t sleepCount;
+    uint8_t state[kModeStateBytes];
+    uint32_t checksum;
+};
+
+static constexpr uint32_t kRecordMagic = 0x4D583032;  // "MX02"; bump on layout change
+
+RTC_DATA_ATTR static HibernationRecord gRecord;
+
+uint32_t recordChecksum(const HibernationRecord& r) {
+    // FNV-1a over everything before the checksum field
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&r);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(HibernationRecord, checksum); i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+}
+
+void SleepManager::begin() {
+    const bool motionWake = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0;
+    const bool valid = gRecord.magic == kRecordMagic && gRecord.checksum == recordChecksum(gRecord);
+    m_resumed = motionWake && valid;
+    if (!m_resumed) gRecord.magic = 0;  // Never resume a stale record after a reset
+
+    pinMode(MPU_INT_PIN, INPUT);
+    m_lastActivityMs = millis();
+
+    if (m_resumed) {
+        Serial.printf("[SLEEP] motion wake #%lu, resuming mode %u\n",
+                      (unsigned long)gRecord.sleepCount, gRecord.modeIndex);
+    }
+}
+
+int SleepManager::resumeModeIndex() const { return m_resumed ? gRecord.modeIndex : 0; }
+int32_t SleepManager::resumeBiasX() const { return gRecord.biasX; }
+int32_t SleepManager::resumeBiasY() const { return gRecord.biasY; }
+
+void SleepManager::restoreModeState(Mode* mode) const {
+    if (!m_resumed || mode == nullptr || gRecord.stateLength == 0) return;
+    mode->restoreState(gRecord.state, gRecord.stateLength);
+}
+
+void SleepManager::noteActivity() {
+    m_lastActivityMs = millis();
+}
+
+void SleepManager::noteFaceDown(bool faceDown) {
+    if (faceDown && !m_faceDown) m_faceDownSinceMs = millis();
+    m_faceDown = faceDown;
+}
+
+bool SleepManager::shouldSleep(int32_t accX, int32_t accY, bool holdAwake, bool busy) {
+    const unsigned long now = millis();
+
+    // Tilting the device counts as using it
+    if (abs(accX - m_tiltRefX) + abs(accY - m_tiltRefY) > IDLE_TILT_WAKE) {
+        m_tiltRefX = accX;
+        m_tiltRefY = accY;
+        m_lastActivityMs = now;
+    }
+
+    if (busy) {
+        // Both timeouts start over once comms go quiet
+        m_lastActivityMs = now;
+        m_faceDownSinceMs = now;
+        return false;
+    }
+    if (m_faceDown && now - m_faceDownSinceMs > SLEEP_FACE_DOWN_MS) return true;
+    if (!holdAwake && now - m_lastActivityMs > SLEEP_INACTIVE_MS) return true;
+    return false;
+}
+
+bool SleepManager::hibernate(int modeIndex, Mode* mode, int32_t biasX, int32_t biasY) {
+    // 1. Everything needed to come back without calibrating
+    gRecord.modeIndex = static_cast<uint8_t>(modeIndex);
+    gRecord.biasX = biasX;
+    gRecord.biasY = biasY;
+    gRecord.stateLength = 0;
+    if (mode != nullptr) {
+        const size_t n = mode->saveState(gRecord.state, sizeof(gRecord.state));
+        gRecord.stateLength = static_cast<uint8_t>(n <= sizeof(gRecord.state) ? n : 0);
+    }
+    gRecord.sleepCount++;
+    gRecord.magic = kRecordMagic;
+    gRecord.checksum = recordChecksum(gRecord);
+
+    // 2. Motion interrupt, alone on INT (ImuSampler::suspend() turned DRDY and the
+    //    FIFO off): high-pass against the resting pose, accel-only cycle mode
+    mpu.setInterruptMode(false);       // Active high
+    mpu.setInterruptDrive(false);      // Push-pull
+    mpu.setInterruptLatch(true);       // Hold INT until the status is read
+    mpu.setInterruptLatchClear(false); // Only an INT_STATUS read clears it
+    mpu.setDHPFMode(MPU6050_DHPF_5);
+    mpu.setMotionDetectionThreshold(MOTION_WAKE_THRESHOLD);
+    mpu.setMotionDetectionDuration(MOTION_WAKE_DURATION);
+    mpu.setIntMotionEnabled(true);
+    delay(5);
+    mpu.setDHPFMode(MPU6050_DHPF_HOLD);  // Freeze the reference: any pose change is motion
+    mpu.setStandbyXGyroEnabled(true);
+    mpu.setStandbyYGyroEnabled(true);
+    mpu.setStandbyZGyroEnabled(true);
+    mpu.setTempSensorEnabled(false);
+    mpu.setWakeFrequency(MPU6050_WAKE_FREQ_5);
+    mpu.setWakeCycleEnabled(true);
+    mpu.getIntStatus();
+
+    // Already moving: an ext0 level wake would fire immediately, so stay up
+    if (digitalRead(MPU_INT_PIN) == HIGH) {
+        gRecord.magic = 0;
+        noteActivity();
+        return false;
+    }
+
+    // 3. Blank the panel and go
+    Serial.printf("[SLEEP] hibernating in mode %d (%u state bytes)\n", modeIndex, gRecord.stateLength);
+    Serial.flush();
+    displayShutdown();
+    esp_sleep_enable_ext0_wakeup(static_cast<gpio_num_t>(MPU_INT_PIN), 1);
+    esp_deep_sleep_start();
+    return true;  // Not reached
+}
+
+void SleepManager::framePresented() {
+    if (m_firstFrameMs != 0) return;
+    // esp_timer starts with the app, so the ROM/bootloader stage is not included
+    m_firstFrameMs = (uint32_t)(esp_timer_get_time() / 1000);
+    if (m_firstFrameMs == 0) m_firstFrameMs = 1;
+    Serial.printf("[SLEEP] first frame %lu ms after %s\n",
+                  (unsigned long)m_firstFrameMs, m_resumed ? "motion wake" : "cold boot");
+}
+
+String SleepManager::toJson() const {
+    String json = "{\"resumed\":" + String(m_resumed ? 1 : 0);
+    json += ",\"first_frame_ms\":" + String(m_firstFrameMs);
+    json += ",\"sleeps\":" + String(gRecord.sleepCount);
+    json += ",\"face_down\":" + String(m_faceDown ? 1 : 0);
+    json += ",\"inactive_s\":" + String((millis() - m_lastActivityMs) / 1000);
+    json += "}";
+    return json;
+}
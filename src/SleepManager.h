@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+#include "modes/Mode.h"
+
+/**
+ * @brief Puts the device into deep sleep when it is face-down or unused, and
+ * resumes the same mode on pick-up.
+ * Before sleeping, the active mode index, its saveState() blob and the
+ * accelerometer calibration go into RTC memory. The MPU6050 motion interrupt
+ * is then armed as the ext0 wake source. On an ext0 wake with a valid record,
+ * boot skips calibration and restores that mode.
+ * Game task only, apart from noteActivity(), which comms and button
+ * callbacks call from their own tasks.
+ */
+class SleepManager {
+public:
+    // Reads the wake cause and validates the RTC record; call once at boot
+    void begin();
+
+    bool resumed() const { return m_resumed; }
+    int resumeModeIndex() const;
+    // Accelerometer bias saved at hibernation (SensorFilter state units)
+    int32_t resumeBiasX() const;
+    int32_t resumeBiasY() const;
+
+    // Hands the saved blob to the mode (after its setup()); no-op on cold boot
+    void restoreModeState(Mode* mode) const;
+
+    // Button event, applied command, comms write or large tilt change.
+    // Safe from any task (a single word store).
+    void noteActivity();
+
+    // The gesture recognizer's FaceDown / FaceUp events; face-down sleep
+    // counts SLEEP_FACE_DOWN_MS from the FaceDown
+    void noteFaceDown(bool faceDown);
+
+    // Per-iteration check; true when the device should hibernate now.
+    // holdAwake stops the inactivity timeout; busy (OTA, a connected
+    // client) stops face-down sleep as well.
+    bool shouldSleep(int32_t accX, int32_t accY, bool holdAwake, bool busy = false);
+
+    // Saves state, arms motion wake and enters deep sleep. Returns false (and
+    // stays awake) only if the device was already moving when the INT was armed.
+    // The IMU sampler must be suspended; it reconfigures the sensor on resume.
+    bool hibernate(int modeIndex, Mode* mode, int32_t biasX, int32_t biasY);
+
+    // Records time-to-first-frame on the first call after boot
+    void framePresented();
+
+    String toJson() const;
+
+private:
+    bool m_resumed = false;
+    uint32_t m_firstFrameMs = 0;
+
+    volatile unsigned long m_lastActivityMs = 0;
+    unsigned long m_faceDownSinceMs = 0;
+    bool m_faceDown = false;
+    int32_t m_tiltRefX = 0, m_tiltRefY = 0;
+};
@@ -0,0 +1,87 @@
+#include "StaticTasks.h"
+
+namespace {
+
+struct TaskRecord {
+    const char* name;
+    uint32_t reservedBytes;
+    TaskHandle_t handle;
+};
+
+struct BufferRecord {
+    const char* name;
+    uint32_t reservedBytes;
+    uint32_t (*peakBytes)();
+};
+
+static constexpr int kMaxTasks = 8;
+static TaskRecord gTasks[kMaxTasks];
+static int gTaskCount = 0;
+
+static constexpr int kMaxBuffers = 8;
+static BufferRecord gBuffers[kMaxBuffers];
+static int gBufferCount = 0;
+
+}
+
+TaskHandle_t createStaticTask(TaskFunction_t fn, const char* name,
+                              StackType_t* stack, uint32_t stackBytes, StaticTask_t* tcb,
+                              void* arg, UBaseType_t priority, BaseType_t core) {
+    TaskHandle_t handle = xTaskCreateStaticPinnedToCore(fn, name, stackBytes, arg, priority, stack, tcb, core);
+    if (gTaskCount < kMaxTasks) {
+        gTasks[gTaskCount++] = { name, stackBytes, handle };
+    }
+    return handle;
+}
+
+String taskStackReportJson() {
+    String json = "[";
+    for (int i = 0; i < gTaskCount; i++) {
+        // High-water mark = smallest free stack ever seen, in bytes on ESP-IDF
+        const uint32_t freeMin = uxTaskGetStackHighWaterMark(gTasks[i].handle);
+        if (i > 0) json += ",";
+        json += "{\"name\":\"" + String(gTasks[i].name) + "\"";
+        json += ",\"reserved\":" + String(gTasks[i].reservedBytes);
+        json += ",\"peak\":" + String(gTasks[i].reservedBytes - freeMin) + "}";
+    }
+    json += "]";
+    return json;
+}
+
+void registerStaticBuffer(const char* name, uint32_t reservedBytes, uint32_t (*peakBytes)()) {
+    if (gBufferCount < kMaxBuffers) {
+        gBuffers[gBufferCount++] = { name, reservedBytes, peakBytes };
+    }
+}
+
+String bufferReportJson() {
+    String json = "[";
+    for (int i = 0; i < gBufferCount; i++) {
+        if (i > 0) json += ",";
+        json += "{\"name\":\"" + String(gBuffers[i].name) + "\"";
+        json += ",\"reserved\":" + String(gBuffers[i].reservedBytes);
+        json += ",\"peak\":" + String(gBuffers[i].peakBytes()) + "}";
+    }
+    json += "]";
+    return json;
+}
+
+void printTaskStackReport() {
+    Serial.println("[TASKS] name              reserved    peak   free");
+    for (int i = 0; i < gTaskCount; i++) {
+        const uint32_t freeMin = uxTaskGetStackHighWaterMark(gTasks[i].handle);
+        Serial.printf("[TASKS] %-16s %9lu %7lu %6lu\n",
+                      gTasks[i].name,
+                      (unsigned long)gTasks[i].reservedBytes,
+                      (unsigned long)(gTasks[i].reservedBytes - freeMin),
+                      (unsigned long)freeMin);
+    }
+    for (int i = 0; i < gBufferCount; i++) {
+        const uint32_t peak = gBuffers[i].peakBytes();
+        Serial.printf("[TASKS] %-16s %9lu %7lu %6lu\n",
+                      gBuffers[i].name,
+                      (unsigned long)gBuffers[i].reservedBytes,
+                      (unsigned long)peak,
+                      (unsigned long)(gBuffers[i].reservedBytes - peak));
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief Creates long-lived tasks from reserved static buffers and keeps a
+ * registry so reserved vs. peak stack use can be reported.
+ * Stack sizes are in bytes (ESP-IDF convention).
+ */
+TaskHandle_t createStaticTask(TaskFunction_t fn, const char* name,
+                              StackType_t* stack, uint32_t stackBytes, StaticTask_t* tcb,
+                              void* arg, UBaseType_t priority, BaseType_t core);
+
+// JSON array of {name, reserved, peak} for every registered task
+String taskStackReportJson();
+
+// Static buffers (queues and the like) reported next to the task stacks:
+// reserved bytes, and the peak bytes in use from `peakBytes`
+void registerStaticBuffer(const char* name, uint32_t reservedBytes, uint32_t (*peakBytes)());
+
+// JSON array of {name, reserved, peak} for every registered buffer
+String bufferReportJson();
+
+// One line per task and buffer on Serial; handy after a STACK_STRESS run
+void printTaskStackReport();
+
+// Reserves the stack and TCB for a task at file scope
+#define STATIC_TASK_BUFFERS(id, bytes) \
+    static StackType_t id##Stack[bytes]; \
+    static StaticTask_t id##Tcb
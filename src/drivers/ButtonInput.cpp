@@ -0,0 +1,174 @@
+#include "ButtonInput.h"
+#include "Config.h"
+#include <esp_timer.h>
+
+ButtonInput* ButtonInput::s_instance = nullptr;
+
+void ButtonInput::begin(uint8_t pin, bool activeLow) {
+    m_pin = pin;
+    m_activeLow = activeLow;
+    s_instance = this;
+
+    // GPIO34-39 have no internal pull-ups; the board provides one
+    pinMode(pin, activeLow ? INPUT_PULLUP : INPUT);
+    m_stable = (digitalRead(pin) == (activeLow ? LOW : HIGH));
+    m_lastCommitUs = (uint32_t)esp_timer_get_time();
+    attachInterrupt(digitalPinToInterrupt(pin), onEdgeStatic, CHANGE);
+}
+
+void ButtonInput::setWakeEvent(EventGroupHandle_t group, EventBits_t bits) {
+    m_wakeBits = bits;
+    m_wakeGroup = group;
+}
+
+void ButtonInput::setReplay(bool replay) {
+    if (replay == m_replay) return;
+    if (replay) {
+        detachInterrupt(digitalPinToInterrupt(m_pin));
+        m_replayLevel = m_stable;
+    } else {
+        attachInterrupt(digitalPinToInterrupt(m_pin), onEdgeStatic, CHANGE);
+    }
+    m_replay = replay;
+}
+
+void ButtonInput::injectEdge(bool pressed, uint32_t tUs) {
+    if (!m_replay) return;
+    Edge e;
+    e.tUs = tUs;
+    e.pressed = pressed;
+    m_replayLevel = pressed;
+    m_edges.push(e);
+}
+
+void IRAM_ATTR ButtonInput::onEdgeStatic() {
+    if (s_instance) s_instance->onEdge();
+}
+
+void IRAM_ATTR ButtonInput::onEdge() {
+    Edge e;
+    e.tUs = (uint32_t)esp_timer_get_time();
+    const bool level = m_pin < 32 ? ((GPIO.in >> m_pin) & 1) : ((GPIO.in1.val >> (m_pin - 32)) & 1);
+    e.pressed = (level == (m_activeLow ? 0 : 1));
+    m_edges.push(e);
+
+    if (m_wakeGroup != nullptr) {
+        BaseType_t woken = pdFALSE;
+        xEventGroupSetBitsFromISR(m_wakeGroup, m_wakeBits, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+void ButtonInput::commit(bool pressed, uint32_t tUs) {
+    m_stable = pressed;
+    m_lastCommitUs = tUs;
+    if (m_observer != nullptr) m_observer(pressed, tUs);
+
+    switch (m_state) {
+        case State::Idle:
+            if (pressed) {
+                m_state = State::Down;
+                m_pressUs = tUs;
+                m_pendingPress = true;
+            }
+            break;
+        case State::Down:
+            if (!pressed) {
+                m_state = State::WaitSecond;
+                m_releaseUs = tUs;
+            }
+            break;
+        case State::WaitSecond:
+            if (pressed) {
+                m_state = State::SecondDown;
+                m_secondPressUs = tUs;
+                m_pendingPress = true;
+            }
+            break;
+        case State::SecondDown:
+            // Double click fires on the second release; see poll()
+            if (!pressed) m_releaseUs = tUs;
+            break;
+        case State::LongHeld:
+            if (!pressed) m_state = State::Idle;
+            break;
+    }
+}
+
+bool ButtonInput::emit(ButtonEvent ev, uint32_t pressUs, ButtonEvent& out) {
+    const uint32_t lat = (uint32_t)esp_timer_get_time() - pressUs;
+    Latency& l = m_latency[static_cast<int>(ev)];
+    l.count++;
+    l.lastUs = lat;
+    if (lat > l.maxUs) l.maxUs = lat;
+    l.avgUs = l.count == 1 ? lat : l.avgUs - (l.avgUs >> 3) + (lat >> 3);
+    out = ev;
+    return true;
+}
+
+bool ButtonInput::poll(ButtonEvent& event) {
+    const uint32_t debounceUs = BUTTON_DEBOUNCE_MS * 1000UL;
+
+    // 1. Drain edges. Accept the first edge of a burst, ignore the bounce.
+    Edge e;
+    while (m_edges.pop(e)) {
+        if ((bool)e.pressed == m_stable) continue;
+        if (e.tUs - m_lastCommitUs < debounceUs) continue;
+        commit(e.pressed, e.tUs);
+    }
+
+    uint32_t now = (uint32_t)esp_timer_get_time();
+
+    // 2. Reconcile: bounce may have ended inside the window without a final edge
+    if (now - m_lastCommitUs >= debounceUs) {
+        const bool pressed = m_replay ? m_replayLevel : digitalRead(m_pin) == (m_activeLow ? LOW : HIGH);
+        if (pressed != m_stable) commit(pressed, now);
+    }
+
+    if (m_pendingPress) {
+        m_pendingPress = false;
+        return emit(ButtonEvent::Press, m_state == State::SecondDown ? m_secondPressUs : m_pressUs, event);
+    }
+
+    // 3. Timeouts and releases
+    switch (m_state) {
+        case State::Down:
+            if (now - m_pressUs >= BUTTON_LONG_MS * 1000UL) {
+                m_state = State::LongHeld;
+                return emit(ButtonEvent::LongPress, m_pressUs, event);
+            }
+            break;
+        case State::WaitSecond:
+            if (now - m_releaseUs >= BUTTON_CLICK_MS * 1000UL) {
+                m_state = State::Idle;
+                return emit(ButtonEvent::Click, m_pressUs, event);
+            }
+            break;
+        case State::SecondDown:
+            if (!m_stable) {
+                m_state = State::Idle;
+                return emit(ButtonEvent::DoubleClick, m_pressUs, event);
+            }
+            if (now - m_secondPressUs >= BUTTON_LONG_MS * 1000UL) {
+                m_state = State::LongHeld;
+                return emit(ButtonEvent::DoubleLongPress, m_secondPressUs, event);
+            }
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+
+String ButtonInput::toJson() const {
+    static const char* const kNames[5] = { "press", "click", "double", "long", "double_long" };
+    String json = "{\"dropped\":" + String(droppedEdges());
+    for (int i = 0; i < 5; i++) {
+        const Latency& l = m_latency[i];
+        json += ",\"" + String(kNames[i]) + "\":{\"n\":" + String(l.count)
+              + ",\"avg_us\":" + String(l.avgUs)
+              + ",\"max_us\":" + String(l.maxUs) + "}";
+    }
+    json += "}";
+    return json;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/event_groups.h>
+#include "modes/Mode.h"
+#include "engine/SpscQueue.h"
+
+/**
+ * @brief Interrupt-driven button pipeline.
+ * A GPIO ISR pushes timestamped edges into a lock-free ring; poll() runs on the
+ * game task, debounces off those timestamps and classifies click / double /
+ * long press. Latency is measured from the (first) press edge to the moment
+ * the event is handed to the caller.
+ */
+class ButtonInput {
+public:
+    struct Latency {
+        uint32_t count = 0;
+        uint32_t lastUs = 0;
+        uint32_t maxUs = 0;
+        uint32_t avgUs = 0;  // EWMA, 1/8 weight
+    };
+
+    void begin(uint8_t pin, bool activeLow);
+
+    // Every accepted edge also sets `bits` on `group` (wakes an idle consumer)
+    void setWakeEvent(EventGroupHandle_t group, EventBits_t bits);
+
+    // Called from poll() (game task) for every debounced edge, e.g. to record it
+    typedef void (*EdgeObserver)(bool pressed, uint32_t tUs);
+    void setEdgeObserver(EdgeObserver observer) { m_observer = observer; }
+
+    // Replay: the pin interrupt is detached and edges come from injectEdge()
+    // (game task only, so the edge ring keeps a single producer)
+    void setReplay(bool replay);
+    void injectEdge(bool pressed, uint32_t tUs);
+
+    // Returns true and fills `event` while classified events are pending
+    bool poll(ButtonEvent& event);
+
+    // True while edges are queued or a gesture is still being classified
+    // (the consumer must keep polling to catch click / long-press timeouts)
+    bool busy() const { return !m_edges.empty() || m_state != State::Idle || m_pendingPress; }
+
+    const Latency& latency(ButtonEvent event) const { return m_latency[static_cast<int>(event)]; }
+    uint32_t droppedEdges() const { return m_edges.dropped(); }
+
+    String toJson() const;
+
+private:
+    struct Edge {
+        uint32_t tUs;
+        uint8_t pressed;
+    };
+
+    enum class State : uint8_t { Idle, Down, WaitSecond, SecondDown, LongHeld };
+
+    static void IRAM_ATTR onEdgeStatic();
+    void IRAM_ATTR onEdge();
+
+    void commit(bool pressed, uint32_t tUs);
+    bool emit(ButtonEvent ev, uint32_t pressUs, ButtonEvent& out);
+
+    uint8_t m_pin = 0;
+    bool m_activeLow = true;
+
+    SpscQueue<Edge, 32> m_edges;
+    EventGroupHandle_t m_wakeGroup = nullptr;
+    EventBits_t m_wakeBits = 0;
+    EdgeObserver m_observer = nullptr;
+    bool m_replay = false;
+    bool m_replayLevel = false;
+
+    // Debounce (leading edge: accept first edge, ignore bounce for the window)
+    bool m_stable = false;
+    uint32_t m_lastCommitUs = 0;
+
+    // Classifier
+    State m_state = State::Idle;
+    uint32_t m_pressUs = 0;    // first press of the current gesture
+    uint32_t m_secondPressUs = 0;
+    uint32_t m_releaseUs = 0;
+    bool m_pendingPress = false;
+
+    Latency m_latency[5];
+
+    static ButtonInput* s_instance;
+};
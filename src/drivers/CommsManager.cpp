@@ -1,14 +1,16 @@
 #include "CommsManager.h"
 #include "Globals.h"
 #include "Config.h"
+#include "IdleGate.h"
 #include "MatrixProtocolCodec.h"
 #include "MatrixOtaUpdateHandler_ArduinoESP32.h"
+#include "StaticTasks.h"
+#include "engine/SpscQueue.h"
 #include <WiFi.h>
 #include <ArduinoOTA.h>
 #include <NimBLEDevice.h>
 #include <array>
 #include <cstring>
-#include <deque>
 #include <string>
 #include <vector>
 
@@ -20,6 +22,7 @@ static constexpr uint8_t STATUS_INVALID_STATE = 0x02;
 static constexpr uint8_t STATUS_BAD_OFFSET = 0x03;
 static constexpr uint8_t STATUS_FLASH_WRITE_ERROR = 0x04;
 static constexpr uint8_t STATUS_FINALIZE_ERROR = 0x05;
+static constexpr uint8_t STATUS_TOO_LONG = 0x06;
 
 enum class Source {
     Mode,
@@ -30,11 +33,19 @@ enum class Source {
     Control,
 };
 
+// Covers one MTU-sized write (247 - 3 byte ATT header) plus short long-writes
+static constexpr size_t kMaxWriteBytes = 256;
+
 struct PendingWrite {
     Source source;
-    std::vector<uint8_t> data;
+    uint16_t length;
+    uint16_t oversize;  // Original length of a write too long for a slot (0 = fits); only its head is kept
+    uint8_t data[kMaxWriteBytes];
 };
 
+// Enough of an oversize write to read its frame header (and so its seq)
+static constexpr size_t kOversizeHeadBytes = 8;
+
 struct OtaSession {
     bool active = false;
     bool legacy = false;
@@ -47,60 +58,66 @@ struct OtaSession {
 static NimBLEServer* gServer = nullptr;
 static NimBLECharacteristic* gVersionChar = nullptr;
 static NimBLECharacteristic* gAckChar = nullptr;
-static SemaphoreHandle_t gQueueMutex = nullptr;
-static std::deque<PendingWrite> gQueue;
+// Producer: NimBLE host task (all onWrite callbacks). Consumer: comms task.
+static SpscQueue<PendingWrite, 32> gQueue;
 static OtaSession gOta;
 static MatrixOtaUpdateHandlerArduinoEsp32 gOtaHandler;
 static bool gNeedsReboot = false;
+static volatile bool gArduinoOtaActive = false;
+static void (*gActivityObserver)() = nullptr;
 static std::string gLastText;
-static constexpr int APP_CONTROLLED_MODE_ID = 11;
-static constexpr int SCROLL_MODE_ID = 8;
-static constexpr const char *kFirmwareModesPipe =
-    "Marble|Sparkle|Fluid|Heart|Life|Pong|Snake|Tetris|4-Way Scroller|Matrix|Pomodoro|App Controlled";
+static const char* (*gModeName)(int index) = nullptr;
+static int gModeCount = 0;
 
 static const char* getFwVersion() {
     return FW_SEMVER;
 }
 
+// A write longer than a slot is queued as its header only, so the comms
+// task can NACK it (STATUS_TOO_LONG) in order with the writes around it
 static void queueWrite(Source source, const std::string& value) {
-    if (value.empty() || gQueueMutex == nullptr) return;
-
-    PendingWrite item;
-    item.source = source;
-    item.data.assign(value.begin(), value.end());
+    if (gActivityObserver != nullptr) gActivityObserver();
+    if (value.empty()) return;
+
+    PendingWrite* item = gQueue.claim();
+    if (item == nullptr) return;  // Full; counted in gQueue.dropped()
+    const bool oversize = value.size() > kMaxWriteBytes;
+    const size_t kept = oversize ? kOversizeHeadBytes : value.size();
+    item->source = source;
+    item->length = static_cast<uint16_t>(kept);
+    item->oversize = oversize ? static_cast<uint16_t>(value.size() > 0xFFFF ? 0xFFFF : value.size()) : 0;
+    memcpy(item->data, value.data(), kept);
+    gQueue.commit();
+}
 
-    if (xSemaphoreTake(gQueueMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        if (gQueue.size() < 64) {
-            gQueue.push_back(std::move(item));
-        }
-        xSemaphoreGive(gQueueMutex);
-    }
+// Posts to the game engine and wakes it if it is idling on a static frame
+static bool postToEngine(EngineCommandType type, int16_t value,
+                         const uint8_t* data = nullptr, size_t length = 0) {
+    const bool posted = postEngineCommand(commsMailbox, type, value, data, length);
+    if (engineEvents != nullptr) xEventGroupSetBits(engineEvents, ENGINE_WAKE_COMMS);
+    return posted;
 }
 
 static void requestModeChange(int index) {
-    requestedModeIndex = index;
-    modeChangeRequest = true;
+    postToEngine(EngineCommandType::SetMode, static_cast<int16_t>(index));
 }
 
-static void activateAppControlledMode() {
-    if (activeModeIndex != APP_CONTROLLED_MODE_ID) {
-        requestedModeIndex = APP_CONTROLLED_MODE_ID;
-        modeChangeRequest = true;
-    }
+static void requestModeStep(int delta) {
+    postToEngine(EngineCommandType::StepMode, static_cast<int16_t>(delta));
 }
 
-static void applyScrollText(const std::string &text) {
-    if (xSemaphoreTake(dispMutex, pdMS_TO_TICKS(20)) == pdTRUE) {
-        appScrollText = String(text.c_str());
-        xSemaphoreGive(dispMutex);
-    } else {
-        appScrollText = String(text.c_str());
+static bool applyScrollText(const std::string &text, bool switchToScroller) {
+    if (text.size() > kEngineTextMax) {
+        Serial.printf("[BLE] scroll text rejected: %u bytes > %u\n", (unsigned)text.size(), (unsigned)kEngineTextMax);
+        return false;
     }
+    return postToEngine(EngineCommandType::SetScrollText, switchToScroller ? 1 : 0,
+                        reinterpret_cast<const uint8_t*>(text.data()), text.size());
 }
 
 static void applyScrollDirectionCommand(const std::string &command) {
     if (command == "DIR:AUTO") {
-        appScrollDirectionOverride = false;
+        postToEngine(EngineCommandType::SetScrollDirection, -1);
         Serial.println("[BLE] scroll direction override disabled (AUTO)");
         return;
     }
@@ -112,42 +129,25 @@ static void applyScrollDirectionCommand(const std::string &command) {
     else if (command == "DIR:DOWN") dir = 3;
 
     if (dir >= 0) {
-        appScrollDirection = dir;
-        appScrollDirectionOverride = true;
+        postToEngine(EngineCommandType::SetScrollDirection, static_cast<int16_t>(dir));
         Serial.printf("[BLE] scroll direction set to %d\n", dir);
     }
 }
 
-
-static void renderTextToCanvas(const std::string& text) {
-    if (xSemaphoreTake(dispMutex, pdMS_TO_TICKS(20)) != pdTRUE) return;
-    canvas.fillScreen(0);
-    canvas.setTextSize(1);
-    canvas.setTextWrap(false);
-    canvas.setCursor(0, 4);
-    canvas.print(text.c_str());
-    xSemaphoreGive(dispMutex);
+// Scroller takes the text if it is active, otherwise the engine renders it in app mode
+static bool showText(const std::string& text) {
+    if (text.size() > kEngineTextMax) {
+        Serial.printf("[BLE] text rejected: %u bytes > %u\n", (unsigned)text.size(), (unsigned)kEngineTextMax);
+        return false;
+    }
+    gLastText = text;
+    return postToEngine(EngineCommandType::ShowText, 0,
+                        reinterpret_cast<const uint8_t*>(text.data()), text.size());
 }
 
 static bool applyCanvasPacked(const uint8_t* payload, size_t length) {
-    if (payload == nullptr || length != 20) return false;
-    if (xSemaphoreTake(dispMutex, pdMS_TO_TICKS(20)) != pdTRUE) return false;
-
-    canvas.fillScreen(0);
-    for (int y = 0; y < 16; ++y) {
-        const int rowBase = y * 10;
-        for (int x = 0; x < 10; ++x) {
-            const int bitIndex = rowBase + x;
-            const uint8_t byteValue = payload[bitIndex >> 3];
-            const uint8_t bitMask = static_cast<uint8_t>(1u << (bitIndex & 7));
-            if ((byteValue & bitMask) != 0) {
-                canvas.drawPixel(x, y, 1);
-            }
-        }
-    }
-
-    xSemaphoreGive(dispMutex);
-    return true;
+    if (payload == nullptr || length != kCanvasPackedBytes) return false;
+    return postToEngine(EngineCommandType::SetCanvas, 0, payload, length);
 }
 
 static void notifyPacket(const std::vector<uint8_t>& packet) {
@@ -169,9 +169,20 @@ static void sendVersionResponse(uint8_t seq) {
     notifyPacket(matrixproto::buildPacket(matrixproto::VersionResponse, seq, ptr, strlen(version)));
 }
 
+// "Name|Name|..." in mode index order, straight from the engine's table
+static std::string modesPipe() {
+    std::string pipe;
+    for (int i = 0; i < gModeCount; i++) {
+        if (i > 0) pipe += '|';
+        pipe += gModeName(i);
+    }
+    return pipe;
+}
+
 static void sendModesResponse(uint8_t seq) {
-    const uint8_t *ptr = reinterpret_cast<const uint8_t *>(kFirmwareModesPipe);
-    notifyPacket(matrixproto::buildPacket(matrixproto::ModesResponse, seq, ptr, strlen(kFirmwareModesPipe)));
+    const std::string pipe = modesPipe();
+    const uint8_t *ptr = reinterpret_cast<const uint8_t *>(pipe.data());
+    notifyPacket(matrixproto::buildPacket(matrixproto::ModesResponse, seq, ptr, pipe.size()));
 }
 
 static bool otaBegin(uint32_t totalSize, uint16_t chunkSize) {
@@ -299,8 +310,8 @@ static GenericCallbacks* gOtaCb = nullptr;
 static GenericCallbacks* gControlCb = nullptr;
 static ServerCallbacks* gServerCb = nullptr;
 
-static void handleLegacyWrite(Source source, const std::vector<uint8_t>& data) {
-    if (data.empty()) return;
+static void handleLegacyWrite(Source source, const uint8_t* data, size_t length) {
+    if (length == 0) return;
 
     switch (source) {
         case Source::Mode:
@@ -308,27 +319,18 @@ static void handleLegacyWrite(Source source, const std::vector<uint8_t>& data) {
             Serial.printf("[BLE] legacy mode=%u\n", data[0]);
             break;
         case Source::Text: {
-            std::string text(data.begin(), data.end());
-            gLastText = text;
-            if (activeModeIndex == SCROLL_MODE_ID) {
-                applyScrollText(text);
-                Serial.printf("[BLE] scroll text len=%u\n", (unsigned)data.size());
-            } else {
-                activateAppControlledMode();
-                renderTextToCanvas(text);
-                Serial.printf("[BLE] legacy text len=%u\n", (unsigned)data.size());
-            }
+            std::string text(reinterpret_cast<const char*>(data), length);
+            showText(text);
+            Serial.printf("[BLE] legacy text len=%u\n", (unsigned)length);
             break;
         }
         case Source::Canvas:
-            if (data.size() == 20) {
-                activateAppControlledMode();
-                applyCanvasPacked(data.data(), data.size());
+            if (applyCanvasPacked(data, length)) {
                 Serial.println("[BLE] legacy canvas updated");
             }
             break;
         case Source::Version: {
-            std::string req(data.begin(), data.end());
+            std::string req(reinterpret_cast<const char*>(data), length);
             if (req == "GET_VERSION" && gVersionChar != nullptr) {
                 gVersionChar->setValue(getFwVersion());
                 gVersionChar->notify();
@@ -336,14 +338,18 @@ static void handleLegacyWrite(Source source, const std::vector<uint8_t>& data) {
             break;
         }
         case Source::Control: {
-            std::string cmd(data.begin(), data.end());
-            if (cmd == "NEXT") requestModeChange(activeModeIndex + 1);
-            else if (cmd == "PREV") requestModeChange(activeModeIndex - 1);
+            std::string cmd(reinterpret_cast<const char*>(data), length);
+            if (cmd == "NEXT") requestModeStep(1);
+            else if (cmd == "PREV") requestModeStep(-1);
             else if (cmd == "RESET") requestModeChange(0);
             else if (cmd == "SPECIAL") requestModeChange(10);
+            else if (cmd == "RECAL") postToEngine(EngineCommandType::Recalibrate, 0);
+            else if (cmd == "TRACE:REC") postToEngine(EngineCommandType::Trace, static_cast<int16_t>(TraceAction::Record));
+            else if (cmd == "TRACE:PLAY") postToEngine(EngineCommandType::Trace, static_cast<int16_t>(TraceAction::Replay));
+            else if (cmd == "TRACE:STOP") postToEngine(EngineCommandType::Trace, static_cast<int16_t>(TraceAction::Stop));
             else if (cmd == "GET_MODES") {
                 if (gVersionChar != nullptr) {
-                    std::string payload = std::string("MODES:") + kFirmwareModesPipe;
+                    std::string payload = std::string("MODES:") + modesPipe();
                     gVersionChar->setValue(payload);
                     gVersionChar->notify();
                 }
@@ -352,10 +358,7 @@ static void handleLegacyWrite(Source source, const std::vector<uint8_t>& data) {
                 applyScrollDirectionCommand(cmd);
             }
             else if (cmd.rfind("SCROLLTXT:", 0) == 0) {
-                applyScrollText(cmd.substr(10));
-                if (activeModeIndex != SCROLL_MODE_ID) {
-                    requestModeChange(SCROLL_MODE_ID);
-                }
+                applyScrollText(cmd.substr(10), true);
             }
             else if (cmd == "OTA_END") {
                 uint8_t status = STATUS_OK;
@@ -368,21 +371,21 @@ static void handleLegacyWrite(Source source, const std::vector<uint8_t>& data) {
                 Serial.println("[OTA] legacy chunk rejected: inactive session");
                 return;
             }
-            if (!gOtaHandler.writeLegacyChunk(data.data(), data.size())) {
-                Serial.printf("[OTA] legacy chunk write failed len=%u\n", (unsigned)data.size());
+            if (!gOtaHandler.writeLegacyChunk(data, length)) {
+                Serial.printf("[OTA] legacy chunk write failed len=%u\n", (unsigned)length);
                 return;
             }
-            gOta.bytesWritten += static_cast<uint32_t>(data.size());
+            gOta.bytesWritten += static_cast<uint32_t>(length);
             break;
     }
 }
 
-static void handleProtocolFrame(const std::vector<uint8_t>& frame) {
-    if (frame.size() < 8) return;
+static void handleProtocolFrame(const uint8_t* frame, size_t length) {
+    if (length < 8) return;
 
     const uint8_t seq = frame[3];
     matrixproto::Packet packet;
-    if (!matrixproto::parsePacket(frame.data(), frame.size(), packet)) {
+    if (!matrixproto::parsePacket(frame, length, packet)) {
         sendAckPacket(seq, STATUS_BAD_FRAME_OR_CRC, true);
         return;
     }
@@ -404,12 +407,13 @@ static void handleProtocolFrame(const std::vector<uint8_t>& frame) {
 
         case matrixproto::SetText: {
             std::string text(packet.payload.begin(), packet.payload.end());
-            gLastText = text;
-            if (activeModeIndex == SCROLL_MODE_ID) {
-                applyScrollText(text);
-            } else {
-                activateAppControlledMode();
-                renderTextToCanvas(text);
+            if (text.size() > kEngineTextMax) {
+                sendAckPacket(packet.seq, STATUS_TOO_LONG, true);
+                return;
+            }
+            if (!showText(text)) {
+                sendAckPacket(packet.seq, STATUS_INVALID_STATE, true);
+                return;
             }
             sendAckPacket(packet.seq, STATUS_OK, false);
             return;
@@ -425,12 +429,31 @@ static void handleProtocolFrame(const std::vector<uint8_t>& frame) {
             sendAckPacket(packet.seq, STATUS_OK, false);
             return;
 
+        case matrixproto::Recalibrate:
+            if (!postToEngine(EngineCommandType::Recalibrate, 0)) {
+                sendAckPacket(packet.seq, STATUS_INVALID_STATE, true);
+                return;
+            }
+            sendAckPacket(packet.seq, STATUS_OK, false);
+            return;
+
+        case matrixproto::Trace:
+            if (packet.payload.size() != 1 || packet.payload[0] > static_cast<uint8_t>(TraceAction::Replay)) {
+                sendAckPacket(packet.seq, STATUS_BAD_FRAME_OR_CRC, true);
+                return;
+            }
+            if (!postToEngine(EngineCommandType::Trace, static_cast<int16_t>(packet.payload[0]))) {
+                sendAckPacket(packet.seq, STATUS_INVALID_STATE, true);
+                return;
+            }
+            sendAckPacket(packet.seq, STATUS_OK, false);
+            return;
+
         case matrixproto::SetCanvas:
-            if (packet.payload.size() != 20 || !applyCanvasPacked(packet.payload.data(), packet.payload.size())) {
+            if (packet.payload.size() != kCanvasPackedBytes || !applyCanvasPacked(packet.payload.data(), packet.payload.size())) {
                 sendAckPacket(packet.seq, STATUS_BAD_FRAME_OR_CRC, true);
                 return;
             }
-            activateAppControlledMode();
             sendAckPacket(packet.seq, STATUS_OK, false);
             return;
 
@@ -493,33 +516,52 @@ static void handleProtocolFrame(const std::vector<uint8_t>& frame) {
 }
 
 static void processPendingWrite(const PendingWrite& item) {
-    const bool looksFramed = item.data.size() >= 2
+    const bool looksFramed = item.length >= 2
                           && item.data[0] == matrixproto::kPacketMagic
                           && item.data[1] == matrixproto::kPacketVersion;
 
+    if (item.oversize != 0) {
+        Serial.printf("[BLE] write rejected: %u bytes > %u\n", (unsigned)item.oversize, (unsigned)kMaxWriteBytes);
+        if ((item.source == Source::Control || item.source == Source::Ota) && looksFramed && item.length >= 4) {
+            sendAckPacket(item.data[3], STATUS_TOO_LONG, true);
+        }
+        return;
+    }
+
     if ((item.source == Source::Control || item.source == Source::Ota) && looksFramed) {
-        handleProtocolFrame(item.data);
+        handleProtocolFrame(item.data, item.length);
         return;
     }
 
-    handleLegacyWrite(item.source, item.data);
+    handleLegacyWrite(item.source, item.data, item.length);
 }
 
 } // namespace
 
 void setupComms() {
-    if (gQueueMutex == nullptr) {
-        gQueueMutex = xSemaphoreCreateMutex();
-    }
+    registerStaticBuffer("BLE writes", sizeof(gQueue),
+                         []() { return (uint32_t)(gQueue.peak() * sizeof(PendingWrite)); });
 
     // WiFi AP + classic ArduinoOTA support
     WiFi.mode(WIFI_AP);
     WiFi.softAP(WIFI_SSID, WIFI_PASS);
     Serial.printf("[COMMS] WiFi AP started SSID=%s\n", WIFI_SSID);
     
-    ArduinoOTA.onStart([]() { Serial.println("[OTA] ArduinoOTA start"); });
-    ArduinoOTA.onEnd([]() { Serial.println("[OTA] ArduinoOTA end"); });
-    ArduinoOTA.onError([](ota_error_t err) { Serial.printf("[OTA] ArduinoOTA error=%u\n", err); });
+    ArduinoOTA.onStart([]() {
+        gArduinoOtaActive = true;
+        Serial.println("[OTA] ArduinoOTA start");
+    });
+    ArduinoOTA.onEnd([]() {
+        gArduinoOtaActive = false;
+        Serial.println("[OTA] ArduinoOTA end");
+    });
+    ArduinoOTA.onError([](ota_error_t err) {
+        gArduinoOtaActive = false;
+        Serial.printf("[OTA] ArduinoOTA error=%u\n", err);
+    });
+    ArduinoOTA.onProgress([](unsigned int, unsigned int) {
+        if (gActivityObserver != nullptr) gActivityObserver();
+    });
     ArduinoOTA.begin();
 
     // BLE Setup (exact app contract)
@@ -589,26 +631,30 @@ void setupComms() {
     Serial.printf("[BLE] advertising %s\n", advStarted ? "started" : "failed");
 }
 
+void setCommsActivityObserver(void (*observer)()) {
+    gActivityObserver = observer;
+}
+
+void setCommsModeNames(const char* (*name)(int index), int count) {
+    gModeName = name;
+    gModeCount = name != nullptr ? count : 0;
+}
+
+bool commsHoldsAwake() {
+    if (gOta.active || gOtaHandler.active() || gArduinoOtaActive) return true;
+    if (gServer != nullptr && gServer->getConnectedCount() > 0) return true;
+    return WiFi.softAPgetStationNum() > 0;
+}
+
 void handleComms() {
     if (!gOta.active) {
         ArduinoOTA.handle();
     }
 
-    while (true) {
-        PendingWrite item;
-        bool hasItem = false;
-
-        if (gQueueMutex != nullptr && xSemaphoreTake(gQueueMutex, pdMS_TO_TICKS(5)) == pdTRUE) {
-            if (!gQueue.empty()) {
-                item = std::move(gQueue.front());
-                gQueue.pop_front();
-                hasItem = true;
-            }
-            xSemaphoreGive(gQueueMutex);
-        }
-
-        if (!hasItem) break;
-        processPendingWrite(item);
+    // Processed in place; the slot is released back to the producer afterwards
+    while (const PendingWrite* item = gQueue.front()) {
+        processPendingWrite(*item);
+        gQueue.release();
     }
 
     if (!gOta.active && gVersionChar != nullptr) {
@@ -14,14 +14,35 @@ void setupComms();
  */
 void handleComms();
 
+/**
+ * @brief Called on every BLE write and ArduinoOTA progress step (from the
+ * NimBLE host or comms task), so sleep timeouts count comms as use.
+ */
+void setCommsActivityObserver(void (*observer)());
+
+/**
+ * @brief True while an OTA update is running or a client is connected (BLE
+ * central or a station on the Wi-Fi AP, e.g. the web monitor); the device
+ * must not deep-sleep then.
+ */
+bool commsHoldsAwake();
+
+/**
+ * @brief The engine's mode table, for GET_MODES / ModesResponse: `name(i)`
+ * for i in [0, count) in mode index order. Set before the comms task starts.
+ */
+void setCommsModeNames(const char* (*name)(int index), int count);
+
 /**
  * BLE protocol used by Android app:
  * - CHAR_MODE_UUID   (Write, 1 byte): mode index [0..MODE_COUNT-1]
  * - CHAR_CANVAS_UUID (Write, 20 bytes): raw 1-bit framebuffer (10x16/8)
- * - CHAR_TEXT_UUID   (Write): UTF-8 text
+ * - CHAR_TEXT_UUID   (Write): UTF-8 text, at most 159 bytes (kEngineTextMax);
+ *   longer text is refused (NACK 0x06 for a framed SetText)
  * - CHAR_VERSION_UUID(Read/Notify): semantic firmware version (e.g. v1.0.7)
  * - CHAR_OTA_UUID    (Write): protocol OTA / legacy OTA data chunks
  * - CHAR_CONTROL_UUID(Write): framed protocol commands or legacy text commands
+ * Writes longer than 256 bytes are refused (NACK 0x06 when framed).
  * - CHAR_ACK_UUID    (Notify/Indicate): protocol ACK/NACK responses
  *
  * ACK/NACK status codes:
@@ -31,4 +52,5 @@ void handleComms();
  * 0x03 bad offset
  * 0x04 flash write error
  * 0x05 finalize error
+ * 0x06 payload too long
  */
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "DisplayDriver.h"
 #include "../Globals.h" 
 #include <SPI.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
 
 // --- Pins ---
 #define PIN_DATA 23 
@@ -15,19 +18,49 @@ const int ROWS[10] = {32, 33, 25, 26, 27, 14, 19, 13, 16, 4};
 volatile int currentRow = 0;
 hw_timer_t * timer = NULL;
 
-void IRAM_ATTR onTimer() {
-    // 1. Turn off rows
-    for (int i = 0; i < 10; i++) FAST_HIGH(ROWS[i]);
+// Row pin masks for the GPIO set/clear registers, resolved once in setup so the
+// ISR reads nothing from flash and does no per-pin branching. Everything the ISR
+// touches is IRAM/DRAM, so refresh keeps its timing while DFS changes the CPU clock.
+static DRAM_ATTR uint32_t rowMaskLow[10], rowMaskHigh[10];
+static DRAM_ATTR uint32_t allRowsLow = 0, allRowsHigh = 0;
 
+#if CONFIG_PM_ENABLE
+// The refresh timer counts APB cycles and stops in light sleep: the panel holds
+// APB at max and keeps the chip awake for as long as it is being scanned.
+static esp_pm_lock_handle_t panelApbLock = nullptr;
+static esp_pm_lock_handle_t panelAwakeLock = nullptr;
+#endif
 
+// Double-buffered frame the ISR scans out. Writers fill the back buffer and flip,
+// so the ISR never touches the canvas (or any flash-resident GFX code).
+static DRAM_ATTR uint16_t frameBuffers[2][10];
+static volatile uint8_t frontBuffer = 0;
 
-    // 2. Get Data from Global Canvas
-    uint16_t rowBits = 0;
-    for (int c = 0; c < 16; c++) {
-        if (canvas.getPixel(currentRow, c)) {
-            rowBits |= (1 << c);
-        }
-    }
+void displayPresent(const uint16_t rows[MATRIX_WIDTH]) {
+    const uint8_t back = frontBuffer ^ 1;
+    memcpy(frameBuffers[back], rows, sizeof(frameBuffers[back]));
+    frontBuffer = back;
+}
+
+void displayPresentCanvas() {
+    uint16_t rows[MATRIX_WIDTH];
+    canvasToPanelRows(rows);
+    displayPresent(rows);
+}
+
+void displayShutdown() {
+    if (timer != NULL) timerAlarmDisable(timer);
+    GPIO.out_w1ts = allRowsLow;
+    GPIO.out1_w1ts.val = allRowsHigh;
+}
+
+void IRAM_ATTR onTimer() {
+    // 1. Turn off rows
+    GPIO.out_w1ts = allRowsLow;
+    GPIO.out1_w1ts.val = allRowsHigh;
+
+    // 2. Get Data from the presented frame
+    uint16_t rowBits = frameBuffers[frontBuffer][currentRow];
     rowBits = ~rowBits; // Invert for Active Low logic
 
     // 3. Send Data (Byte 1 Normal MSB, Byte 2 Reversed)
@@ -44,7 +77,8 @@ void IRAM_ATTR onTimer() {
 
     // 4. Latch & Activate Row
     FAST_HIGH(PIN_LATCH); FAST_LOW(PIN_LATCH);
-    FAST_LOW(ROWS[currentRow]);
+    GPIO.out_w1tc = rowMaskLow[currentRow];
+    GPIO.out1_w1tc.val = rowMaskHigh[currentRow];
 
     // 5. Increment
     currentRow++;
@@ -58,7 +92,22 @@ void setupDisplayDriver() {
     for (int i = 0; i < 10; i++) {
         pinMode(ROWS[i], OUTPUT);
         FAST_HIGH(ROWS[i]); 
+        rowMaskLow[i] = ROWS[i] < 32 ? (1UL << ROWS[i]) : 0;
+        rowMaskHigh[i] = ROWS[i] < 32 ? 0 : (1UL << (ROWS[i] - 32));
+        allRowsLow |= rowMaskLow[i];
+        allRowsHigh |= rowMaskHigh[i];
     }
+
+#if CONFIG_PM_ENABLE
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "panel_apb", &panelApbLock) == ESP_OK) {
+        esp_pm_lock_acquire(panelApbLock);
+    }
+    if (esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "panel_awake", &panelAwakeLock) == ESP_OK) {
+        esp_pm_lock_acquire(panelAwakeLock);
+    }
+#endif
+
+    // 80 MHz APB / 80 = 1 MHz timer clock, 1000 counts = 1 kHz row rate
     timer = timerBegin(0, 80, true);
     timerAttachInterrupt(timer, &onTimer, true);
     timerAlarmWrite(timer, 1000, true); 
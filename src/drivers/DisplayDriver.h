@@ -2,4 +2,13 @@
 #include <Arduino.h>
 #include "Globals.h"
 
-void setupDisplayDriver();
\ No newline at end of file
+void setupDisplayDriver();
+
+// Hands a finished frame (panel row words, see canvasToPanelRows) to the refresh ISR
+void displayPresent(const uint16_t rows[MATRIX_WIDTH]);
+
+// Convenience: presents the current canvas as-is
+void displayPresentCanvas();
+
+// Stops the refresh timer and blanks every row (before deep sleep)
+void displayShutdown();
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include "ImuSampler.h"
+#include "Config.h"
+#include "Globals.h"
+#include "StaticTasks.h"
+#include <esp_timer.h>
+
+ImuSampler* ImuSampler::s_instance = nullptr;
+
+STATIC_TASK_BUFFERS(imuTask, IMU_TASK_STACK);
+
+namespace {
+
+static constexpr uint8_t kSampleBytes = 12;  // accel XYZ + gyro XYZ, big-endian
+static constexpr uint8_t kBurstSamples = 8;  // per getFIFOBytes() call
+static constexpr uint16_t kFifoBytes = 1024;
+
+inline int16_t be16(const uint8_t* p) {
+    return static_cast<int16_t>((p[0] << 8) | p[1]);
+}
+
+}
+
+void ImuSampler::begin(UBaseType_t priority, BaseType_t core) {
+    s_instance = this;
+    m_batch = IMU_BATCH;
+    m_task = createStaticTask(taskEntry, "IMU", imuTaskStack, IMU_TASK_STACK, &imuTaskTcb,
+                              this, priority, core);
+}
+
+void ImuSampler::taskEntry(void* arg) {
+    static_cast<ImuSampler*>(arg)->run();
+}
+
+void ImuSampler::waitReady() const {
+    while (m_seq.load(std::memory_order_acquire) == 0) vTaskDelay(1);
+}
+
+bool ImuSampler::latest(ImuSample& out) const {
+    uint32_t before, after;
+    do {
+        before = m_seq.load(std::memory_order_acquire);
+        if (before == 0) return false;
+        out = m_latest;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = m_seq.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+    return true;
+}
+
+void ImuSampler::publish(const ImuSample& s) {
+    m_ring.push(s);  // Full ring: the consumer fell behind, counted in dropped()
+
+    const uint32_t seq = m_seq.load(std::memory_order_relaxed);
+    m_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_latest = s;
+    m_seq.store(seq + 2, std::memory_order_release);
+}
+
+void IRAM_ATTR ImuSampler::onDataReadyStatic() {
+    if (s_instance) s_instance->onDataReady();
+}
+
+// DRDY pulses once per sample; wake the task once a batch is in the FIFO
+void IRAM_ATTR ImuSampler::onDataReady() {
+    m_lastDrdyUs = (uint32_t)esp_timer_get_time();
+    if (++m_pending < m_batch) return;
+    m_pending = 0;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(m_task, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+void ImuSampler::configure() {
+    mpu.initialize();  // Clock source, +-2 g, +-250 dps, sleep off
+
+    // Undo anything the motion-wake setup left behind
+    mpu.setWakeCycleEnabled(false);
+    mpu.setStandbyXGyroEnabled(false);
+    mpu.setStandbyYGyroEnabled(false);
+    mpu.setStandbyZGyroEnabled(false);
+    mpu.setTempSensorEnabled(true);
+    mpu.setIntMotionEnabled(false);
+    mpu.setDHPFMode(0);
+
+    // 1 kHz internal rate with the DLPF on; divider brings it to IMU_SAMPLE_HZ
+    mpu.setDLPFMode(MPU6050_DLPF_BW_42);
+    mpu.setRate(1000 / IMU_SAMPLE_HZ - 1);
+
+    // DRDY: active-high 50 us pulse, no latch
+    mpu.setInterruptMode(false);
+    mpu.setInterruptDrive(false);
+    mpu.setInterruptLatch(false);
+    mpu.setIntDataReadyEnabled(true);
+
+    mpu.setAccelFIFOEnabled(true);
+    mpu.setXGyroFIFOEnabled(true);
+    mpu.setYGyroFIFOEnabled(true);
+    mpu.setZGyroFIFOEnabled(true);
+    mpu.setFIFOEnabled(true);
+    mpu.resetFIFO();
+    mpu.getIntStatus();
+    m_pending = 0;
+}
+
+void ImuSampler::account(uint32_t txnUs, uint32_t txns) {
+    m_txnWindow += txns;
+    m_busUsWindow += txnUs;
+    const uint32_t per = txnUs / txns;
+    m_stats.txnUsAvg = m_stats.txnUsAvg == 0 ? per : m_stats.txnUsAvg - (m_stats.txnUsAvg >> 3) + (per >> 3);
+}
+
+void ImuSampler::drain() {
+    int64_t t0 = esp_timer_get_time();
+    const uint16_t count = mpu.getFIFOCount();
+    account((uint32_t)(esp_timer_get_time() - t0), 1);
+
+    if (count >= kFifoBytes) {
+        // Overflowed: contents are no longer sample-aligned
+        mpu.resetFIFO();
+        m_stats.fifoOverflows++;
+        return;
+    }
+
+    uint16_t n = count / kSampleBytes;
+    if (n == 0) return;
+    m_drainsWindow++;
+
+    // The newest sample in the FIFO is the one the last DRDY announced
+    const uint32_t periodUs = 1000000UL / IMU_SAMPLE_HZ;
+    const uint32_t now = (uint32_t)esp_timer_get_time();
+    const uint32_t drdy = m_lastDrdyUs;
+    uint32_t tUs = (now - drdy < 2 * periodUs) ? drdy : now;
+    tUs -= (n - 1) * periodUs;
+
+    uint8_t buf[kBurstSamples * kSampleBytes];
+    while (n > 0) {
+        const uint8_t chunk = n < kBurstSamples ? n : kBurstSamples;
+        t0 = esp_timer_get_time();
+        mpu.getFIFOBytes(buf, chunk * kSampleBytes);
+        account((uint32_t)(esp_timer_get_time() - t0), 1);
+
+        for (uint8_t i = 0; i < chunk; i++) {
+            const uint8_t* p = buf + i * kSampleBytes;
+            ImuSample s;
+            s.tUs = tUs;
+            s.ax = be16(p + 0);
+            s.ay = be16(p + 2);
+            s.az = be16(p + 4);
+            s.gx = be16(p + 6);
+            s.gy = be16(p + 8);
+            s.gz = be16(p + 10);
+            publish(s);
+            tUs += periodUs;
+        }
+        m_samplesWindow += chunk;
+        n -= chunk;
+    }
+}
+
+void ImuSampler::rollStats() {
+    const unsigned long now = millis();
+    const unsigned long elapsed = now - m_windowStartMs;
+    if (elapsed < 1000) return;
+
+    m_stats.samplesPerSec = m_samplesWindow * 1000UL / elapsed;
+    m_stats.drainsPerSec = m_drainsWindow * 1000UL / elapsed;
+    m_stats.txnPerSec = m_txnWindow * 1000UL / elapsed;
+    m_stats.busPermille = m_busUsWindow / elapsed;  // us per ms == permille
+    m_samplesWindow = m_drainsWindow = m_txnWindow = m_busUsWindow = 0;
+    m_windowStartMs = now;
+}
+
+void ImuSampler::run() {
+    Wire.begin();
+    Wire.setClock(400000); // 400kHz I2C Speed
+    configure();
+
+    pinMode(MPU_INT_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(MPU_INT_PIN), onDataReadyStatic, RISING);
+    m_windowStartMs = millis();
+
+    while (true) {
+        if (m_suspendRequested) {
+            detachInterrupt(digitalPinToInterrupt(MPU_INT_PIN));
+            // DRDY shares INT with motion wake: with the latch on it would hold
+            // the pin high, so stop it and the FIFO, then clear what is pending
+            mpu.setIntDataReadyEnabled(false);
+            mpu.setFIFOEnabled(false);
+            mpu.getIntStatus();
+            m_suspended = true;
+            while (m_suspendRequested) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            configure();
+            attachInterrupt(digitalPinToInterrupt(MPU_INT_PIN), onDataReadyStatic, RISING);
+            m_suspended = false;
+        }
+
+        // Woken per batch by DRDY; the timeout keeps sampling alive without INT
+        const uint32_t batchMs = (uint32_t)m_batch * 1000UL / IMU_SAMPLE_HZ;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(2 * batchMs + 1));
+        if (m_suspendRequested) continue;
+
+        drain();
+        rollStats();
+    }
+}
+
+void ImuSampler::suspend() {
+    m_suspendRequested = true;
+    xTaskNotifyGive(m_task);
+    while (!m_suspended) vTaskDelay(1);
+}
+
+void ImuSampler::resume() {
+    m_suspendRequested = false;
+    xTaskNotifyGive(m_task);
+}
+
+void ImuSampler::noteConsumerUs(uint32_t us) {
+    m_stats.consumerUsX8 = m_stats.consumerUsX8 - (m_stats.consumerUsX8 >> 3) + us;
+}
+
+String ImuSampler::toJson() const {
+    String json = "{\"rate_hz\":" + String(m_stats.samplesPerSec);
+    json += ",\"drains_s\":" + String(m_stats.drainsPerSec);
+    json += ",\"i2c_s\":" + String(m_stats.txnPerSec);
+    json += ",\"bus_permille\":" + String(m_stats.busPermille);
+    json += ",\"txn_us\":" + String(m_stats.txnUsAvg);
+    json += ",\"game_read_us\":" + String(m_stats.consumerUsX8 / 8.0f, 1);
+    json += ",\"fifo_overflows\":" + String(m_stats.fifoOverflows);
+    json += ",\"ring_dropped\":" + String(m_ring.dropped());
+    json += "}";
+    return json;
+}
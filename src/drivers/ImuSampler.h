@@ -0,0 +1,94 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "engine/SpscQueue.h"
+
+// One accelerometer + gyro reading, raw MPU6050 LSB
+struct ImuSample {
+    uint32_t tUs;  // esp_timer time the sample was taken (reconstructed from DRDY)
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+};
+
+/**
+ * @brief Owns the MPU6050 and the I2C bus on a dedicated task.
+ * The sensor samples at IMU_SAMPLE_HZ into its FIFO (DLPF on); the data-ready
+ * interrupt counts samples and wakes the task every `batch` samples, which
+ * drains the FIFO in burst reads. Samples go to a lock-free ring (one
+ * consumer: the game task) and to a seqlock snapshot any task can read.
+ * With no INT wired the task falls back to draining on a timeout.
+ */
+class ImuSampler {
+public:
+    typedef SpscQueue<ImuSample, 256> Ring;  // ~0.5 s: covers the longest idle tick
+
+    struct Stats {
+        uint32_t samplesPerSec = 0;
+        uint32_t drainsPerSec = 0;
+        uint32_t txnPerSec = 0;       // I2C transactions (count + burst reads)
+        uint32_t busPermille = 0;     // share of wall time the bus was busy
+        uint32_t txnUsAvg = 0;        // EWMA cost of one transaction (1/8 weight)
+        uint32_t fifoOverflows = 0;
+        uint32_t consumerUsX8 = 0;    // game loop time taking samples, EWMA scaled by 8
+    };
+
+    // Creates the sampler task; it initialises the bus and the sensor itself
+    void begin(UBaseType_t priority, BaseType_t core);
+
+    // Blocks the caller until the first sample is published
+    void waitReady() const;
+
+    // Game task: next queued sample, oldest first
+    bool pop(ImuSample& out) { return m_ring.pop(out); }
+
+    // Any task: most recent sample (false before the first one)
+    bool latest(ImuSample& out) const;
+
+    // Samples per wake-up; larger batches mean fewer, longer bursts
+    void setBatch(uint8_t samples) { m_batch = samples > 0 ? samples : 1; }
+
+    // Stops sampling, turns off DRDY and the FIFO, clears the interrupt status
+    // and releases the bus (e.g. to arm motion wake); resume() reconfigures
+    void suspend();
+    void resume();
+
+    // Game task reports how long taking its samples cost this frame
+    void noteConsumerUs(uint32_t us);
+
+    const Stats& stats() const { return m_stats; }
+    uint32_t ringDropped() const { return m_ring.dropped(); }
+
+    String toJson() const;
+
+private:
+    static void taskEntry(void* arg);
+    static void IRAM_ATTR onDataReadyStatic();
+    void IRAM_ATTR onDataReady();
+
+    void run();
+    void configure();
+    void drain();
+    void publish(const ImuSample& s);
+    void account(uint32_t txnUs, uint32_t txns);
+    void rollStats();
+
+    TaskHandle_t m_task = nullptr;
+    Ring m_ring;
+
+    // Seqlock: odd while the snapshot is being written
+    std::atomic<uint32_t> m_seq{0};
+    ImuSample m_latest = {};
+
+    volatile uint8_t m_batch = 1;
+    volatile uint8_t m_pending = 0;       // DRDY edges since the last wake (ISR)
+    volatile uint32_t m_lastDrdyUs = 0;
+
+    volatile bool m_suspendRequested = false;
+    volatile bool m_suspended = false;
+
+    Stats m_stats;
+    unsigned long m_windowStartMs = 0;
+    uint32_t m_samplesWindow = 0, m_drainsWindow = 0, m_txnWindow = 0, m_busUsWindow = 0;
+
+    static ImuSampler* s_instance;
+};
@@ -14,6 +14,8 @@ enum PacketType : uint8_t {
     GetVersion = 0x12,
     SetCanvas = 0x13,
     GetModes = 0x14,
+    Recalibrate = 0x15,
+    Trace = 0x16,
     OtaBegin = 0x20,
     OtaChunk = 0x21,
     OtaEnd = 0x22,
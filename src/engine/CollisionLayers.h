@@ -0,0 +1,175 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "FixedMath.h"
+
+/**
+ * @brief Named bit planes for the grid games (up to 16 x 32 cells): one
+ * row word per pixel row and layer, bit x for column x, as the physics
+ * wall layer (engine/Physics2D.h) and SandGrid use. A game names its
+ * layers with an enum (bricks, aliens, shots, the Tetris pile...), and
+ * collision questions become row-word ANDs instead of loops over cells:
+ * does a sprite hit a layer, do two layers overlap (and clear what did),
+ * which rows are full, how many cells are set, how low a layer reaches.
+ *
+ * Sprites are short arrays of row words in the same bit order, placed
+ * with their bit 0 at column x. Pure and host-portable.
+ */
+template <int Count>
+class CollisionLayers {
+public:
+    static constexpr int kLayers = Count;
+    static constexpr int kMaxRows = 32;
+
+    CollisionLayers(int width = 10, int height = 16) { configure(width, height); }
+
+    void configure(int width, int height) {
+        m_width = width < 1 ? 1 : (width > 16 ? 16 : width);
+        m_height = height < 1 ? 1 : (height > kMaxRows ? kMaxRows : height);
+        m_mask = (uint16_t)((1u << m_width) - 1);
+        clear();
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    // A row with every column set
+    uint16_t fullRow() const { return m_mask; }
+
+    // Row y of a layer holds columns 0..width-1 in bits 0..width-1
+    uint16_t* rows(int layer) { return m_rows[layer]; }
+    const uint16_t* rows(int layer) const { return m_rows[layer]; }
+
+    void clear() { memset(m_rows, 0, sizeof(m_rows)); }
+    void clear(int layer) { memset(m_rows[layer], 0, sizeof(m_rows[layer])); }
+
+    bool get(int layer, int x, int y) const {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height && ((m_rows[layer][y] >> x) & 1);
+    }
+    void set(int layer, int x, int y, bool on = true) {
+        if (x < 0 || x >= m_width || y < 0 || y >= m_height) return;
+        if (on) m_rows[layer][y] |= (uint16_t)(1u << x);
+        else m_rows[layer][y] &= (uint16_t)~(1u << x);
+    }
+
+    // ORs a sprite of h rows into the layer at (x, y), clipped to the field
+    void stamp(int layer, int x, int y, const uint16_t* sprite, int h) {
+        for (int r = 0; r < h; r++) {
+            if (y + r >= 0 && y + r < m_height) m_rows[layer][y + r] |= place(sprite[r], x);
+        }
+    }
+
+    // True if any sprite cell lands on a set cell of the layer
+    bool hits(int layer, int x, int y, const uint16_t* sprite, int h) const {
+        for (int r = 0; r < h; r++) {
+            if (y + r >= 0 && y + r < m_height && (m_rows[layer][y + r] & place(sprite[r], x))) return true;
+        }
+        return false;
+    }
+
+    // True if every sprite cell is within the columns and above the bottom
+    // row (rows above the top count as inside: things drop in from there)
+    bool inside(int x, int y, const uint16_t* sprite, int h) const {
+        for (int r = 0; r < h; r++) {
+            if (!sprite[r]) continue;
+            if (y + r >= m_height) return false;
+            const uint16_t p = place(sprite[r], x);
+            if ((x >= 0 ? (uint32_t)p >> x : (uint32_t)p << -x) != sprite[r]) return false;
+        }
+        return true;
+    }
+
+    bool overlaps(int a, int b) const {
+        uint16_t any = 0;
+        for (int y = 0; y < m_height; y++) any |= m_rows[a][y] & m_rows[b][y];
+        return any != 0;
+    }
+
+    // Clears the cells set in both layers from both; returns how many there were
+    int clearOverlap(int a, int b) {
+        int n = 0;
+        for (int y = 0; y < m_height; y++) {
+            const uint16_t both = m_rows[a][y] & m_rows[b][y];
+            if (!both) continue;
+            m_rows[a][y] &= (uint16_t)~both;
+            m_rows[b][y] &= (uint16_t)~both;
+            n += fixmath::popcount32(both);
+        }
+        return n;
+    }
+
+    // Bit y set for every full row
+    uint32_t fullRows(int layer) const {
+        uint32_t full = 0;
+        for (int y = 0; y < m_height; y++) full |= (uint32_t)(m_rows[layer][y] == m_mask) << y;
+        return full;
+    }
+
+    // Removes the rows in `which` (bit y = row y); the rows above drop into
+    // the gaps and empty rows come in at the top. Returns how many went.
+    int removeRows(int layer, uint32_t which) {
+        uint16_t* rows = m_rows[layer];
+        int to = m_height - 1;
+        for (int y = m_height - 1; y >= 0; y--) {
+            if (!((which >> y) & 1)) rows[to--] = rows[y];
+        }
+        const int removed = to + 1;
+        for (; to >= 0; to--) rows[to] = 0;
+        return removed;
+    }
+
+    int count(int layer) const {
+        int n = 0;
+        for (int y = 0; y < m_height; y++) n += fixmath::popcount32(m_rows[layer][y]);
+        return n;
+    }
+
+    // Lowest row (largest y) with a set cell, or -1 if the layer is empty
+    int lowestRow(int layer) const {
+        for (int y = m_height - 1; y >= 0; y--) {
+            if (m_rows[layer][y]) return y;
+        }
+        return -1;
+    }
+
+    // Columns with a set cell in any row (bit x)
+    uint16_t columns(int layer) const {
+        uint16_t any = 0;
+        for (int y = 0; y < m_height; y++) any |= m_rows[layer][y];
+        return any;
+    }
+
+    // Moves the whole layer by (dx, dy) cells; what leaves the field is lost
+    void shift(int layer, int dx, int dy) {
+        uint16_t moved[kMaxRows];
+        for (int y = 0; y < m_height; y++) {
+            const int from = y - dy;
+            moved[y] = from >= 0 && from < m_height ? place(m_rows[layer][from], dx) : 0;
+        }
+        memcpy(m_rows[layer], moved, sizeof(uint16_t) * m_height);
+    }
+
+    // ORs the layer into display row words (leftmost pixel in the top bit,
+    // 0x8000 >> x, as rowsToCanvas takes them)
+    void draw(int layer, uint16_t* out) const {
+        for (int y = 0; y < m_height; y++) out[y] |= reverse(m_rows[layer][y]);
+    }
+
+    // Bit x to bit 15 - x
+    static uint16_t reverse(uint16_t v) {
+        v = (uint16_t)(((v >> 1) & 0x5555) | ((v & 0x5555) << 1));
+        v = (uint16_t)(((v >> 2) & 0x3333) | ((v & 0x3333) << 2));
+        v = (uint16_t)(((v >> 4) & 0x0F0F) | ((v & 0x0F0F) << 4));
+        return (uint16_t)((v >> 8) | (v << 8));
+    }
+
+private:
+    // Sprite row with its bit 0 at column x, clipped to the field
+    uint16_t place(uint16_t row, int x) const {
+        if (x <= -16 || x >= 16) return 0;
+        return (uint16_t)((x >= 0 ? (uint32_t)row << x : (uint32_t)row >> -x) & m_mask);
+    }
+
+    int m_width = 10, m_height = 16;
+    uint16_t m_mask = 0x3FF;
+    uint16_t m_rows[Count][kMaxRows];
+};
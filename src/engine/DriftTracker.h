@@ -0,0 +1,91 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Slow accelerometer zero-drift correction from still windows.
+ * Each window reports how far its X/Y mean sits from the calibrated zero.
+ * An axis only moves after `agree` windows in a row, each at least `gapMs`
+ * after the previous one, put the error on the same side by more than the
+ * dead band; it then moves `step` LSB toward the windows, and at most
+ * `maxTotal` LSB away from the last explicit calibration (anchor()).
+ * A board left on a sloped desk therefore keeps most of its real tilt:
+ * the correction is bounded, and only recalibrating moves the zero further.
+ * Pure and host-portable.
+ */
+class DriftTracker {
+public:
+    DriftTracker(int32_t deadband, int32_t step, int32_t maxTotal, uint8_t agree, uint32_t gapMs)
+        : m_deadband(deadband), m_step(step), m_maxTotal(maxTotal), m_agree(agree), m_gapMs(gapMs) {}
+
+    // An explicit calibration: forget the votes and the applied correction
+    void anchor() {
+        for (int a = 0; a < 2; a++) {
+            m_votes[a] = 0;
+            m_sign[a] = 0;
+            m_total[a] = 0;
+            m_nudge[a] = 0;
+        }
+        m_voted = false;
+    }
+
+    // One still window's error per axis (window mean minus zero, raw LSB),
+    // or a window that is not flat enough to judge (`flat` false: the board
+    // is being held or propped on purpose, so any agreement so far is void).
+    // True when nudge() moved an axis.
+    bool addWindow(int32_t errX, int32_t errY, bool flat, uint32_t nowMs) {
+        m_nudge[0] = m_nudge[1] = 0;
+        if (!flat) {
+            m_votes[0] = m_votes[1] = 0;
+            return false;
+        }
+        if (m_voted && nowMs - m_lastVoteMs < m_gapMs) return false;  // Too soon to count again
+        m_voted = true;
+        m_lastVoteMs = nowMs;
+        m_windows++;
+
+        const int32_t err[2] = { errX, errY };
+        bool moved = false;
+        for (int a = 0; a < 2; a++) {
+            const int8_t sign = err[a] > m_deadband ? 1 : (err[a] < -m_deadband ? -1 : 0);
+            if (sign == 0 || sign != m_sign[a]) m_votes[a] = 0;
+            m_sign[a] = sign;
+            if (sign == 0 || ++m_votes[a] < m_agree) continue;
+
+            int32_t next = m_total[a] + sign * m_step;
+            if (next > m_maxTotal) next = m_maxTotal;
+            if (next < -m_maxTotal) next = -m_maxTotal;
+            if (next == m_total[a]) {
+                m_capped++;  // Out of correction budget: needs a recalibration
+                continue;
+            }
+            m_nudge[a] = next - m_total[a];
+            m_total[a] = next;
+            moved = true;
+        }
+        if (moved) m_nudges++;
+        return moved;
+    }
+
+    // What the last addWindow() moved an axis by (0 = X, 1 = Y), raw LSB
+    int32_t nudge(int axis) const { return m_nudge[axis]; }
+    // Correction applied since anchor(), raw LSB
+    int32_t total(int axis) const { return m_total[axis]; }
+
+    uint32_t windows() const { return m_windows; }
+    uint32_t nudges() const { return m_nudges; }
+    uint32_t capped() const { return m_capped; }
+
+private:
+    int32_t m_deadband, m_step, m_maxTotal;
+    uint8_t m_agree;
+    uint32_t m_gapMs;
+
+    uint8_t m_votes[2] = { 0, 0 };
+    int8_t m_sign[2] = { 0, 0 };
+    int32_t m_total[2] = { 0, 0 };
+    int32_t m_nudge[2] = { 0, 0 };
+    bool m_voted = false;
+    uint32_t m_lastVoteMs = 0;
+
+    uint32_t m_windows = 0, m_nudges = 0, m_capped = 0;
+};
@@ -0,0 +1,198 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Fixed-point math for the visual modes: Q16.16 and Q8.8 numbers,
+ * table sine/cosine, atan2 and integer square roots, saturating
+ * arithmetic, plus the bit count and xorshift stream the grid engines
+ * share. Header-only, C++11, no floating point at run time.
+ *
+ * Angles are binary angles as in OrientationFilter: 65536 per turn, so a
+ * uint16_t wraps exactly once around the circle (16384 = 90 degrees).
+ * The sine table (257 Q16 entries, 1 KB of flash) is generated by the
+ * compiler; between entries it is interpolated linearly, which keeps the
+ * error under 2^-13. The LX6 emulates double arithmetic (and libm's double
+ * sin/cos/sqrt) in software, which is what the modes used before; on a
+ * desktop FPU Cube and Starfield run slower in fixed point (test_fixed_math),
+ * so their device cost is read from the "frame" stats.
+ */
+namespace fixmath {
+
+typedef int32_t q16;  // Q16.16
+typedef int16_t q8;   // Q8.8
+
+static constexpr q16 kOne = 1 << 16;
+static constexpr q8 kOne8 = 1 << 8;
+static constexpr uint32_t kQuarterTurn = 16384;
+
+// --- Conversions -------------------------------------------------------
+
+constexpr q16 fromInt(int32_t v) { return (q16)((uint32_t)v << 16); }
+constexpr int32_t toInt(q16 v) { return v >> 16; }                      // Floor
+constexpr int32_t roundToInt(q16 v) { return (v + (1 << 15)) >> 16; }   // Nearest, halves up
+constexpr q8 toQ8(q16 v) { return (q8)((v + (1 << 7)) >> 8); }          // Range +-128, not checked
+constexpr q16 fromQ8(q8 v) { return (q16)v * 256; }
+
+// Compile-time constants from decimals, e.g. constant(0.2)
+constexpr q16 constant(double v) { return (q16)(v * 65536.0 + (v < 0 ? -0.5 : 0.5)); }
+constexpr q8 constant8(double v) { return (q8)(v * 256.0 + (v < 0 ? -0.5 : 0.5)); }
+// Binary angles from degrees / radians, at compile time (not wrapped, so
+// they also work as angular speeds; the names dodge Arduino's macros)
+constexpr int32_t angleFromDegrees(double deg) {
+    return (int32_t)(deg * 65536.0 / 360.0 + (deg < 0 ? -0.5 : 0.5));
+}
+constexpr int32_t angleFromRadians(double rad) {
+    return (int32_t)(rad * 65536.0 / 6.283185307179586 + (rad < 0 ? -0.5 : 0.5));
+}
+
+// --- Saturating arithmetic ---------------------------------------------
+
+constexpr int32_t clamp(int32_t v, int32_t lo, int32_t hi) { return v < lo ? lo : (v > hi ? hi : v); }
+constexpr int32_t sat32(int64_t v) { return v > INT32_MAX ? INT32_MAX : (v < INT32_MIN ? INT32_MIN : (int32_t)v); }
+constexpr int16_t sat16(int32_t v) { return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v); }
+
+constexpr int32_t addSat(int32_t a, int32_t b) { return sat32((int64_t)a + b); }
+constexpr int32_t subSat(int32_t a, int32_t b) { return sat32((int64_t)a - b); }
+constexpr int16_t addSat16(int16_t a, int16_t b) { return sat16((int32_t)a + b); }
+constexpr int16_t subSat16(int16_t a, int16_t b) { return sat16((int32_t)a - b); }
+
+// --- Multiply and divide -----------------------------------------------
+
+constexpr q16 mul(q16 a, q16 b) { return (q16)(((int64_t)a * b) >> 16); }  // Wraps on overflow
+constexpr q16 mulSat(q16 a, q16 b) { return sat32(((int64_t)a * b) >> 16); }
+constexpr q8 mul8(q8 a, q8 b) { return (q8)(((int32_t)a * b) >> 8); }
+constexpr q8 mulSat8(q8 a, q8 b) { return sat16(((int32_t)a * b) >> 8); }
+
+// Quotient truncated toward zero; dividing by zero saturates toward a's sign
+inline q16 divide(q16 a, q16 b) {
+    if (b == 0) return a < 0 ? INT32_MIN : INT32_MAX;
+    return sat32(((int64_t)a * 65536) / b);
+}
+
+// a + (b - a) * t, t in Q16 0..kOne
+constexpr q16 lerp(q16 a, q16 b, q16 t) { return a + (q16)(((int64_t)(b - a) * t) >> 16); }
+
+// --- Square roots ------------------------------------------------------
+
+// floor(sqrt(v))
+inline uint32_t isqrt(uint32_t v) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+inline uint32_t isqrt64(uint64_t v) {
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+// Square root of a non-negative Q16 number (negative gives 0)
+inline q16 sqrt(q16 v) { return v <= 0 ? 0 : (q16)isqrt64((uint64_t)v << 16); }
+
+// Length of (x, y), in the units of x and y
+inline uint32_t hypot(int32_t x, int32_t y) {
+    return isqrt64((uint64_t)((int64_t)x * x) + (uint64_t)((int64_t)y * y));
+}
+
+// --- Trigonometry ------------------------------------------------------
+
+namespace detail {
+
+// sin(x) for |x| <= pi/2 by Taylor series, evaluated by the compiler
+constexpr double sinTerms(double x2, double term, int k) {
+    return k > 12 ? 0.0 : term + sinTerms(x2, -term * x2 / ((2.0 * k) * (2.0 * k + 1.0)), k + 1);
+}
+constexpr double quarterSin(int step) {  // sin(step * 90 deg / 64)
+    return sinTerms((step * 1.5707963267948966 / 64) * (step * 1.5707963267948966 / 64),
+                    step * 1.5707963267948966 / 64, 1);
+}
+// Entry i of a whole turn in 256 steps, in Q16
+constexpr int32_t sinEntry(int i) {
+    return (int32_t)(((i & 128) ? -65536.0 : 65536.0) * quarterSin((i & 64) ? 64 - (i & 63) : (i & 63)) +
+                     ((i & 128) ? -0.5 : 0.5));
+}
+
+template <int... I> struct Indices {};
+template <int N, int... I> struct MakeIndices : MakeIndices<N - 1, N - 1, I...> {};
+template <int... I> struct MakeIndices<0, I...> { typedef Indices<I...> type; };
+
+template <typename> struct SineTable;
+template <int... I> struct SineTable<Indices<I...>> {
+    static constexpr int32_t kValues[sizeof...(I)] = { sinEntry(I)... };
+};
+template <int... I> constexpr int32_t SineTable<Indices<I...>>::kValues[sizeof...(I)];
+
+typedef SineTable<MakeIndices<257>::type> Sine;
+
+}  // namespace detail
+
+// sin(angle) in Q16, -kOne..kOne
+inline q16 sin(uint16_t angle) {
+    const int32_t* table = detail::Sine::kValues;
+    const int i = angle >> 8;
+    const int32_t a = table[i];
+    return a + (((table[i + 1] - a) * (int32_t)(angle & 0xFF)) >> 8);
+}
+inline q16 cos(uint16_t angle) { return sin((uint16_t)(angle + kQuarterTurn)); }
+
+// Q8.8 versions, -256..256
+inline q8 sin8(uint16_t angle) { return toQ8(sin(angle)); }
+inline q8 cos8(uint16_t angle) { return toQ8(cos(angle)); }
+
+// --- Bits and pseudo-random streams -------------------------------------
+
+// Set bits in v (SWAR: no table, no loop)
+inline int popcount32(uint32_t v) {
+    v = v - ((v >> 1) & 0x55555555u);
+    v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+    return (int)((((v + (v >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+}
+
+// Advances a xorshift32 stream (Marsaglia's 13/17/5) and returns the new
+// state. A zero state stays zero, so seed with anything else.
+inline uint32_t xorshift32(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// atan2 in binary angles (0 = +x, 16384 = +y), max error ~0.25 deg
+inline int16_t atan2(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+    const uint32_t ax = x < 0 ? (uint32_t)-(int64_t)x : (uint32_t)x;
+    const uint32_t ay = y < 0 ? (uint32_t)-(int64_t)y : (uint32_t)y;
+    // First octant: z = min / max in Q15, atan(z) ~ z * (pi/4 + 0.273 * (1 - z))
+    const bool steep = ay > ax;
+    const uint32_t num = steep ? ax : ay;
+    const uint32_t den = steep ? ay : ax;
+    const int32_t z = (int32_t)(((uint64_t)num << 15) / den);
+    int32_t a = (z * (8192 + ((2847 * (32768 - z)) >> 15))) >> 15;  // 0..8192 (45 deg)
+    if (steep) a = 16384 - a;
+    if (x < 0) a = 32768 - a;
+    if (y < 0) a = -a;
+    return (int16_t)a;
+}
+
+}  // namespace fixmath
@@ -0,0 +1,498 @@
+#pragma once
+#include <stdint.h>
+
+// Generated by tools/gesture_model/train.cpp; do not edit.
+// 48 x 6 frames at 50 Hz -> 288-24-16-5 MLP, int8. Held-out synthetic accuracy 98.7%
+// (2000 windows, seed 7, as test_gesture_net reports it).
+// Classes: idle, flick left, flick right, double tap, circle (gesturenet::NetClass).
+alignas(4) static const uint8_t kGestureModel[7824] = {
+    0x4d, 0x58, 0x4e, 0x31, 0x01, 0x00, 0x03, 0x05, 0x30, 0x06, 0x32, 0x08, 0x18, 0x47, 0x01, 0x00,
+    0x01, 0x01, 0x20, 0x01, 0x18, 0x00, 0x00, 0x00, 0x1a, 0xee, 0x1a, 0xee, 0x0b, 0xe1, 0xf1, 0xdd,
+    0x1c, 0x0f, 0xe9, 0x36, 0xf5, 0xea, 0x0c, 0x13, 0xf1, 0x61, 0x14, 0xd4, 0x0a, 0xf7, 0xc0, 0x67,
+    0xec, 0xdf, 0x05, 0xfd, 0xfd, 0x57, 0x05, 0xe4, 0x14, 0x02, 0xf0, 0x50, 0xf6, 0xd6, 0x2c, 0xe3,
+    0xfd, 0x47, 0xee, 0x0b, 0x0d, 0x07, 0x23, 0x5c, 0xfb, 0xf1, 0x16, 0x19, 0x38, 0x61, 0xfa, 0x06,
+    0x35, 0x14, 0x33, 0x4a, 0xe9, 0x05, 0x1a, 0xfd, 0x3a, 0x62, 0xf7, 0x15, 0x20, 0x29, 0x29, 0x41,
+    0x12, 0xe8, 0x00, 0xfe, 0x10, 0x47, 0x0d, 0x00, 0x11, 0x06, 0x0f, 0x5e, 0x30, 0xc7, 0xf6, 0x09,
+    0x36, 0x52, 0x17, 0xd5, 0x08, 0x10, 0x51, 0x38, 0x00, 0xfa, 0x3b, 0x02, 0x3b, 0x48, 0xef, 0xf4,
+    0x20, 0xf2, 0x4f, 0x58, 0xe6, 0x22, 0x1f, 0xd6, 0x3b, 0x65, 0xfb, 0xf5, 0x30, 0xe7, 0x27, 0x3a,
+    0xef, 0x06, 0x1f, 0xe3, 0x2b, 0x22, 0xfc, 0x07, 0x1a, 0xf7, 0x27, 0x36, 0xf9, 0xec, 0x24, 0x05,
+    0x30, 0x37, 0xf2, 0xf6, 0x37, 0x2e, 0x1c, 0x4b, 0x03, 0x00, 0x09, 0x02, 0x0d, 0x55, 0xf5, 0x28,
+    0x15, 0x09, 0x0d, 0x64, 0xf3, 0x1f, 0x22, 0xea, 0xf2, 0x7f, 0xf9, 0x03, 0x26, 0xe1, 0x04, 0x75,
+    0xeb, 0xf3, 0x12, 0xe2, 0x11, 0x3a, 0xee, 0x07, 0x13, 0xc6, 0x19, 0x39, 0x05, 0x12, 0x22, 0xe7,
+    0xfe, 0x51, 0x00, 0x0a, 0x39, 0xdb, 0x11, 0x4f, 0x02, 0x11, 0x01, 0xf2, 0x07, 0x44, 0xfa, 0x03,
+    0x0f, 0xef, 0xfd, 0x5c, 0xfe, 0xe9, 0x0a, 0xf8, 0x21, 0x49, 0x05, 0xd6, 0x1a, 0xf9, 0x15, 0x6b,
+    0x18, 0xd0, 0xfb, 0x28, 0x03, 0x65, 0xfc, 0xeb, 0x20, 0x14, 0x1b, 0x66, 0x09, 0x00, 0x17, 0x00,
+    0xf4, 0x5b, 0xfa, 0x09, 0x2b, 0x05, 0xfe, 0x70, 0x05, 0xf7, 0x3f, 0x22, 0xf9, 0x62, 0x0a, 0x0f,
+    0x2b, 0x13, 0x0b, 0x6e, 0xfb, 0xf6, 0x1c, 0xe7, 0x0a, 0x5e, 0x09, 0x05, 0x11, 0x26, 0x0a, 0x58,
+    0xf9, 0xfc, 0x1f, 0x3c, 0x14, 0x36, 0x02, 0xfa, 0x16, 0x30, 0xfe, 0x52, 0x04, 0xfa, 0x25, 0x18,
+    0xfd, 0x23, 0x0c, 0x04, 0x35, 0x1e, 0x00, 0x11, 0x34, 0x06, 0xee, 0xcc, 0xe3, 0xff, 0xd3, 0xfb,
+    0xf5, 0x2e, 0xf2, 0x12, 0xc8, 0x04, 0xf0, 0x23, 0x1f, 0x1c, 0xd9, 0xf4, 0x02, 0x14, 0x04, 0x41,
+    0x20, 0x02, 0x07, 0x0a, 0x15, 0x34, 0x31, 0x16, 0x05, 0x17, 0x01, 0x43, 0xfd, 0xe2, 0x00, 0x2c,
+    0x0a, 0x2e, 0xe5, 0xf1, 0x05, 0xfd, 0xef, 0x17, 0x02, 0xf6, 0xf3, 0xf5, 0x09, 0x2e, 0x5e, 0x02,
+    0xee, 0x09, 0x13, 0x03, 0x2a, 0x02, 0x51, 0x09, 0x0d, 0xad, 0x30, 0x11, 0xda, 0xfe, 0x16, 0xa6,
+    0xdb, 0x0b, 0x0a, 0x0b, 0x08, 0xde, 0xb9, 0xf0, 0x7f, 0xee, 0x14, 0x16, 0xcf, 0x0f, 0x3b, 0x18,
+    0xe0, 0x42, 0x0d, 0x00, 0xe2, 0x0c, 0xef, 0x4c, 0x43, 0xf2, 0x3e, 0x03, 0xf6, 0x10, 0x36, 0xf8,
+    0xdc, 0xfd, 0xe1, 0xef, 0x07, 0xe7, 0x00, 0x08, 0x0b, 0xbf, 0xc7, 0xfa, 0xf9, 0x14, 0x1a, 0xf3,
+    0xce, 0xf9, 0x1b, 0xf7, 0x27, 0x1b, 0x27, 0xec, 0xee, 0xf7, 0x2b, 0x42, 0x30, 0xf9, 0x79, 0xe8,
+    0x07, 0x2a, 0x20, 0xfd, 0xe8, 0x07, 0x14, 0xf7, 0xf2, 0xf5, 0xfa, 0xec, 0x0c, 0xaf, 0xd0, 0x0e,
+    0xf5, 0xe3, 0xf0, 0xc4, 0xbf, 0xf3, 0xf5, 0xdb, 0x31, 0xd9, 0xee, 0xff, 0xec, 0xe8, 0x11, 0x09,
+    0x11, 0x25, 0xe1, 0xdb, 0x1c, 0x29, 0x04, 0xe1, 0xff, 0xd6, 0x08, 0x57, 0x0a, 0x13, 0x00, 0xf6,
+    0x15, 0x2c, 0x19, 0x00, 0x01, 0x03, 0xf4, 0x34, 0x24, 0xf2, 0xf5, 0x13, 0x14, 0x0b, 0x27, 0xf8,
+    0xff, 0x00, 0xf8, 0xc9, 0x10, 0xef, 0xe3, 0xdb, 0xfa, 0xc9, 0xee, 0x31, 0xe4, 0x1b, 0x1a, 0xad,
+    0xf7, 0xe1, 0xef, 0x08, 0x08, 0xc8, 0x38, 0xe4, 0x42, 0xed, 0x0f, 0xe5, 0xa7, 0x17, 0xde, 0x17,
+    0xef, 0xed, 0xad, 0x02, 0xd0, 0x17, 0xf7, 0x21, 0xd9, 0xf8, 0xd6, 0x06, 0x03, 0x1b, 0x26, 0xd9,
+    0xf5, 0xe4, 0x17, 0x2a, 0x2a, 0x01, 0xf1, 0x09, 0x0d, 0x16, 0xde, 0xed, 0xed, 0x11, 0x19, 0x19,
+    0xee, 0xe4, 0x4c, 0xf9, 0xe5, 0x39, 0x2a, 0x37, 0xde, 0xfd, 0x0d, 0x21, 0x42, 0x2f, 0x0f, 0x04,
+    0x0d, 0x24, 0x20, 0xf7, 0x19, 0xf3, 0x08, 0x03, 0x46, 0xea, 0x0d, 0xfe, 0xf0, 0xa6, 0x66, 0xdf,
+    0x0c, 0xe9, 0xe8, 0x81, 0x2b, 0x15, 0x10, 0x0a, 0xe8, 0x90, 0xf3, 0xf2, 0x0e, 0x0f, 0xb5, 0xb8,
+    0xaa, 0xf8, 0x14, 0xe3, 0xf3, 0xe7, 0xcd, 0xfa, 0x0f, 0xfb, 0xd7, 0x09, 0xf0, 0x00, 0x4e, 0xde,
+    0xcb, 0x41, 0xfb, 0x04, 0x34, 0x01, 0xa9, 0x2d, 0xff, 0xfd, 0x00, 0x07, 0xd1, 0x3d, 0x04, 0xfd,
+    0x0c, 0x0c, 0xd8, 0x5b, 0x10, 0x09, 0x0a, 0xe2, 0xf4, 0x38, 0x1d, 0x08, 0x16, 0x00, 0x0f, 0x1f,
+    0x61, 0xf9, 0xfd, 0x21, 0xf8, 0xf0, 0x4c, 0x0f, 0x2a, 0x19, 0xe3, 0xcf, 0x0c, 0x17, 0x0a, 0x07,
+    0x06, 0xc1, 0xdc, 0x00, 0xea, 0x0a, 0xfd, 0xd4, 0x04, 0xf9, 0x41, 0x11, 0xf2, 0x2d, 0xfa, 0xfe,
+    0x4a, 0x0c, 0x08, 0x35, 0x14, 0x07, 0xf2, 0x07, 0xfe, 0x42, 0x6f, 0x0e, 0x33, 0x15, 0x00, 0x0e,
+    0x5a, 0xf4, 0x72, 0xdf, 0x1b, 0xea, 0x05, 0xfc, 0x2e, 0xec, 0xff, 0xb7, 0x06, 0xf0, 0x05, 0xef,
+    0xfe, 0x9d, 0xbb, 0x13, 0x17, 0xd1, 0x04, 0xcc, 0x9a, 0x15, 0x3b, 0x0b, 0xfd, 0x00, 0xbb, 0x08,
+    0x5c, 0x0d, 0xea, 0x40, 0x02, 0x16, 0xed, 0x13, 0xec, 0x41, 0x37, 0x08, 0x07, 0x1b, 0xfb, 0x21,
+    0x0a, 0x00, 0x09, 0x1e, 0xf0, 0xf1, 0xa4, 0x02, 0x11, 0x3b, 0xf5, 0xe5, 0x9c, 0x0a, 0x11, 0x21,
+    0x2d, 0xfc, 0xe0, 0x06, 0x06, 0x1b, 0x16, 0x2a, 0xfd, 0x04, 0x0d, 0x23, 0x0e, 0x40, 0x53, 0xe0,
+    0x24, 0x0c, 0xf4, 0x04, 0x43, 0x21, 0x13, 0x02, 0xd3, 0xf9, 0x1d, 0x01, 0x05, 0x0b, 0xf4, 0xd3,
+    0xef, 0xfe, 0xf7, 0x03, 0xe0, 0xc4, 0xa3, 0xfd, 0xd8, 0x22, 0xd4, 0xd7, 0xc0, 0x29, 0xc8, 0x20,
+    0xef, 0xf2, 0x25, 0x00, 0xc1, 0x38, 0xdd, 0x16, 0x54, 0x23, 0xb1, 0x1b, 0xc2, 0x1b, 0xbd, 0xf8,
+    0x01, 0x27, 0xf9, 0x0a, 0xb2, 0xfb, 0xf9, 0x18, 0xd0, 0x1b, 0xf6, 0x10, 0x04, 0x05, 0x00, 0x37,
+    0x25, 0x16, 0x0f, 0xc9, 0xf1, 0x47, 0x47, 0x05, 0x0c, 0xfd, 0xee, 0x37, 0x11, 0x10, 0xe4, 0x00,
+    0x13, 0xff, 0xd6, 0x02, 0xea, 0x10, 0xfb, 0xdc, 0x07, 0x04, 0xa6, 0xcf, 0xcb, 0x59, 0x2c, 0x1c,
+    0xbd, 0xe1, 0xc7, 0xe0, 0x16, 0xd8, 0xde, 0xe8, 0xf3, 0x07, 0xe3, 0xdf, 0xf3, 0xb5, 0xf2, 0x27,
+    0x26, 0xc4, 0xda, 0xf1, 0xec, 0xf2, 0x0b, 0xf8, 0xb5, 0x1f, 0x06, 0x1f, 0xf5, 0x1c, 0xcd, 0x0c,
+    0xcd, 0x40, 0x25, 0x10, 0xee, 0x09, 0xc1, 0xf5, 0xf4, 0x3d, 0xa5, 0xe7, 0xa3, 0x6b, 0xfc, 0xf5,
+    0xff, 0x0f, 0x1d, 0x7f, 0x23, 0x19, 0xb6, 0x2b, 0xd2, 0x1a, 0x2e, 0x18, 0xe9, 0xde, 0x3a, 0x2a,
+    0x1a, 0xec, 0xff, 0x23, 0x14, 0x47, 0x20, 0xd0, 0xf3, 0x1a, 0x1b, 0x3d, 0xff, 0xf0, 0x0e, 0x47,
+    0xe3, 0x00, 0x03, 0xf5, 0xe1, 0x1d, 0xe4, 0x50, 0x1c, 0xc9, 0xe7, 0x2f, 0xdc, 0x11, 0xf5, 0x0e,
+    0xd0, 0x28, 0xe0, 0x2a, 0x0b, 0xf9, 0xfe, 0x3b, 0xf6, 0x21, 0x14, 0xf8, 0xce, 0x10, 0xe6, 0x22,
+    0x2b, 0x2e, 0xec, 0xe6, 0xdc, 0x5a, 0xf4, 0xfb, 0x03, 0x34, 0xf0, 0x2d, 0xd8, 0xf8, 0xdf, 0xef,
+    0xbe, 0x28, 0xfb, 0xfc, 0xd5, 0x2c, 0x04, 0x0b, 0xfc, 0xac, 0xf6, 0x1b, 0xf4, 0x1d, 0xd9, 0x1d,
+    0xca, 0x14, 0xeb, 0x29, 0xea, 0xe7, 0xdd, 0x31, 0x2d, 0x42, 0xec, 0x0f, 0xb4, 0x17, 0x0c, 0x1c,
+    0xf1, 0x14, 0xb7, 0xf2, 0xc4, 0x26, 0xd8, 0x11, 0x13, 0xf4, 0xec, 0x38, 0x15, 0x19, 0xd2, 0x24,
+    0xfb, 0x1f, 0x16, 0x09, 0xb4, 0x1c, 0xdf, 0x2a, 0x29, 0x04, 0x00, 0x0a, 0x09, 0x16, 0xd0, 0x42,
+    0xcd, 0x17, 0xde, 0x10, 0x19, 0xe7, 0xb9, 0x03, 0xed, 0xf9, 0xfd, 0x10, 0xce, 0x39, 0xd6, 0xec,
+    0x0a, 0xe7, 0xb0, 0xec, 0xcf, 0x7b, 0xef, 0x18, 0xc9, 0xfe, 0x05, 0x2e, 0x0d, 0x0b, 0xd6, 0xe4,
+    0xed, 0x15, 0x37, 0x1b, 0xc4, 0x38, 0xfb, 0x5a, 0x47, 0xf1, 0xc7, 0xe3, 0x1f, 0x2e, 0xf6, 0x4d,
+    0xc2, 0x0e, 0x11, 0x1c, 0x0d, 0x1f, 0xcd, 0x01, 0x3e, 0x36, 0x17, 0xfb, 0xd4, 0x25, 0x1f, 0x29,
+    0x21, 0x28, 0xd7, 0xc6, 0xd5, 0x26, 0x20, 0x14, 0xd7, 0x0f, 0x12, 0xfc, 0x28, 0x1b, 0x04, 0xec,
+    0x0b, 0x20, 0x47, 0xf4, 0x0d, 0xb2, 0x4c, 0xd7, 0xd8, 0xf4, 0x93, 0xbe, 0xac, 0x25, 0x26, 0xe5,
+    0x27, 0x62, 0xf4, 0xe1, 0xf4, 0x99, 0xf5, 0x44, 0xb6, 0xfd, 0x01, 0xae, 0xe4, 0xde, 0xd5, 0xf2,
+    0xf7, 0xb9, 0xd8, 0x0a, 0xab, 0xb8, 0xc4, 0x04, 0xb5, 0x1f, 0xa4, 0x07, 0xed, 0x38, 0xe0, 0x2c,
+    0x06, 0xe9, 0x26, 0x16, 0xb3, 0x2b, 0x8a, 0x1c, 0x19, 0x18, 0xe7, 0xe9, 0xbb, 0x04, 0x1e, 0xf7,
+    0xc6, 0x1a, 0x1c, 0x14, 0x08, 0x03, 0x4b, 0x0f, 0x02, 0x2b, 0xf4, 0xf8, 0xd6, 0x34, 0x1e, 0x39,
+    0xfe, 0xf7, 0xe7, 0x39, 0xce, 0x59, 0xf7, 0xf9, 0xe6, 0x22, 0x0e, 0x1f, 0xf2, 0xdb, 0x3e, 0x24,
+    0xf5, 0x09, 0x18, 0xe5, 0xe0, 0x12, 0xb6, 0xf3, 0x3b, 0x15, 0x07, 0x1a, 0xc5, 0x23, 0x61, 0x0f,
+    0x06, 0x36, 0xcc, 0x2f, 0x60, 0xf6, 0x3b, 0x16, 0xd3, 0x14, 0x42, 0x1c, 0x08, 0xe6, 0xf3, 0xe4,
+    0x21, 0xfb, 0x08, 0xdc, 0xea, 0xd6, 0xd2, 0x2b, 0xdf, 0xec, 0xf9, 0xfd, 0xdf, 0xfa, 0xde, 0x07,
+    0xd8, 0xea, 0x0a, 0xff, 0x25, 0x27, 0xf0, 0xfb, 0xfc, 0xec, 0xf6, 0x14, 0xcb, 0xe0, 0xd4, 0xcc,
+    0x27, 0xe5, 0xf0, 0x1e, 0x0e, 0xb9, 0xe6, 0xe5, 0x0d, 0x07, 0x12, 0x97, 0xec, 0xdd, 0xbe, 0xe9,
+    0xfa, 0xb5, 0xaa, 0xd8, 0xc6, 0xfb, 0xce, 0x0a, 0x3b, 0xb7, 0xd1, 0xd6, 0x09, 0x15, 0x09, 0xba,
+    0xcb, 0xe5, 0xfd, 0xf7, 0xe9, 0xc7, 0x86, 0xfe, 0x36, 0xf4, 0xef, 0xbd, 0xc1, 0xd7, 0x04, 0xf6,
+    0x24, 0x07, 0xa2, 0xee, 0x27, 0xed, 0xe0, 0xd7, 0xaf, 0x16, 0x08, 0xe9, 0xf1, 0xc0, 0x88, 0xeb,
+    0xf2, 0xee, 0x01, 0xfa, 0x8b, 0xef, 0xe3, 0x2d, 0x34, 0x1d, 0xa0, 0xed, 0xe0, 0xcc, 0xf6, 0x14,
+    0x8c, 0x0b, 0xfe, 0x1b, 0xdc, 0x1b, 0xdd, 0x41, 0x04, 0xc6, 0xe4, 0xda, 0xf3, 0xef, 0x1b, 0xd8,
+    0x40, 0xd6, 0x1c, 0x3a, 0x0d, 0x81, 0xf6, 0xd6, 0x65, 0x11, 0x0c, 0x8b, 0xd4, 0x32, 0x2e, 0xfe,
+    0xe7, 0xbe, 0xf8, 0x06, 0x8c, 0x2e, 0xdc, 0xdc, 0xef, 0xdd, 0xe9, 0xe0, 0xf8, 0xb6, 0x7b, 0xd8,
+    0xde, 0x2f, 0x0c, 0x9f, 0x4f, 0xe2, 0x1f, 0x1f, 0x0d, 0xfe, 0x35, 0x1c, 0x2d, 0xe2, 0xe4, 0xda,
+    0x37, 0xfd, 0xdb, 0x06, 0xf6, 0x01, 0x32, 0xee, 0xc1, 0xf1, 0xe7, 0xfb, 0x1b, 0xe4, 0xe1, 0xf5,
+    0xe0, 0xe5, 0x32, 0x03, 0xe9, 0xd7, 0xdd, 0x16, 0x2a, 0xda, 0xf4, 0xce, 0xf4, 0xed, 0x2c, 0xce,
+    0x08, 0xb8, 0xd1, 0x00, 0x1c, 0x06, 0x00, 0xc2, 0xe1, 0xf9, 0x27, 0x0a, 0x28, 0xaa, 0x0e, 0x27,
+    0x22, 0xf3, 0x00, 0x81, 0xfb, 0x12, 0x20, 0xf9, 0x2b, 0xc9, 0x0d, 0x12, 0x2c, 0x1e, 0xdc, 0xcc,
+    0x03, 0xe8, 0x11, 0x11, 0x06, 0xd5, 0x09, 0xe2, 0x0d, 0xf6, 0x0b, 0xc8, 0xfd, 0xfc, 0x26, 0xef,
+    0x1b, 0xc3, 0xf1, 0x08, 0x23, 0xf7, 0x1e, 0xac, 0xd2, 0xfc, 0x4f, 0xfd, 0x26, 0xc5, 0xf2, 0x03,
+    0x1a, 0xf0, 0x40, 0xa0, 0xf8, 0xfc, 0x19, 0xeb, 0x2c, 0xad, 0x08, 0xf1, 0x24, 0xec, 0x19, 0xb7,
+    0x1f, 0x0d, 0x4e, 0xf4, 0x12, 0xa8, 0xf7, 0xf6, 0x23, 0x0e, 0xfd, 0x97, 0x01, 0x12, 0x25, 0x08,
+    0x1c, 0x8f, 0xeb, 0xfd, 0x29, 0xf8, 0xf8, 0xb2, 0x0b, 0x05, 0x33, 0xf0, 0xe2, 0xce, 0x15, 0xf9,
+    0x2c, 0xfc, 0x09, 0xb0, 0x0a, 0x0e, 0x21, 0x00, 0xe1, 0xcf, 0x1d, 0x0b, 0x21, 0xfd, 0xfb, 0xcd,
+    0x00, 0xee, 0x2f, 0x2a, 0x18, 0xc6, 0x05, 0xec, 0x3b, 0xf9, 0x12, 0xb4, 0x04, 0xef, 0x28, 0x07,
+    0xff, 0xce, 0xf9, 0x0a, 0x1a, 0x11, 0x03, 0x93, 0xf5, 0x04, 0x10, 0x1e, 0xce, 0xa8, 0x16, 0xff,
+    0x20, 0x1d, 0xd7, 0xb3, 0x27, 0xf4, 0x2e, 0x1a, 0xfb, 0xe6, 0x19, 0xee, 0x2f, 0xfc, 0xdf, 0xe5,
+    0x0d, 0x0c, 0x20, 0x1c, 0xf6, 0xdd, 0x12, 0xfa, 0x25, 0x2a, 0xee, 0xdd, 0x07, 0xf2, 0x27, 0x27,
+    0x17, 0x12, 0xf5, 0x04, 0x3b, 0x04, 0x0d, 0xc5, 0x0a, 0xea, 0x23, 0x0c, 0xfe, 0xdd, 0x08, 0x05,
+    0x2f, 0x08, 0xe6, 0xbe, 0xf5, 0xfa, 0x31, 0x08, 0xea, 0xb2, 0xe5, 0xfe, 0x25, 0x05, 0x02, 0xc7,
+    0x01, 0x08, 0x35, 0x4d, 0x2e, 0xce, 0xdd, 0xc4, 0x20, 0x14, 0xd9, 0x09, 0xe9, 0xd8, 0x21, 0x2a,
+    0xf3, 0x02, 0x1d, 0xc2, 0x1f, 0x31, 0xdf, 0x37, 0xfb, 0x00, 0x07, 0x3a, 0x0c, 0xd3, 0xe9, 0x04,
+    0x06, 0x1d, 0x0b, 0x07, 0xe4, 0x27, 0x15, 0x05, 0xd7, 0x06, 0x00, 0x1d, 0x17, 0x3f, 0xd5, 0x0c,
+    0xef, 0x18, 0x3c, 0x35, 0xe0, 0x1a, 0x06, 0x22, 0x41, 0xf6, 0xea, 0x26, 0xf5, 0x07, 0x3f, 0xe9,
+    0xfb, 0x0b, 0x08, 0xe3, 0x4b, 0x0b, 0x29, 0x4b, 0x1c, 0xd7, 0x4c, 0x26, 0x12, 0x28, 0xf5, 0xf1,
+    0x1c, 0x02, 0xf5, 0x2d, 0xe8, 0x00, 0x36, 0x0a, 0xf2, 0x4a, 0xf5, 0xd4, 0x31, 0x2f, 0xdd, 0x52,
+    0xe4, 0x10, 0x20, 0x19, 0xd3, 0x1d, 0x0a, 0x13, 0x36, 0x3a, 0xd1, 0x35, 0xf3, 0x3b, 0x2c, 0x11,
+    0xf6, 0x30, 0x06, 0x2b, 0x67, 0x03, 0xfd, 0x2a, 0xf3, 0x26, 0x1c, 0x0b, 0xfc, 0x3c, 0x00, 0xe8,
+    0x28, 0xd0, 0x1d, 0x20, 0xf3, 0x0b, 0x4d, 0xd7, 0xf0, 0x3b, 0xf7, 0xff, 0x01, 0xee, 0xf3, 0x15,
+    0xfb, 0x10, 0x00, 0x12, 0x13, 0x16, 0xf5, 0x0b, 0x01, 0xeb, 0xee, 0x2d, 0xf5, 0xf4, 0x0a, 0xdb,
+    0x22, 0x2c, 0xfe, 0xff, 0x0f, 0xdd, 0x13, 0x2b, 0xfb, 0x3a, 0x1a, 0xe2, 0x0c, 0x53, 0xe3, 0x18,
+    0x12, 0xd3, 0x22, 0x44, 0xd6, 0x03, 0x20, 0xf6, 0x10, 0x34, 0xe4, 0x1e, 0x10, 0xd8, 0x1b, 0x1b,
+    0x1b, 0x0a, 0x10, 0x00, 0x35, 0x1b, 0x10, 0xfb, 0x0e, 0xde, 0x28, 0x20, 0x10, 0xf8, 0x12, 0xed,
+    0xf9, 0x39, 0x02, 0xdf, 0x28, 0xe4, 0x31, 0x52, 0xf2, 0x17, 0x3e, 0xea, 0x29, 0x34, 0xe6, 0xf4,
+    0x0f, 0xdf, 0x38, 0x32, 0xe2, 0x0f, 0x23, 0xd4, 0x36, 0x2f, 0xe3, 0x02, 0x3d, 0xe4, 0x0f, 0x0b,
+    0xef, 0x27, 0x5c, 0x08, 0x1f, 0xf2, 0xfe, 0x21, 0x49, 0x1d, 0xf6, 0xdd, 0xfe, 0x2e, 0x3d, 0xf7,
+    0xf1, 0x0d, 0x14, 0x04, 0x27, 0xe3, 0x03, 0x11, 0x07, 0x29, 0x25, 0x16, 0x19, 0x35, 0x01, 0x09,
+    0x4c, 0x18, 0x06, 0x2d, 0x05, 0x1c, 0x26, 0xf0, 0xd8, 0x0c, 0xdb, 0x00, 0x21, 0x03, 0xf1, 0xfa,
+    0x06, 0xec, 0x06, 0x33, 0x05, 0xcb, 0x1c, 0x0c, 0xfa, 0x1b, 0xc8, 0xe5, 0x30, 0xfb, 0xf2, 0x2f,
+    0xb9, 0xc1, 0x3f, 0x1a, 0xf1, 0x39, 0x81, 0xc7, 0x2e, 0xf5, 0x66, 0x02, 0x5f, 0xf6, 0x24, 0x0d,
+    0x3a, 0xfa, 0x2d, 0xec, 0x23, 0xe3, 0x63, 0xed, 0x0f, 0xe7, 0x31, 0xfd, 0x55, 0xe9, 0x05, 0xd8,
+    0x1f, 0xee, 0x5e, 0x1d, 0x30, 0xe7, 0x26, 0x0c, 0x60, 0xf2, 0x1e, 0xdb, 0x1f, 0xd9, 0x3f, 0xf4,
+    0x11, 0xe5, 0x25, 0x0f, 0x41, 0xf4, 0x19, 0xf5, 0x05, 0x21, 0x14, 0x19, 0x2c, 0xd8, 0x2b, 0x04,
+    0x25, 0xe8, 0x0f, 0x1d, 0x07, 0xd5, 0xf0, 0x0a, 0x21, 0x29, 0xeb, 0xfc, 0xe8, 0x03, 0x18, 0x0a,
+    0xed, 0xec, 0xe2, 0xc9, 0x39, 0xdd, 0xe8, 0x02, 0xd7, 0x04, 0xff, 0xce, 0x08, 0xf8, 0xe9, 0xfa,
+    0x39, 0xca, 0x0b, 0xff, 0xe8, 0x1f, 0x25, 0xbd, 0x26, 0x05, 0xdb, 0x0b, 0x2a, 0xea, 0x0e, 0x16,
+    0xe3, 0xf7, 0x1a, 0x16, 0xfb, 0x1e, 0xf9, 0x07, 0xdf, 0x4b, 0xfc, 0x0f, 0x18, 0xfa, 0xff, 0x22,
+    0xfe, 0xfc, 0x50, 0x18, 0xec, 0xe9, 0xc2, 0xd1, 0x2a, 0xfd, 0xda, 0xb8, 0xfe, 0xd5, 0x7f, 0x1c,
+    0x08, 0xcd, 0xf0, 0xd4, 0x5c, 0x19, 0xf4, 0xd6, 0xff, 0xf9, 0x5c, 0x07, 0x09, 0x1a, 0x16, 0xfe,
+    0x52, 0xdd, 0x0f, 0xfd, 0xe0, 0x2c, 0x65, 0xe6, 0xea, 0xff, 0xf7, 0x0e, 0x60, 0xef, 0x10, 0xf0,
+    0xd3, 0x27, 0x64, 0x1d, 0x26, 0xd1, 0xfa, 0x0e, 0x64, 0xfe, 0x0d, 0xdf, 0xfa, 0x05, 0x59, 0x21,
+    0xdb, 0xdf, 0xf8, 0x0e, 0x52, 0xdd, 0x1a, 0xe7, 0x03, 0xfb, 0x08, 0x37, 0xfc, 0xfb, 0xf4, 0xe8,
+    0x39, 0x2d, 0xe8, 0xfd, 0xef, 0xff, 0xf9, 0x26, 0x1c, 0x23, 0xe4, 0x1c, 0xfe, 0xd7, 0x05, 0x2c,
+    0xe9, 0xd1, 0xf1, 0x13, 0x2c, 0xd2, 0xf1, 0xeb, 0xe3, 0x04, 0x46, 0xc1, 0x01, 0xdf, 0xdf, 0xfd,
+    0x1c, 0xeb, 0xfd, 0xe7, 0xea, 0xf8, 0x11, 0xd5, 0x10, 0xfb, 0xea, 0x18, 0x1a, 0xce, 0x26, 0xfb,
+    0xf3, 0x0e, 0x1a, 0xd5, 0xff, 0xf6, 0xff, 0x06, 0x02, 0xec, 0x2a, 0x43, 0x14, 0xeb, 0x1b, 0xf8,
+    0x24, 0xfb, 0x2e, 0x11, 0x74, 0xce, 0xfd, 0x13, 0x2c, 0xde, 0x36, 0x0c, 0xfa, 0x0b, 0x53, 0xe7,
+    0x35, 0xdd, 0x09, 0x17, 0x33, 0xd8, 0x1d, 0xff, 0x4a, 0x10, 0x70, 0xf1, 0x2f, 0xec, 0x04, 0xec,
+    0x34, 0x0f, 0x20, 0x59, 0xed, 0xf6, 0x39, 0xfc, 0x07, 0x4b, 0x11, 0x2e, 0x47, 0x07, 0x0a, 0x6f,
+    0xe9, 0x04, 0x41, 0x0c, 0x34, 0x3f, 0xeb, 0xf9, 0x44, 0xd3, 0x2e, 0x42, 0xef, 0x00, 0x45, 0xb0,
+    0x24, 0x31, 0xf1, 0x07, 0x5e, 0xe6, 0x54, 0x47, 0x09, 0x18, 0x29, 0xf6, 0x21, 0xf7, 0xdf, 0x15,
+    0x4d, 0xf6, 0x2c, 0xec, 0x1f, 0x14, 0x51, 0x09, 0x2b, 0x29, 0xfb, 0x05, 0x1a, 0x0f, 0x1f, 0x4d,
+    0x12, 0xd7, 0x1e, 0xe3, 0x48, 0x20, 0x0b, 0xfd, 0x5a, 0xe5, 0x33, 0x43, 0x12, 0xe7, 0x0b, 0xfd,
+    0x1f, 0x48, 0xea, 0x16, 0x22, 0xce, 0x11, 0x18, 0x02, 0x13, 0x1e, 0x18, 0x10, 0x38, 0xf5, 0xfb,
+    0x04, 0xd0, 0x07, 0x11, 0xe2, 0x20, 0xe3, 0xf7, 0xf1, 0x38, 0x27, 0x09, 0xe0, 0x15, 0x0c, 0x3c,
+    0xf0, 0xdf, 0xec, 0x35, 0x19, 0x27, 0xfe, 0xf7, 0x1c, 0x0c, 0x08, 0xf8, 0xed, 0xe6, 0x23, 0x19,
+    0x34, 0x3a, 0x01, 0xec, 0x4d, 0xdb, 0x01, 0x3e, 0xdb, 0x4d, 0x3e, 0xfc, 0x0d, 0x4e, 0x0c, 0xe4,
+    0x30, 0xf1, 0xe1, 0x56, 0xd5, 0x09, 0x60, 0x16, 0xc8, 0x3d, 0xfa, 0x09, 0x41, 0x19, 0xe5, 0x3a,
+    0xe4, 0xee, 0x6c, 0x19, 0x2d, 0x3d, 0xf3, 0xf0, 0x72, 0x06, 0x0c, 0x4e, 0xf9, 0x08, 0x09, 0x26,
+    0xd4, 0x7d, 0xde, 0xec, 0x19, 0xf4, 0xf4, 0x31, 0xf5, 0xe2, 0x32, 0x36, 0xec, 0x50, 0xf7, 0x01,
+    0x59, 0x54, 0xf0, 0x22, 0x13, 0x01, 0x4a, 0x3d, 0x1c, 0x4d, 0xfb, 0x06, 0x61, 0x20, 0xe4, 0x7f,
+    0xfa, 0xf4, 0x43, 0x70, 0x15, 0x60, 0x16, 0xf8, 0x13, 0x4d, 0xe5, 0x7d, 0xea, 0xeb, 0x18, 0x10,
+    0xe4, 0x70, 0xe0, 0xfd, 0xf8, 0x21, 0xe6, 0x52, 0xf6, 0x02, 0xff, 0x67, 0xea, 0x5f, 0xeb, 0xd2,
+    0xff, 0x49, 0x01, 0x6d, 0xea, 0x17, 0xe3, 0x2f, 0xb7, 0x64, 0xe0, 0x22, 0xf4, 0x21, 0xd8, 0x35,
+    0xde, 0x1b, 0xfc, 0x49, 0x3c, 0x35, 0xdc, 0x3e, 0x0b, 0x15, 0xc1, 0x4e, 0xc6, 0x41, 0xe5, 0x03,
+    0xbb, 0x14, 0x92, 0x57, 0x36, 0x36, 0xb0, 0x32, 0x08, 0xd8, 0xf0, 0xdf, 0x05, 0x38, 0x0b, 0xf4,
+    0xea, 0xe4, 0x0a, 0x03, 0x0a, 0xe7, 0x16, 0xf3, 0x0f, 0xfc, 0xf4, 0xf3, 0xf6, 0xdf, 0x18, 0xed,
+    0x1d, 0xf0, 0xfe, 0xda, 0x1e, 0xee, 0xf4, 0xed, 0xfb, 0xdd, 0x13, 0xec, 0xfc, 0x08, 0xf9, 0xfe,
+    0x02, 0xdc, 0x03, 0x20, 0x09, 0xeb, 0xe0, 0xc6, 0xfa, 0x0c, 0xf2, 0xe0, 0xee, 0xe1, 0x03, 0x20,
+    0x04, 0xea, 0xfd, 0xeb, 0xfb, 0x19, 0x01, 0x06, 0x08, 0x03, 0xe2, 0x14, 0xfd, 0x0f, 0x08, 0x21,
+    0xfd, 0x11, 0x23, 0x2a, 0x08, 0x3b, 0x0f, 0x18, 0xec, 0x1b, 0xfb, 0x37, 0x16, 0x09, 0x06, 0x23,
+    0x13, 0x1b, 0x02, 0x02, 0xfd, 0x19, 0x13, 0xfe, 0x08, 0xfc, 0xfa, 0x09, 0x2b, 0xf3, 0x02, 0x01,
+    0x05, 0x00, 0x11, 0xf4, 0x03, 0xf5, 0xf9, 0x0a, 0x0f, 0xde, 0x03, 0xee, 0x15, 0x04, 0xf4, 0xd2,
+    0x0d, 0xee, 0xeb, 0x00, 0x03, 0xef, 0xd5, 0xef, 0x44, 0xf7, 0xfb, 0xf1, 0xdc, 0xd0, 0xde, 0xed,
+    0xda, 0xe5, 0xfd, 0xc6, 0x00, 0x00, 0xf0, 0xe7, 0xf9, 0xc3, 0x42, 0x10, 0xfa, 0xdc, 0xdf, 0xc1,
+    0xc9, 0xec, 0xdf, 0xd3, 0xd7, 0xdb, 0x00, 0x02, 0x15, 0xf3, 0xd6, 0xec, 0xf7, 0xdf, 0xe0, 0x0a,
+    0xc9, 0xeb, 0x7f, 0xe5, 0xf0, 0x2d, 0xfa, 0xef, 0xe8, 0xf1, 0xff, 0x17, 0x02, 0x03, 0xe6, 0xf0,
+    0xec, 0x05, 0xec, 0xf9, 0x38, 0xe3, 0xd4, 0x04, 0x06, 0xfc, 0xee, 0xe1, 0xef, 0x0d, 0xfb, 0xfb,
+    0xfd, 0xf9, 0xec, 0x1d, 0x0b, 0xf8, 0xff, 0xf0, 0xe1, 0x16, 0x3d, 0xf6, 0x03, 0x21, 0xed, 0xfc,
+    0x3a, 0x06, 0x00, 0xf6, 0xef, 0xfd, 0x0f, 0x09, 0x14, 0xe8, 0xe3, 0xde, 0xf6, 0x16, 0x07, 0x06,
+    0xf1, 0xd9, 0x1b, 0xf2, 0x04, 0x0d, 0xdf, 0xeb, 0x2d, 0xfc, 0x06, 0xf3, 0xd0, 0xd7, 0x03, 0x02,
+    0xfc, 0xe5, 0xdb, 0xc3, 0xfe, 0x07, 0x0e, 0xf7, 0xef, 0xd3, 0x06, 0x0d, 0xfa, 0xf5, 0xdb, 0xda,
+    0xfc, 0xeb, 0x07, 0xf9, 0xdc, 0xe9, 0xfb, 0x06, 0x08, 0x16, 0x11, 0xe4, 0xff, 0x1b, 0x0f, 0x16,
+    0x10, 0xf8, 0x1b, 0x20, 0x04, 0x08, 0x21, 0xfa, 0x35, 0xdc, 0xf6, 0x29, 0x62, 0xca, 0xd8, 0xe4,
+    0xe1, 0xfa, 0x06, 0xff, 0xf2, 0xf3, 0xf4, 0xf2, 0xfa, 0xde, 0x01, 0x03, 0xde, 0xe6, 0xf6, 0xd6,
+    0xf7, 0xe3, 0xde, 0xfa, 0xf1, 0xf7, 0xf9, 0xec, 0xcb, 0xdf, 0xe2, 0xd2, 0x02, 0xe0, 0xce, 0xd1,
+    0xe9, 0x11, 0xd9, 0xdb, 0xdb, 0xfb, 0x1e, 0xe9, 0xee, 0xe1, 0xdd, 0x15, 0x0d, 0xd7, 0x15, 0x0d,
+    0x08, 0x07, 0x0c, 0xd4, 0xe6, 0xfc, 0x38, 0xdb, 0x13, 0xfa, 0xf1, 0x09, 0x00, 0xf2, 0xc9, 0xf0,
+    0xf9, 0x0c, 0x49, 0xd6, 0xb9, 0xd6, 0x01, 0x00, 0x66, 0xf9, 0xcd, 0xc4, 0x04, 0xe7, 0x6b, 0xec,
+    0xea, 0xe6, 0xe8, 0x03, 0x77, 0xfd, 0xea, 0xde, 0xec, 0x0d, 0x6c, 0xe8, 0xf4, 0xea, 0xcf, 0xc3,
+    0x6c, 0x11, 0x15, 0xfa, 0x16, 0xf6, 0x6c, 0x32, 0xe7, 0xfd, 0xd1, 0xeb, 0x63, 0x1f, 0xff, 0xd5,
+    0xfa, 0x2b, 0x68, 0xfa, 0xdd, 0xac, 0x0a, 0x25, 0x4f, 0xf3, 0xda, 0xca, 0xe5, 0x48, 0x4e, 0x18,
+    0xf5, 0xe8, 0x20, 0x04, 0x12, 0x04, 0xf4, 0xec, 0x01, 0xc7, 0x49, 0xfc, 0xd1, 0x0b, 0xe2, 0xf5,
+    0xf9, 0x1e, 0x1b, 0x23, 0xe2, 0xee, 0xdc, 0x1a, 0xca, 0x03, 0xec, 0xf4, 0xe4, 0x26, 0xed, 0xd5,
+    0xf7, 0x09, 0xdd, 0x5c, 0x07, 0xd3, 0xf8, 0x09, 0xc6, 0x4f, 0x12, 0xe8, 0xe1, 0xf8, 0xca, 0x21,
+    0x12, 0xd2, 0x01, 0xfe, 0xd9, 0xf2, 0x06, 0xf7, 0xeb, 0xff, 0xd0, 0xeb, 0x05, 0xec, 0xf3, 0xe0,
+    0xd8, 0xf6, 0x3c, 0xf2, 0xeb, 0x0a, 0xd6, 0x04, 0x1d, 0xd6, 0xec, 0xe9, 0xe6, 0xd8, 0xfd, 0xd0,
+    0x0e, 0x13, 0xf9, 0x0d, 0x2b, 0xb7, 0x0b, 0x01, 0x23, 0x09, 0x05, 0x07, 0xf3, 0x1c, 0x7d, 0x45,
+    0x31, 0xee, 0x03, 0x1e, 0x60, 0x0e, 0x22, 0x03, 0x0d, 0xf3, 0x74, 0x16, 0x3a, 0x05, 0xd4, 0x0a,
+    0x7a, 0x22, 0x00, 0x06, 0xe0, 0xee, 0x5e, 0xd4, 0xfe, 0xef, 0xe5, 0x00, 0x69, 0xe7, 0x04, 0xe6,
+    0xd4, 0x13, 0x7f, 0x22, 0x21, 0xc7, 0x04, 0xe9, 0x71, 0x0d, 0xeb, 0xde, 0xf0, 0x0a, 0x35, 0xd5,
+    0x05, 0xf3, 0xf0, 0xe9, 0xca, 0xf6, 0xea, 0x0b, 0x12, 0xe6, 0x0c, 0x3d, 0x5d, 0xd2, 0xf8, 0xff,
+    0x02, 0x17, 0x31, 0xee, 0x20, 0x2b, 0x27, 0x00, 0x30, 0xdc, 0x15, 0x4a, 0x33, 0x27, 0x38, 0xbe,
+    0x1b, 0x19, 0x38, 0x32, 0x2f, 0xf8, 0x0b, 0x2b, 0x21, 0xc8, 0x4a, 0xce, 0x0a, 0x1f, 0x3b, 0xe7,
+    0x3c, 0xca, 0xe4, 0x17, 0x36, 0x04, 0x7f, 0xd5, 0x01, 0x42, 0x63, 0x25, 0x57, 0xa8, 0xea, 0x38,
+    0x7d, 0xe6, 0x13, 0xbe, 0x07, 0x12, 0x2f, 0xee, 0x19, 0xef, 0xee, 0xfb, 0x16, 0x03, 0xe0, 0xfa,
+    0xff, 0xf3, 0x22, 0xfa, 0x15, 0xe0, 0xee, 0xc6, 0x4f, 0xe9, 0xea, 0xc5, 0x0f, 0xb5, 0x4f, 0xdf,
+    0xf8, 0xbf, 0xe7, 0xcb, 0x19, 0xe7, 0xee, 0xb5, 0xfb, 0xc1, 0x35, 0xe6, 0xc7, 0xe0, 0xf6, 0xa2,
+    0x58, 0xd8, 0x02, 0xbf, 0xfe, 0xba, 0x13, 0xf1, 0xf7, 0xd4, 0xfd, 0xd4, 0x1a, 0xf2, 0xeb, 0xe4,
+    0x2a, 0xc9, 0x13, 0x2a, 0xdf, 0xbf, 0x0e, 0xdd, 0xf9, 0xe9, 0xd1, 0xcb, 0x2b, 0xdb, 0xf7, 0x10,
+    0xfa, 0xbc, 0x04, 0xc1, 0xfa, 0xe4, 0xec, 0xda, 0x0e, 0x0c, 0xf6, 0xc5, 0xca, 0xf5, 0x0a, 0x0d,
+    0xf9, 0xe4, 0xe6, 0xd6, 0x10, 0xfd, 0x17, 0x04, 0xba, 0xdd, 0x10, 0x34, 0x3c, 0xcf, 0xe9, 0xcf,
+    0x10, 0x68, 0x1d, 0x14, 0x09, 0xba, 0x0e, 0x2f, 0x3e, 0xfb, 0x1f, 0xa2, 0x13, 0x31, 0x32, 0xf6,
+    0xf0, 0xea, 0x0c, 0x56, 0x37, 0xef, 0x1c, 0xdb, 0x12, 0x68, 0x49, 0xe2, 0x02, 0xe6, 0x1c, 0x69,
+    0x4e, 0xd5, 0x11, 0xe8, 0xf3, 0x71, 0x76, 0xd7, 0x07, 0x1a, 0xfc, 0x07, 0x69, 0xdc, 0xfc, 0xf4,
+    0xf6, 0x47, 0x58, 0x08, 0x14, 0xd2, 0xfd, 0x13, 0x3a, 0xf4, 0x07, 0xc6, 0xe7, 0x2a, 0x5f, 0xdb,
+    0x0f, 0xe8, 0xeb, 0x3e, 0x3c, 0xd9, 0x21, 0xd0, 0xdd, 0xd0, 0x33, 0xdc, 0x18, 0xb6, 0x01, 0xe3,
+    0x15, 0xdb, 0x1b, 0xc5, 0xda, 0xbe, 0x14, 0xbf, 0xfb, 0xb3, 0xec, 0x0a, 0x0f, 0xc5, 0x2b, 0xdd,
+    0xde, 0xf4, 0x26, 0xfa, 0x77, 0xb7, 0xeb, 0xfc, 0x19, 0xff, 0x3b, 0xcd, 0xfd, 0x39, 0x51, 0xf9,
+    0x34, 0xd8, 0xd9, 0x41, 0x65, 0x04, 0xe9, 0xfc, 0xa5, 0xed, 0xf6, 0xf7, 0xd9, 0xdc, 0xa4, 0xf6,
+    0x02, 0x06, 0xf8, 0x30, 0x24, 0x0a, 0x05, 0xf9, 0x1a, 0x02, 0x0a, 0xfb, 0xea, 0xe0, 0x23, 0x1f,
+    0xe3, 0xfc, 0x34, 0xe2, 0x05, 0xeb, 0xda, 0xf4, 0x05, 0x2c, 0x1d, 0xf1, 0x06, 0x07, 0xf4, 0x3d,
+    0xf8, 0x30, 0x45, 0x07, 0xf1, 0x00, 0xec, 0x22, 0x59, 0x01, 0xff, 0x01, 0xf0, 0x20, 0x12, 0x00,
+    0x01, 0xf7, 0x01, 0x22, 0xf1, 0xf5, 0x01, 0xe2, 0xf9, 0x1a, 0x31, 0xf5, 0x14, 0xf9, 0x2a, 0x00,
+    0x5e, 0x0b, 0xce, 0x04, 0xf5, 0x1e, 0x29, 0xff, 0x2f, 0xfe, 0x08, 0xe0, 0xed, 0x11, 0xc6, 0x19,
+    0x0b, 0xb4, 0x04, 0x0b, 0x52, 0x17, 0xd6, 0xcb, 0xef, 0xf6, 0xcc, 0xef, 0x0d, 0xd1, 0xdc, 0x0a,
+    0x60, 0xfb, 0x08, 0xdc, 0x00, 0xf9, 0xe3, 0xde, 0x41, 0xeb, 0xc7, 0xfb, 0x2c, 0xf1, 0x37, 0xeb,
+    0xc6, 0x1a, 0x06, 0xd5, 0x0e, 0x0f, 0xb0, 0xdd, 0xf5, 0x12, 0x1b, 0x29, 0xc5, 0x18, 0xfd, 0x0b,
+    0xfd, 0x24, 0xe2, 0x0e, 0x02, 0x0d, 0xff, 0x37, 0x11, 0xee, 0xfc, 0x13, 0x1c, 0x15, 0xea, 0x03,
+    0xfd, 0x17, 0xf6, 0x31, 0xc6, 0x0b, 0xfc, 0xf6, 0x12, 0x28, 0xf4, 0xf8, 0x05, 0xe6, 0x0f, 0x1b,
+    0x13, 0xff, 0xfb, 0x00, 0xec, 0xec, 0x4e, 0xfa, 0xeb, 0x08, 0x0d, 0xde, 0xff, 0x00, 0x37, 0x07,
+    0x32, 0x92, 0xf6, 0x15, 0xce, 0xfd, 0x06, 0xa5, 0xd3, 0xed, 0x1c, 0x07, 0xf0, 0xd2, 0xf1, 0x26,
+    0xca, 0x00, 0x04, 0xea, 0x01, 0xf1, 0x7f, 0xfa, 0x1d, 0x34, 0x0a, 0xd7, 0xf2, 0x14, 0x11, 0x3a,
+    0x08, 0xfd, 0x45, 0xd2, 0x15, 0x21, 0xf9, 0x05, 0xc6, 0xfa, 0x23, 0x29, 0x17, 0xf8, 0x54, 0xf4,
+    0x22, 0x0d, 0x06, 0x33, 0xf5, 0x1a, 0x1e, 0x1d, 0x1a, 0xe1, 0xfd, 0xf2, 0x12, 0x09, 0x30, 0x2c,
+    0xfc, 0x24, 0x11, 0xe3, 0x31, 0x05, 0x03, 0x1c, 0x27, 0xc0, 0xfe, 0xf9, 0xfa, 0x09, 0x09, 0xb6,
+    0xe4, 0x03, 0x02, 0xd8, 0xe4, 0xde, 0xeb, 0xe5, 0xfd, 0x2d, 0xf2, 0xd1, 0xf3, 0xe8, 0xfb, 0x0d,
+    0x08, 0x17, 0xef, 0x0d, 0xe0, 0xf4, 0x10, 0x3c, 0xe2, 0xf6, 0x45, 0xdd, 0x08, 0x10, 0x13, 0xe6,
+    0xe9, 0xe8, 0x15, 0xd0, 0x04, 0xee, 0x14, 0x0d, 0x12, 0xbb, 0xf0, 0xe3, 0x22, 0x14, 0x0a, 0xae,
+    0x05, 0xeb, 0xdb, 0x03, 0x11, 0xa6, 0x0d, 0xf3, 0xef, 0xfb, 0x07, 0xb1, 0xdb, 0xf3, 0x02, 0xf0,
+    0xfa, 0xd0, 0xd1, 0xf2, 0xfe, 0xf6, 0xe0, 0xe9, 0xc1, 0xea, 0x0e, 0x04, 0x13, 0x22, 0xe6, 0x03,
+    0x25, 0x19, 0x0c, 0x42, 0x10, 0x0c, 0xe3, 0xee, 0xfb, 0x1c, 0x00, 0xfe, 0xff, 0x11, 0xe4, 0x1f,
+    0xf4, 0x15, 0xf7, 0x13, 0x00, 0x09, 0x1e, 0x06, 0xea, 0xde, 0x0a, 0x16, 0x1b, 0x29, 0x0b, 0x21,
+    0xfa, 0x17, 0x06, 0x2a, 0x05, 0x02, 0xdb, 0x29, 0x27, 0x1d, 0x02, 0x1b, 0xd9, 0x31, 0x44, 0x22,
+    0xee, 0x17, 0xea, 0x11, 0x59, 0x24, 0x5b, 0x25, 0xe3, 0xcf, 0x28, 0x1d, 0xe0, 0x12, 0xf4, 0xbf,
+    0x13, 0x39, 0x22, 0xf6, 0xdd, 0xd3, 0xf9, 0x1a, 0xe2, 0x0a, 0xe9, 0x07, 0x0d, 0x11, 0x7f, 0xfa,
+    0xf2, 0x30, 0x2d, 0x17, 0x01, 0x05, 0xf3, 0x24, 0x20, 0xf1, 0x08, 0x1d, 0x0b, 0x17, 0x09, 0xfe,
+    0x15, 0x21, 0xfc, 0xe1, 0xf3, 0x04, 0xd5, 0x37, 0x0a, 0xda, 0xfd, 0xe9, 0xff, 0xf9, 0xf7, 0xd8,
+    0xf7, 0xf4, 0xf3, 0xfb, 0x0f, 0xd4, 0xe5, 0xd4, 0x04, 0x18, 0x07, 0xdd, 0xf7, 0xd8, 0x17, 0xec,
+    0x06, 0xf3, 0xf6, 0xe0, 0x03, 0x10, 0xf3, 0xd4, 0xcf, 0xe6, 0xfd, 0x12, 0x01, 0xcd, 0xb7, 0xf2,
+    0x07, 0xfa, 0x13, 0xd3, 0xc1, 0xeb, 0xf6, 0xf2, 0xf0, 0x0f, 0xda, 0x0f, 0xf8, 0x04, 0x04, 0x24,
+    0xfb, 0x05, 0xf1, 0xef, 0xe3, 0x35, 0xe4, 0x10, 0xfb, 0x07, 0xe0, 0x22, 0xf2, 0x00, 0xf7, 0x09,
+    0xe5, 0x24, 0x0f, 0x0a, 0x10, 0x29, 0xd5, 0x1b, 0x09, 0x16, 0xee, 0x13, 0xc0, 0x31, 0xef, 0x03,
+    0x0a, 0xfb, 0xcc, 0x1f, 0x2d, 0x26, 0xe9, 0x21, 0xd3, 0x2a, 0x56, 0x10, 0x2e, 0x1e, 0xea, 0xf6,
+    0x32, 0x27, 0xf3, 0xed, 0xc4, 0xea, 0xf3, 0x07, 0x1c, 0xd5, 0xf1, 0xc1, 0xf7, 0xee, 0xce, 0x03,
+    0xb2, 0xe3, 0xed, 0xf2, 0xea, 0x17, 0xfd, 0xd9, 0x12, 0x1e, 0x2c, 0xd9, 0xfd, 0xfa, 0x1c, 0x03,
+    0xfa, 0xf4, 0xef, 0xea, 0x2c, 0x04, 0x04, 0x00, 0xe0, 0xcf, 0xfe, 0xf2, 0xf6, 0xda, 0xf0, 0xbb,
+    0x08, 0xff, 0xfb, 0xeb, 0xf5, 0xa7, 0x1b, 0x06, 0x02, 0xfe, 0xfd, 0x9f, 0x07, 0xfc, 0x0b, 0xe6,
+    0x17, 0xb4, 0x15, 0x06, 0x0a, 0xdf, 0xef, 0xba, 0xf6, 0xfa, 0x01, 0xfd, 0x02, 0xb0, 0x08, 0x04,
+    0xf6, 0x05, 0x07, 0xa1, 0x18, 0xf5, 0x02, 0x09, 0x18, 0xcb, 0x04, 0x0d, 0x0b, 0x04, 0x2a, 0x93,
+    0x18, 0x05, 0xe4, 0x03, 0xfa, 0xb9, 0x12, 0x0f, 0xdb, 0xff, 0x09, 0xbb, 0x0f, 0x03, 0xfe, 0xee,
+    0x05, 0xa8, 0x1c, 0xf3, 0xd3, 0x01, 0xe7, 0xb6, 0xfd, 0x09, 0x18, 0xe2, 0xf6, 0xc9, 0x17, 0x08,
+    0xe8, 0x0d, 0xee, 0xb3, 0x0d, 0x0f, 0xcc, 0xf3, 0xfc, 0xbf, 0xf7, 0xf8, 0xf1, 0xdd, 0xf9, 0xbd,
+    0xfb, 0x01, 0x2a, 0x09, 0xef, 0xbf, 0xfc, 0xfa, 0xec, 0x0d, 0xd3, 0x8c, 0xf7, 0x00, 0x1b, 0x15,
+    0xdb, 0x86, 0xfd, 0xf4, 0x02, 0x10, 0x00, 0x95, 0x01, 0x05, 0xf9, 0x13, 0xee, 0xc1, 0xe9, 0xf8,
+    0x11, 0xe1, 0x16, 0xd8, 0xf2, 0x23, 0xec, 0xee, 0xff, 0x99, 0xed, 0xff, 0xf8, 0xf4, 0x0d, 0x99,
+    0xe8, 0xf7, 0xf9, 0xf3, 0x07, 0x89, 0xfb, 0x02, 0xf7, 0xf6, 0x09, 0x81, 0x02, 0x00, 0xef, 0xe0,
+    0xeb, 0xa8, 0x02, 0x01, 0xfd, 0xeb, 0xf2, 0xa6, 0x09, 0xf9, 0xf0, 0xfb, 0xd7, 0x9c, 0x03, 0x0f,
+    0x06, 0x14, 0xe8, 0xa8, 0xfe, 0x03, 0x06, 0xf8, 0xee, 0x90, 0x02, 0x08, 0x01, 0xf4, 0xc2, 0x94,
+    0x01, 0xfc, 0x2b, 0xef, 0xe5, 0xa3, 0xfc, 0x02, 0x1c, 0xe0, 0xdf, 0x9e, 0x06, 0x07, 0x08, 0xf8,
+    0x04, 0x91, 0x09, 0x32, 0x0c, 0x0b, 0x01, 0xaa, 0xfd, 0x01, 0xfb, 0xe2, 0x19, 0xb2, 0x13, 0x0e,
+    0x17, 0xdf, 0x15, 0x84, 0xf8, 0xf3, 0xfb, 0x00, 0x23, 0x91, 0x0f, 0x29, 0xf8, 0x20, 0x07, 0xb6,
+    0xe6, 0x0a, 0xf6, 0x13, 0xfd, 0xc5, 0xfc, 0x11, 0xd2, 0x05, 0xf7, 0xeb, 0xdb, 0x0c, 0x26, 0xf9,
+    0xee, 0x0c, 0xad, 0x0b, 0x34, 0x0c, 0xfb, 0x49, 0xf3, 0x44, 0x20, 0xaf, 0x25, 0xdb, 0x00, 0x2f,
+    0x32, 0xee, 0x0d, 0x4a, 0x05, 0xe8, 0x26, 0xec, 0x15, 0x51, 0x23, 0xf1, 0x3a, 0x28, 0xf1, 0x45,
+    0x07, 0x1a, 0x2b, 0x19, 0x0e, 0x45, 0x1f, 0xe0, 0x25, 0x0a, 0x24, 0x39, 0xff, 0x09, 0x52, 0x05,
+    0x23, 0x3b, 0x22, 0x14, 0x5c, 0x14, 0x4d, 0x60, 0xef, 0xe3, 0x54, 0x50, 0x33, 0x1d, 0x2b, 0x37,
+    0x2b, 0x20, 0xf2, 0x27, 0x14, 0x55, 0x57, 0x3a, 0x04, 0x63, 0xf8, 0xf0, 0x15, 0x54, 0xe0, 0x5c,
+    0x14, 0x28, 0x34, 0x0e, 0x11, 0x30, 0x02, 0x48, 0x0e, 0x16, 0x2e, 0x38, 0x05, 0x21, 0x12, 0x23,
+    0xfa, 0x44, 0xf7, 0x45, 0xee, 0x09, 0x05, 0x46, 0xe6, 0x4e, 0xe4, 0x36, 0x1f, 0x61, 0xe1, 0x2f,
+    0xfd, 0x09, 0x09, 0x32, 0xd1, 0x10, 0xff, 0x01, 0xd6, 0x2b, 0xfd, 0x51, 0x10, 0x0b, 0x10, 0xfb,
+    0xeb, 0x05, 0xf8, 0x4d, 0x19, 0x14, 0x28, 0xfc, 0x2a, 0x1a, 0xfc, 0x18, 0x18, 0xd3, 0x07, 0x13,
+    0x01, 0xfd, 0xef, 0xbb, 0x1e, 0x36, 0x1e, 0x20, 0x2d, 0x12, 0x19, 0x26, 0xcd, 0x15, 0x28, 0xa3,
+    0x19, 0x46, 0x06, 0x12, 0x05, 0x81, 0x25, 0x0f, 0xe1, 0x09, 0x2c, 0xcf, 0x1a, 0x19, 0xe9, 0xf8,
+    0x18, 0xa6, 0x3e, 0x04, 0x15, 0xe3, 0x36, 0xb7, 0x3a, 0x0e, 0x13, 0xf5, 0x29, 0xa8, 0x3b, 0xee,
+    0x0f, 0xfa, 0x52, 0xe4, 0x5a, 0xea, 0x20, 0xe2, 0x32, 0xf7, 0x55, 0xe1, 0x05, 0xfd, 0x5b, 0xea,
+    0x2b, 0xdf, 0xf9, 0x17, 0x05, 0xba, 0x5a, 0xe6, 0x19, 0x5e, 0xfe, 0xed, 0x4c, 0xf5, 0xe4, 0x6c,
+    0x16, 0xd4, 0x22, 0x3b, 0x18, 0x0f, 0xe2, 0xfb, 0x3a, 0x14, 0xda, 0x10, 0xe4, 0xd3, 0x1e, 0xc9,
+    0xf1, 0x08, 0xde, 0x0a, 0x1c, 0xda, 0x0e, 0x1f, 0xf8, 0x08, 0xf9, 0xf0, 0x09, 0x3f, 0xf3, 0x28,
+    0x19, 0xe7, 0x08, 0x33, 0xfd, 0x11, 0xe2, 0xc1, 0xee, 0x2a, 0xc8, 0x19, 0xea, 0xd9, 0xf4, 0x11,
+    0xfe, 0xf1, 0xee, 0xf0, 0x40, 0xfc, 0xdb, 0xee, 0xed, 0xf2, 0x06, 0x16, 0x08, 0xe2, 0xea, 0xe1,
+    0x0f, 0x08, 0xc0, 0x01, 0x08, 0x19, 0xf3, 0x34, 0x0b, 0x0f, 0xd1, 0x03, 0x0c, 0xf8, 0x08, 0x33,
+    0xc2, 0xf6, 0x07, 0xc9, 0xf7, 0xfa, 0xed, 0xdf, 0x1e, 0xa1, 0xf8, 0x21, 0x03, 0xdc, 0x45, 0x93,
+    0x03, 0x16, 0x05, 0xcd, 0x1e, 0x9b, 0xf7, 0x02, 0xe2, 0xf1, 0x29, 0xb1, 0x0b, 0xf0, 0xd7, 0x00,
+    0x25, 0xb1, 0x01, 0x15, 0xe3, 0xf5, 0xeb, 0xcb, 0xf6, 0x21, 0xe6, 0xea, 0xcc, 0xc0, 0xf8, 0xe9,
+    0xf8, 0xf0, 0xed, 0xd5, 0x07, 0x15, 0xbf, 0x11, 0x0d, 0xac, 0xfe, 0x0c, 0xbc, 0x12, 0x06, 0x8c,
+    0x1b, 0x0d, 0xf5, 0x0f, 0x02, 0xbe, 0x1c, 0x10, 0xb3, 0xff, 0x06, 0xb6, 0x0d, 0x0e, 0xc5, 0xe6,
+    0xd3, 0xe2, 0x05, 0xf2, 0x0b, 0x0b, 0xfe, 0xe2, 0x09, 0x09, 0xa6, 0x14, 0xf6, 0xda, 0xf9, 0x20,
+    0xb7, 0x30, 0x02, 0xe5, 0x13, 0xfe, 0xda, 0x37, 0xfa, 0xda, 0xec, 0x0f, 0xb0, 0x22, 0x02, 0xc1,
+    0x01, 0x00, 0xcd, 0x5b, 0xeb, 0xb2, 0xfa, 0xfe, 0xd5, 0x3c, 0x0e, 0xa4, 0xfd, 0xfb, 0xc6, 0x2d,
+    0x19, 0xbf, 0x0b, 0xf4, 0xb5, 0x13, 0x38, 0xbd, 0xe8, 0xe7, 0xc9, 0x22, 0x2b, 0xc9, 0xf1, 0x09,
+    0xd7, 0x22, 0x40, 0xd4, 0xf8, 0x0b, 0xbe, 0x10, 0x64, 0xbc, 0xf8, 0x23, 0xd8, 0x2d, 0x4e, 0xbc,
+    0xfd, 0x00, 0xf7, 0x16, 0x34, 0xa8, 0x07, 0xe1, 0xcb, 0x0b, 0x15, 0xce, 0xfd, 0xd1, 0xdc, 0x1e,
+    0x27, 0xd5, 0xf4, 0xe4, 0x0a, 0x03, 0x21, 0xc0, 0xfe, 0xfb, 0xc3, 0xff, 0x10, 0xce, 0xe1, 0x04,
+    0xd3, 0xfa, 0x1e, 0xd5, 0xf8, 0x0d, 0xf3, 0xf6, 0x05, 0x9d, 0xf8, 0x09, 0xcc, 0xee, 0x09, 0x81,
+    0xf8, 0x13, 0xe8, 0xd5, 0x25, 0xa5, 0xf5, 0xf4, 0xcc, 0xcb, 0x30, 0xa5, 0xf0, 0xee, 0xef, 0xc6,
+    0x41, 0xbc, 0xf7, 0xe0, 0xc8, 0xda, 0x43, 0xbe, 0xec, 0x11, 0xd1, 0xc8, 0x42, 0xb2, 0xf9, 0x20,
+    0xbd, 0xc7, 0x3a, 0xae, 0xe5, 0x03, 0xc9, 0xd8, 0x1f, 0xb9, 0xf2, 0xfa, 0xd4, 0xdf, 0xea, 0xb1,
+    0xdd, 0x33, 0xda, 0xd2, 0xe9, 0xc5, 0xee, 0x30, 0xcd, 0xc5, 0xd8, 0xc2, 0xd6, 0x17, 0xd7, 0xcd,
+    0xd7, 0xd7, 0xc7, 0x21, 0xf5, 0xd1, 0xae, 0x08, 0x08, 0x18, 0xf0, 0x2c, 0x23, 0xd5, 0x30, 0x1e,
+    0x05, 0x28, 0x0c, 0x07, 0x26, 0x34, 0x1b, 0x54, 0xc0, 0xfa, 0x2f, 0x2c, 0x29, 0x20, 0xc6, 0x16,
+    0x37, 0x34, 0x14, 0x15, 0xe7, 0x16, 0x21, 0x17, 0x57, 0x1a, 0x23, 0x36, 0xfd, 0x07, 0x71, 0x0e,
+    0x24, 0x24, 0xfb, 0xff, 0x26, 0x18, 0x28, 0x3a, 0x06, 0x16, 0x67, 0x2e, 0x1b, 0x1b, 0xff, 0x12,
+    0x18, 0x00, 0x03, 0xf5, 0x04, 0x17, 0x77, 0x0b, 0x2d, 0x11, 0x18, 0x12, 0x70, 0x18, 0x08, 0x08,
+    0x38, 0x2c, 0x64, 0xda, 0x10, 0xf3, 0x44, 0x01, 0x1a, 0x17, 0x10, 0x20, 0x26, 0x0a, 0x4b, 0xd6,
+    0xff, 0x13, 0x29, 0x21, 0x08, 0xff, 0x26, 0xfb, 0x20, 0x25, 0x6a, 0x18, 0x0f, 0x03, 0x4c, 0xe8,
+    0xd0, 0xf8, 0x42, 0x21, 0x09, 0xe0, 0xda, 0xd0, 0xe6, 0x5c, 0x1a, 0x06, 0xe9, 0xba, 0x29, 0x7c,
+    0xcc, 0xf3, 0xe4, 0x1d, 0x18, 0x1e, 0xd0, 0x10, 0xe1, 0x08, 0xfc, 0x0c, 0xcf, 0x30, 0xd0, 0x07,
+    0x09, 0xe0, 0xd9, 0x1a, 0xc8, 0xe7, 0xe9, 0xf0, 0x0c, 0x39, 0xfc, 0xd5, 0xe2, 0xf1, 0x58, 0x36,
+    0x32, 0xcc, 0x16, 0x0a, 0x48, 0x02, 0xff, 0xd4, 0xab, 0xf8, 0x45, 0xef, 0x26, 0xdc, 0x17, 0x2e,
+    0x0d, 0xec, 0x64, 0xd2, 0x2e, 0x19, 0x2d, 0xf7, 0x3f, 0xb6, 0x1d, 0x37, 0x02, 0x0f, 0x7f, 0xb7,
+    0x11, 0x5b, 0xf5, 0x14, 0x75, 0xb8, 0x42, 0x42, 0xdc, 0x30, 0x69, 0xc9, 0x1f, 0x17, 0x02, 0xef,
+    0x5e, 0x1c, 0x13, 0x27, 0xf1, 0xf7, 0x66, 0xee, 0x0b, 0x01, 0x1b, 0x3e, 0x00, 0xc4, 0x12, 0x1a,
+    0x14, 0x23, 0x43, 0x28, 0x1d, 0x01, 0x29, 0xf5, 0xe3, 0x29, 0xfb, 0xfc, 0x1c, 0x1a, 0xde, 0x14,
+    0x04, 0x21, 0x0e, 0x1d, 0xd7, 0xe0, 0x13, 0x1c, 0x17, 0x0f, 0xd2, 0x15, 0x12, 0x14, 0x31, 0xf0,
+    0xd3, 0x10, 0x00, 0x27, 0x1b, 0x09, 0xe1, 0xe6, 0xc7, 0x13, 0x03, 0x26, 0xe8, 0xfc, 0xd1, 0xf6,
+    0x23, 0x1a, 0xcb, 0x4c, 0x17, 0xbd, 0xf4, 0x5f, 0xfb, 0x00, 0xe0, 0xfb, 0x2e, 0x3c, 0xfa, 0xef,
+    0xee, 0xb2, 0x3e, 0x57, 0x16, 0x2f, 0xa3, 0xfc, 0x08, 0x21, 0xf4, 0x0b, 0x25, 0x23, 0x02, 0x31,
+    0x01, 0xf3, 0x14, 0xec, 0x1b, 0xfd, 0xf6, 0xda, 0x2d, 0xd8, 0xed, 0xef, 0xfa, 0xf6, 0x00, 0xb3,
+    0xf3, 0xf9, 0x03, 0x10, 0x29, 0xcf, 0x02, 0xdb, 0xf8, 0x04, 0x17, 0xcb, 0x02, 0xcf, 0x02, 0x1b,
+    0x1f, 0xd5, 0xfc, 0xcc, 0xf0, 0x0a, 0x19, 0xf3, 0x01, 0xb8, 0xe2, 0x1a, 0x01, 0xe8, 0xfe, 0xce,
+    0xe0, 0xff, 0x00, 0xe3, 0x0d, 0xd6, 0xeb, 0xf5, 0x0f, 0xda, 0x00, 0xcf, 0xfe, 0xfd, 0xff, 0xe4,
+    0x00, 0xe8, 0xf5, 0x04, 0x14, 0xed, 0xf9, 0xf4, 0x09, 0xf2, 0x28, 0xd7, 0x00, 0xed, 0x28, 0x04,
+    0x21, 0xd9, 0x0c, 0x01, 0x1a, 0x03, 0x14, 0xfa, 0xfb, 0x0a, 0x19, 0xef, 0x01, 0xf3, 0x09, 0x03,
+    0xde, 0x0b, 0x10, 0xf3, 0xf4, 0x19, 0x0e, 0x02, 0xf4, 0xef, 0x01, 0x2c, 0xdf, 0x0f, 0x03, 0x09,
+    0xfd, 0x3e, 0xe6, 0x1b, 0xeb, 0xf2, 0xfe, 0x42, 0xff, 0x0d, 0x11, 0xd9, 0x06, 0x5d, 0xfd, 0x0b,
+    0xfc, 0xce, 0xfb, 0x7f, 0xf7, 0x0a, 0x16, 0xcf, 0x03, 0x72, 0xe9, 0x0e, 0x12, 0xe0, 0xf9, 0x5f,
+    0x0b, 0x1a, 0x04, 0xfb, 0x06, 0x52, 0x4e, 0x11, 0x30, 0xf1, 0x07, 0x36, 0xd5, 0x10, 0x05, 0xe3,
+    0x14, 0x4a, 0xe3, 0x06, 0x05, 0xcd, 0x01, 0x22, 0x23, 0xf4, 0x15, 0xd0, 0x0e, 0x0e, 0xd6, 0x1e,
+    0xff, 0xed, 0xf1, 0x0d, 0xf2, 0x25, 0xed, 0xeb, 0xff, 0x04, 0x2f, 0x11, 0xf2, 0xea, 0x04, 0x00,
+    0x17, 0x12, 0x01, 0xd1, 0x1b, 0xe1, 0xfa, 0x00, 0xe9, 0xec, 0xf9, 0xde, 0xe1, 0x23, 0xfe, 0xee,
+    0x04, 0xdb, 0x08, 0xf5, 0x0a, 0xe2, 0x04, 0xd1, 0x01, 0xed, 0x18, 0xf6, 0x04, 0xd5, 0x02, 0xea,
+    0xf6, 0xf3, 0xfd, 0xb0, 0xfa, 0x09, 0x0c, 0xf0, 0x05, 0xd4, 0xf3, 0xef, 0x1d, 0xed, 0x02, 0xf2,
+    0xe7, 0xf3, 0x1c, 0xe4, 0x03, 0x02, 0x0d, 0x09, 0x21, 0xf0, 0xf8, 0x01, 0x1e, 0xe5, 0xfd, 0xf1,
+    0x09, 0x06, 0xf5, 0xc9, 0x06, 0xf7, 0xfb, 0x03, 0xf8, 0xf9, 0x17, 0xf4, 0x07, 0x0f, 0xd2, 0x03,
+    0x2b, 0xe9, 0x06, 0xf3, 0xf1, 0x02, 0x26, 0xeb, 0x09, 0xfe, 0xfb, 0xf3, 0xe8, 0x39, 0xe7, 0x03,
+    0xfa, 0x12, 0xd8, 0x0f, 0x26, 0xec, 0xfc, 0x32, 0x12, 0xfb, 0x41, 0xeb, 0xfe, 0x4c, 0xed, 0xfe,
+    0x0b, 0x1b, 0x05, 0x20, 0xef, 0xb9, 0x04, 0x08, 0x12, 0xf9, 0xe9, 0xd0, 0xfd, 0x09, 0x00, 0x1f,
+    0xde, 0xc4, 0x12, 0xe0, 0xe9, 0x13, 0xc3, 0xa9, 0x12, 0xfc, 0x31, 0xf9, 0xff, 0x97, 0xfb, 0xef,
+    0xc6, 0xee, 0x16, 0xbd, 0xf2, 0xde, 0x74, 0xe9, 0xff, 0x9b, 0xb1, 0xf4, 0xdb, 0xe7, 0x39, 0x0f,
+    0xb1, 0xf0, 0x2c, 0x26, 0x0b, 0x25, 0xfb, 0xe7, 0x7f, 0xda, 0xf6, 0x32, 0x28, 0xf5, 0xf8, 0x14,
+    0xe6, 0x0c, 0xfe, 0xdd, 0xe4, 0xf2, 0xf6, 0xe8, 0xa4, 0xe7, 0x24, 0xef, 0xf8, 0xf0, 0xac, 0xd1,
+    0xfc, 0x07, 0xd2, 0x03, 0xe0, 0xe9, 0xec, 0xe6, 0xd5, 0x2f, 0x1a, 0x09, 0x18, 0x04, 0xd9, 0x1c,
+    0x56, 0xce, 0x01, 0xe2, 0xff, 0x1e, 0x2e, 0x07, 0x03, 0xec, 0x0c, 0xf1, 0xe7, 0xcb, 0x0b, 0xe1,
+    0xda, 0xe3, 0xd5, 0x2f, 0xef, 0xf1, 0xf3, 0x20, 0x33, 0xf1, 0xdf, 0x02, 0x03, 0x21, 0x76, 0x06,
+    0x73, 0x3e, 0x00, 0xd5, 0x5f, 0xee, 0xdd, 0x1e, 0x54, 0xc6, 0x24, 0x07, 0x09, 0x0b, 0x1a, 0xbf,
+    0x18, 0x03, 0x01, 0xfe, 0x04, 0xdc, 0xd4, 0xe3, 0xf9, 0x08, 0x05, 0xf9, 0x00, 0x00, 0x01, 0x1b,
+    0xfa, 0xed, 0x37, 0x0e, 0x03, 0x25, 0xe9, 0x1b, 0x3c, 0x05, 0x07, 0x44, 0xf2, 0xe6, 0x1a, 0xd5,
+    0x79, 0x37, 0x01, 0xdd, 0xe5, 0x13, 0xe0, 0x2c, 0xf7, 0x07, 0xbe, 0x15, 0xf2, 0x32, 0xfe, 0x53,
+    0xe7, 0xe7, 0x54, 0xf3, 0x01, 0x5c, 0x2d, 0xf3, 0xd5, 0xe2, 0x16, 0x50, 0x28, 0xd3, 0xff, 0xfe,
+    0xfd, 0xf3, 0xe8, 0xf6, 0x15, 0xf8, 0xe8, 0xde, 0xe5, 0x14, 0xf0, 0xe7, 0xeb, 0xa5, 0xd7, 0xdb,
+    0xfc, 0xdf, 0xf2, 0xc2, 0xe2, 0x10, 0xff, 0xf2, 0x0c, 0xc6, 0xf3, 0x0e, 0xfd, 0xee, 0x02, 0xe1,
+    0xcd, 0x0e, 0x05, 0xd9, 0xd3, 0x09, 0xef, 0x3a, 0x06, 0x1f, 0xff, 0xe5, 0xf1, 0x0c, 0xfb, 0x09,
+    0xfb, 0x0f, 0xea, 0x03, 0xf2, 0x15, 0x2d, 0xdb, 0xa3, 0xc4, 0xd4, 0x28, 0x72, 0xe5, 0xd3, 0xe5,
+    0xe4, 0x06, 0x51, 0x22, 0xdc, 0xe7, 0xc6, 0x31, 0x32, 0xff, 0xf8, 0xf4, 0xcc, 0x58, 0x02, 0xcf,
+    0xf9, 0xf5, 0xce, 0x04, 0x10, 0xdc, 0x2c, 0xcb, 0xe4, 0x14, 0x32, 0xb4, 0x17, 0xe1, 0x2e, 0x2e,
+    0x0b, 0xc7, 0x37, 0x07, 0x35, 0x34, 0x08, 0xeb, 0x26, 0x0f, 0x41, 0x3e, 0x17, 0x83, 0x65, 0xca,
+    0x16, 0x28, 0xcd, 0x8e, 0x50, 0x1f, 0x30, 0x50, 0xcd, 0xc3, 0x50, 0x29, 0x47, 0x36, 0xf6, 0xe7,
+    0x46, 0x18, 0x34, 0x3c, 0x04, 0xc1, 0x38, 0x0e, 0x2f, 0x48, 0x1b, 0xda, 0x08, 0xff, 0x39, 0x1c,
+    0x18, 0xe4, 0x3c, 0xf3, 0x36, 0x31, 0x29, 0xfa, 0x1e, 0xfa, 0x5a, 0x68, 0x15, 0xe3, 0x21, 0xfd,
+    0x47, 0x28, 0x29, 0x05, 0x18, 0x0b, 0x49, 0x4e, 0x07, 0x15, 0xc8, 0x11, 0x4c, 0x1e, 0xc8, 0x16,
+    0xc7, 0xfc, 0x3e, 0x2d, 0xc6, 0xf7, 0xb1, 0x15, 0xf9, 0x2c, 0xbb, 0x03, 0xbb, 0xfe, 0x33, 0x3e,
+    0xd8, 0xe1, 0xab, 0xc5, 0xf8, 0x21, 0xbd, 0xf0, 0x84, 0xf3, 0xb9, 0x3d, 0xcb, 0xce, 0xa8, 0x05,
+    0xbb, 0x37, 0x09, 0xdd, 0xaf, 0x05, 0xb2, 0x24, 0xd4, 0x08, 0xa8, 0xf4, 0xc7, 0x03, 0x02, 0xba,
+    0xc7, 0xec, 0xd0, 0xf1, 0xd1, 0xa9, 0x9c, 0xf8, 0xf5, 0x09, 0x27, 0xa8, 0xc6, 0xde, 0x2c, 0xb9,
+    0x21, 0xed, 0xee, 0xea, 0x33, 0xdd, 0x1b, 0xd0, 0x00, 0x0a, 0x25, 0xd8, 0x0e, 0xf8, 0x20, 0xdf,
+    0x52, 0xe3, 0xf7, 0xd6, 0xf4, 0x10, 0x7f, 0xd7, 0x11, 0xc0, 0xfe, 0x0b, 0x37, 0xe9, 0x04, 0xb7,
+    0xfb, 0x22, 0x29, 0xf6, 0x03, 0xb4, 0x34, 0x29, 0x67, 0xdf, 0x1a, 0xde, 0x29, 0x15, 0x4e, 0x1d,
+    0x23, 0xfa, 0x39, 0x3c, 0x65, 0xfe, 0x2d, 0xf6, 0x2c, 0xfd, 0x39, 0xe0, 0x19, 0x00, 0x1d, 0x3c,
+    0x2f, 0x1e, 0xca, 0x17, 0x20, 0x19, 0x48, 0x1e, 0xc2, 0x09, 0x0e, 0x0b, 0xe4, 0xf9, 0x04, 0x14,
+    0xc9, 0x05, 0x18, 0x33, 0xe4, 0x33, 0x04, 0xf0, 0x0f, 0x16, 0x15, 0x24, 0xe7, 0xf5, 0xc5, 0x1b,
+    0xfa, 0x31, 0xbd, 0x09, 0xd6, 0x49, 0xee, 0x42, 0x0b, 0xd7, 0xc1, 0x1e, 0x12, 0x09, 0xec, 0xfe,
+    0xb7, 0x02, 0x2a, 0x19, 0xea, 0x0b, 0xe0, 0x06, 0x22, 0x24, 0xfd, 0x24, 0xe9, 0x0d, 0x12, 0x4e,
+    0xfd, 0x3d, 0xe9, 0x29, 0xed, 0x67, 0xf8, 0x07, 0xeb, 0x21, 0xe8, 0x68, 0xfd, 0x1d, 0xdd, 0x39,
+    0xd7, 0x46, 0x03, 0x19, 0xe8, 0x4d, 0xd1, 0x3a, 0x02, 0x29, 0xd0, 0x25, 0xde, 0x44, 0x0b, 0xeb,
+    0xb5, 0x0f, 0xc6, 0x4f, 0x02, 0xe8, 0xeb, 0xfa, 0xc9, 0x41, 0x0c, 0xe3, 0xe7, 0xee, 0xe0, 0x60,
+    0xf6, 0x19, 0xe8, 0xe5, 0xc7, 0x42, 0xfa, 0xf7, 0xf8, 0xf7, 0xac, 0x23, 0xed, 0xe0, 0xea, 0xfe,
+    0x94, 0x2e, 0xec, 0x00, 0xe9, 0x1a, 0x81, 0x31, 0xfb, 0xe0, 0xbb, 0xf8, 0x8d, 0x2f, 0x07, 0xcb,
+    0xdf, 0xf7, 0x9b, 0x2b, 0xf8, 0xdd, 0xbb, 0x15, 0xca, 0x21, 0x14, 0xee, 0xdc, 0x12, 0xdd, 0x4a,
+    0x10, 0xd0, 0xce, 0xe4, 0xdf, 0x3c, 0x05, 0xe8, 0x9e, 0xcc, 0x01, 0x40, 0xff, 0xd0, 0xde, 0xd6,
+    0xf0, 0x46, 0x07, 0xdd, 0xb8, 0xed, 0xee, 0x32, 0xee, 0xe2, 0xc2, 0xbb, 0xfa, 0x43, 0x08, 0x1c,
+    0xbd, 0xed, 0xe1, 0x4a, 0x0b, 0x06, 0xc9, 0xeb, 0x03, 0x38, 0x0b, 0x11, 0xed, 0xf9, 0xde, 0x3b,
+    0x04, 0x36, 0xe9, 0xe1, 0xbe, 0x70, 0x03, 0x4d, 0xd9, 0x0c, 0xdc, 0x71, 0x08, 0x63, 0x05, 0xec,
+    0xf9, 0x3a, 0xfc, 0x2f, 0xf1, 0xfc, 0xdc, 0x57, 0x06, 0x0a, 0xc8, 0xe0, 0x23, 0x3e, 0xfe, 0x31,
+    0xff, 0xcf, 0x32, 0x51, 0xfe, 0x31, 0xec, 0xe1, 0xea, 0x4a, 0x13, 0x20, 0xf5, 0xcd, 0x05, 0x40,
+    0xfb, 0x28, 0xe7, 0xd3, 0x0e, 0x40, 0x08, 0x2f, 0xd8, 0xf3, 0xfc, 0x27, 0xec, 0x1b, 0xe5, 0x0a,
+    0xef, 0x3c, 0x0f, 0x1f, 0xf9, 0x18, 0xf7, 0x38, 0xfb, 0x1d, 0xdd, 0x00, 0xd1, 0x33, 0xf3, 0xbb,
+    0xd8, 0x04, 0x0a, 0x4d, 0x14, 0xdf, 0xf4, 0xf4, 0xf4, 0x5a, 0x08, 0xde, 0xd5, 0xf2, 0x0f, 0x38,
+    0x0e, 0x0c, 0xe5, 0xf7, 0xf7, 0x44, 0x16, 0x11, 0xce, 0xbf, 0x31, 0x19, 0x01, 0xf5, 0xdd, 0xe7,
+    0x2e, 0x28, 0xe6, 0xf5, 0x0d, 0xe6, 0x0f, 0xed, 0x6d, 0xd1, 0x7f, 0xdb, 0x0f, 0xe0, 0x5a, 0xd4,
+    0x6d, 0x00, 0xf7, 0x2e, 0x18, 0xdf, 0x5d, 0xc6, 0xe7, 0x12, 0x2a, 0x00, 0x46, 0xdc, 0xf7, 0x19,
+    0x17, 0xda, 0x2d, 0x37, 0xd6, 0x4d, 0xd8, 0x4b, 0x23, 0xea, 0xbf, 0x0b, 0x18, 0xf3, 0xe6, 0xe9,
+    0xea, 0x17, 0xec, 0x48, 0xe6, 0xda, 0xf0, 0x53, 0xe5, 0x19, 0xe5, 0x20, 0x15, 0x16, 0x02, 0x00,
+    0xbe, 0xe6, 0xd4, 0x16, 0xe7, 0x07, 0xcf, 0xe7, 0x11, 0x4a, 0xed, 0x05, 0xd3, 0xf2, 0xd6, 0x23,
+    0xf6, 0x16, 0xe2, 0xe3, 0xe5, 0xec, 0xe5, 0x0d, 0xf0, 0xd3, 0x04, 0xf6, 0x03, 0xd3, 0xed, 0xd8,
+    0x0b, 0x04, 0xf7, 0x12, 0xf1, 0xe5, 0x12, 0xd5, 0x25, 0x2e, 0x18, 0x06, 0x07, 0xee, 0x30, 0xfd,
+    0x51, 0xf3, 0x32, 0xdb, 0x1c, 0xcf, 0x40, 0xfd, 0xec, 0xf5, 0x2e, 0x00, 0x62, 0x1e, 0x00, 0xe6,
+    0x16, 0xf0, 0x52, 0x44, 0x26, 0xdf, 0x3d, 0xb9, 0x66, 0xf2, 0x17, 0x03, 0x1c, 0xda, 0x65, 0xe7,
+    0x2f, 0xf0, 0x4e, 0xc0, 0x67, 0xf8, 0x1a, 0x05, 0xfe, 0x1e, 0x63, 0x02, 0x09, 0x40, 0x2c, 0xe5,
+    0x65, 0xea, 0xf3, 0x37, 0xd9, 0x22, 0x58, 0x19, 0xef, 0x51, 0x00, 0xbb, 0x5b, 0x48, 0x1b, 0x19,
+    0xeb, 0x02, 0x1e, 0x60, 0x0f, 0x06, 0xe8, 0x35, 0x4c, 0x22, 0xf6, 0x1e, 0x04, 0x0b, 0x1b, 0x19,
+    0xf4, 0x0e, 0xed, 0x0e, 0xd7, 0xdd, 0xfb, 0x0b, 0x1a, 0x2a, 0xed, 0xea, 0xae, 0x00, 0x05, 0x01,
+    0xd9, 0x1c, 0xe5, 0x01, 0x0f, 0x14, 0xdd, 0xf1, 0xec, 0x26, 0x11, 0x07, 0xda, 0xe4, 0xbd, 0x56,
+    0x03, 0x35, 0xdb, 0x27, 0xe5, 0x38, 0x17, 0x3d, 0xd9, 0x07, 0xde, 0x29, 0xfd, 0x12, 0xe0, 0x00,
+    0xea, 0x41, 0xde, 0xff, 0xe6, 0xe7, 0xdb, 0x4f, 0x00, 0x1f, 0xee, 0xea, 0xc6, 0x25, 0xf8, 0xde,
+    0x06, 0xf2, 0xcf, 0x12, 0x0d, 0xd3, 0x04, 0x03, 0xcb, 0xf8, 0xfe, 0x00, 0x26, 0xe3, 0xff, 0x13,
+    0x0a, 0xdd, 0x62, 0xd7, 0x57, 0xf0, 0xed, 0x03, 0x4d, 0xf2, 0xd1, 0x1c, 0x00, 0xff, 0x36, 0x0e,
+    0x0d, 0xe8, 0xd5, 0xff, 0xa3, 0xf8, 0xfc, 0x25, 0x05, 0xdb, 0x2b, 0xf6, 0xeb, 0xf8, 0x04, 0xda,
+    0x30, 0xda, 0xd1, 0x1c, 0x24, 0x13, 0x1d, 0xfe, 0x8a, 0x1a, 0x05, 0xc8, 0x07, 0xf9, 0xa0, 0x0a,
+    0xed, 0xd7, 0x14, 0x04, 0x81, 0xe2, 0xe9, 0xe4, 0x1b, 0xf3, 0xb4, 0x00, 0xec, 0xc3, 0x19, 0xdc,
+    0xc5, 0xe7, 0x03, 0xd6, 0x31, 0xf8, 0xd4, 0x08, 0x1e, 0xf1, 0x15, 0x1f, 0xf4, 0xe6, 0x32, 0xf2,
+    0x17, 0x0e, 0xee, 0xee, 0x09, 0x01, 0x22, 0x18, 0x0a, 0x2c, 0x06, 0xff, 0x5b, 0x17, 0xdc, 0x31,
+    0x06, 0xfe, 0x27, 0xf8, 0xe3, 0x03, 0x07, 0x1a, 0x52, 0x0d, 0xe3, 0xfb, 0xfc, 0xdf, 0x29, 0x0d,
+    0x15, 0xf2, 0x0f, 0xdd, 0x66, 0x14, 0xfe, 0xac, 0xf9, 0xf6, 0x34, 0x38, 0x21, 0xd1, 0x12, 0xe6,
+    0x31, 0x16, 0x23, 0xa8, 0x38, 0xde, 0x3e, 0x0b, 0xec, 0xf1, 0x0a, 0x1e, 0x5b, 0x1d, 0xe1, 0xcb,
+    0x4e, 0x21, 0x4a, 0x31, 0xec, 0xb4, 0x0f, 0x0f, 0x1e, 0xff, 0xd9, 0xc6, 0x06, 0xcb, 0x41, 0x23,
+    0xfc, 0xc9, 0x1b, 0xeb, 0x45, 0x1b, 0xef, 0xf2, 0xfb, 0xed, 0x13, 0x21, 0xc5, 0x15, 0xed, 0xdc,
+    0x07, 0x0a, 0xc8, 0xf0, 0xe1, 0xe7, 0x0e, 0x0e, 0x8a, 0xe0, 0x07, 0xf8, 0x14, 0x31, 0xe0, 0xde,
+    0x05, 0xf0, 0x23, 0x19, 0xec, 0xa1, 0x02, 0x01, 0x1b, 0x2e, 0xe2, 0x8e, 0x16, 0xe2, 0x1f, 0x1d,
+    0xd6, 0xc7, 0x1a, 0x1b, 0x22, 0xf9, 0xe0, 0xd5, 0xfd, 0xe5, 0x3c, 0x01, 0xa7, 0xc9, 0x17, 0xe0,
+    0x27, 0x2c, 0xb6, 0xdd, 0x20, 0xc2, 0x7c, 0x04, 0xcc, 0x01, 0x26, 0xba, 0x0a, 0xeb, 0xa3, 0xca,
+    0x2a, 0x16, 0x16, 0x3e, 0xb6, 0xd9, 0x1a, 0x18, 0x10, 0x26, 0xab, 0xb9, 0x0d, 0xef, 0x1b, 0x0a,
+    0xaa, 0x10, 0xe9, 0xed, 0x1e, 0xee, 0xc2, 0xe5, 0x1e, 0xdc, 0x2b, 0x16, 0xd6, 0xd8, 0x32, 0xb3,
+    0x12, 0x0c, 0xa7, 0xcf, 0x4a, 0xd3, 0x2d, 0xfc, 0xdd, 0xc3, 0x3f, 0xf1, 0x31, 0x2f, 0xd3, 0xf8,
+    0x55, 0x2d, 0x3c, 0x41, 0x16, 0xba, 0x45, 0xd9, 0x35, 0xe8, 0xf7, 0xde, 0x50, 0xe1, 0x49, 0xec,
+    0xfe, 0xd5, 0x2c, 0xf2, 0x49, 0x1d, 0xc2, 0xee, 0x5b, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00, 0xb9, 0x22, 0x00, 0x00, 0x6b, 0x27, 0x00, 0x00, 0x6e, 0x0c, 0x00, 0x00,
+    0xec, 0x07, 0x00, 0x00, 0x2b, 0x06, 0x00, 0x00, 0x33, 0x0a, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00,
+    0xee, 0x05, 0x00, 0x00, 0x87, 0x0a, 0x00, 0x00, 0xb3, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00,
+    0x62, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2e, 0x13, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00,
+    0x3b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xcf, 0xfe, 0xff, 0xff, 0x5a, 0x10, 0x00, 0x00,
+    0xd1, 0x05, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00, 0x2e, 0xe8, 0xc6, 0x6e, 0x64, 0x3d, 0xd9, 0x79,
+    0xcb, 0xaf, 0x16, 0x67, 0x51, 0xd2, 0x1f, 0x45, 0x82, 0xae, 0xcb, 0x74, 0x09, 0xb0, 0x0a, 0x6c,
+    0xe6, 0x9d, 0x24, 0x6b, 0xe7, 0x3a, 0x48, 0x64, 0x7d, 0x16, 0xfa, 0x52, 0x64, 0x4b, 0x39, 0x54,
+    0x9d, 0x0e, 0x18, 0x5d, 0x30, 0x6b, 0xbf, 0x63, 0xde, 0x39, 0x77, 0x79, 0x7a, 0x30, 0x08, 0x43,
+    0x30, 0xf5, 0x07, 0x6f, 0xeb, 0x02, 0x68, 0x5f, 0xf2, 0x7c, 0x05, 0x68, 0x3b, 0x84, 0xc7, 0x4c,
+    0xd9, 0xa2, 0x66, 0x45, 0xac, 0xe6, 0x3e, 0x6c, 0xe7, 0x94, 0x94, 0x57, 0x66, 0x02, 0x16, 0x67,
+    0xf7, 0x53, 0xf2, 0x5d, 0x9a, 0xff, 0x70, 0x52, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09,
+    0x09, 0x08, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x01, 0x01, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00, 0x21, 0xbb, 0xba, 0xf3, 0xfd, 0x1b, 0x03, 0x01,
+    0xfb, 0x30, 0x17, 0x4e, 0x22, 0x1e, 0xd0, 0x41, 0xe4, 0xfb, 0x5c, 0x00, 0x7f, 0x4e, 0x64, 0x09,
+    0xc4, 0xf8, 0x1c, 0xf8, 0xf7, 0x20, 0x32, 0x7f, 0x00, 0xe7, 0x59, 0x54, 0xdb, 0xe8, 0x10, 0x34,
+    0x3c, 0x40, 0x28, 0xf5, 0x66, 0xef, 0x42, 0x46, 0x1d, 0x9a, 0x81, 0x39, 0x42, 0xf1, 0x14, 0x12,
+    0x14, 0xb6, 0x40, 0xdd, 0xa6, 0xa3, 0x32, 0x09, 0x58, 0x25, 0x02, 0xa4, 0xe9, 0x20, 0x04, 0x19,
+    0x16, 0x33, 0x1d, 0x2f, 0x2d, 0x0d, 0xda, 0xf2, 0xeb, 0x6e, 0xb4, 0x11, 0x7f, 0x6e, 0x19, 0x0e,
+    0x2f, 0xd1, 0x4d, 0x4a, 0x0a, 0xde, 0xb1, 0xe2, 0xe4, 0xb0, 0x9e, 0xd4, 0x12, 0x0f, 0x4c, 0x25,
+    0x1b, 0x0e, 0x3f, 0x45, 0xd8, 0x1f, 0x07, 0x72, 0xed, 0x29, 0x43, 0xd8, 0x7f, 0x51, 0x54, 0x1d,
+    0xdd, 0x04, 0xcb, 0xe6, 0xd9, 0xfb, 0x58, 0xdc, 0xe6, 0x11, 0x22, 0xc4, 0xef, 0xe5, 0xba, 0x21,
+    0x12, 0xff, 0xca, 0xc7, 0xbd, 0xbb, 0x81, 0xc4, 0x04, 0x3e, 0x38, 0x12, 0x34, 0x31, 0xdf, 0x19,
+    0x81, 0x4a, 0xe2, 0x21, 0x34, 0x18, 0x4f, 0xba, 0x18, 0xe2, 0x0d, 0x48, 0xab, 0x95, 0xac, 0xfd,
+    0x34, 0xfa, 0x27, 0xe8, 0x08, 0x10, 0x69, 0x5c, 0x33, 0x0a, 0x42, 0x38, 0x14, 0x22, 0xe2, 0x7f,
+    0xd8, 0x3f, 0x0e, 0xef, 0x4f, 0x09, 0x5e, 0x2d, 0x53, 0xac, 0xc4, 0xe8, 0x0f, 0x78, 0x7a, 0x69,
+    0x25, 0xeb, 0x7e, 0x25, 0xd7, 0xcc, 0x1f, 0x28, 0xd9, 0x49, 0xcd, 0xe8, 0x12, 0xb9, 0x35, 0x7f,
+    0x39, 0x39, 0x22, 0x08, 0x06, 0xce, 0xf5, 0xb3, 0x0f, 0x22, 0xb8, 0x81, 0x1a, 0x1d, 0xeb, 0xee,
+    0xd6, 0x00, 0xdf, 0x45, 0xd3, 0x2e, 0xe6, 0xd5, 0x20, 0x0d, 0xda, 0x2d, 0x15, 0xec, 0xcc, 0xb8,
+    0xef, 0x19, 0xbd, 0xcc, 0x1b, 0xfe, 0xff, 0xd9, 0x1e, 0xf2, 0x2c, 0x0c, 0x81, 0x1b, 0xd8, 0xe4,
+    0x25, 0x02, 0x1a, 0x2b, 0x1f, 0xda, 0x73, 0x6d, 0x7f, 0xa2, 0x4c, 0xcc, 0xe0, 0xb7, 0xf6, 0x4f,
+    0xe4, 0x6c, 0xdd, 0xc8, 0xf6, 0x48, 0x33, 0x23, 0x27, 0x16, 0xcc, 0x23, 0x1b, 0x4d, 0x9a, 0xab,
+    0xb7, 0x3b, 0xaa, 0xdf, 0x4e, 0x27, 0x39, 0x88, 0x3e, 0xcb, 0xf5, 0x2a, 0xa1, 0x11, 0x81, 0xfd,
+    0x73, 0x1c, 0x23, 0x7f, 0x38, 0xeb, 0x48, 0x11, 0x44, 0xd4, 0xe8, 0x83, 0xf2, 0xe1, 0xe3, 0xf4,
+    0xf5, 0x60, 0xd2, 0xe7, 0xc7, 0x72, 0x0e, 0x0c, 0x13, 0x94, 0xb7, 0xf4, 0xfa, 0x18, 0x57, 0x1f,
+    0x23, 0xaf, 0x65, 0x15, 0x81, 0xb0, 0x02, 0x37, 0x2d, 0x2c, 0xef, 0xa8, 0x20, 0x01, 0x3a, 0x4b,
+    0xe4, 0x3a, 0x03, 0x2d, 0x50, 0x56, 0xcd, 0x0c, 0xc8, 0xe5, 0x1b, 0xdc, 0xce, 0xbf, 0x7f, 0xc2,
+    0x6c, 0x4a, 0xe4, 0x15, 0xda, 0xe8, 0xc3, 0x30, 0xff, 0xfe, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00,
+    0x1a, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
+    0xcc, 0x02, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+    0x66, 0x01, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xd2, 0x03, 0x00, 0x00, 0x99, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd7, 0x02, 0x00, 0x00, 0x1b, 0x15, 0x58, 0x6d, 0x47, 0x1d, 0x67, 0x4d,
+    0xef, 0xd3, 0x51, 0x7c, 0xcb, 0xf0, 0x2e, 0x66, 0x6d, 0xfe, 0xe2, 0x73, 0x72, 0xa0, 0x86, 0x64,
+    0x6c, 0xbb, 0xf0, 0x78, 0x43, 0x54, 0x1c, 0x52, 0xab, 0xf1, 0x8e, 0x6d, 0x78, 0x67, 0xf0, 0x5e,
+    0x3d, 0xd8, 0xa8, 0x64, 0xc1, 0xa7, 0x8d, 0x77, 0x48, 0x73, 0xc8, 0x63, 0xd9, 0xc6, 0xe0, 0x66,
+    0xd1, 0x15, 0x82, 0x44, 0x18, 0xe4, 0x31, 0x65, 0x08, 0x07, 0x08, 0x08, 0x08, 0x09, 0x08, 0x07,
+    0x08, 0x07, 0x07, 0x08, 0x08, 0x08, 0x07, 0x08, 0x01, 0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0xe0, 0x1f, 0x3f, 0xca, 0x17, 0x12, 0xec, 0x13, 0x5b, 0xaa, 0xe7, 0x39, 0xe3, 0x10, 0x7f, 0x09,
+    0xeb, 0xa4, 0x9f, 0x01, 0x02, 0xf1, 0xbe, 0x2b, 0xe5, 0x4c, 0xf0, 0x35, 0x81, 0x27, 0xad, 0xa3,
+    0xb1, 0x27, 0xcd, 0x39, 0xe7, 0x0e, 0x46, 0xee, 0x16, 0xab, 0x90, 0xa8, 0x16, 0x81, 0xd8, 0x14,
+    0xc8, 0xa9, 0x2a, 0x1f, 0xcc, 0xed, 0x1c, 0x9d, 0x81, 0x33, 0x44, 0xe4, 0x2a, 0x0c, 0xad, 0x12,
+    0x51, 0x12, 0xc6, 0x40, 0x4d, 0xe9, 0xda, 0x2f, 0xe1, 0x97, 0xf5, 0xd3, 0x81, 0xba, 0xea, 0x89,
+    0xe3, 0xff, 0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00,
+    0xd3, 0xff, 0xff, 0xff, 0x36, 0xba, 0xcf, 0x76, 0x57, 0x9d, 0xd5, 0x5b, 0x94, 0x89, 0xcd, 0x65,
+    0x13, 0x17, 0xbf, 0x79, 0x61, 0x38, 0x11, 0x5b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,315 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Tiny int8 inference engine for learned gestures (flick, double tap,
+ * circle): a stack of fully connected layers over a sliding window of IMU
+ * frames, run straight from a model blob in flash (no copies, no heap).
+ *
+ * Blob layout (little-endian, every section 4-byte aligned): ModelHeader,
+ * then per layer a LayerHeader, int8 weights [outputs][inputs], int32 bias,
+ * int32 multiplier (Q31) and int8 right shift per output (padded to 4).
+ * Quantization is symmetric with zero point 0: acc = bias + sum(w * x),
+ * out = saturate((acc * mult) >> (31 + shift)), ReLU optional.
+ * tools/gesture_model/train.cpp trains the network and writes the blob.
+ * Pure and host-portable.
+ */
+namespace gesturenet {
+
+static constexpr uint32_t kMagic = 0x314E584Du;  // "MXN1"
+static constexpr uint16_t kVersion = 1;
+static constexpr int kChannels = 6;      // Linear accel xyz, gyro xyz
+static constexpr int kMaxFrames = 64;
+static constexpr int kMaxInputs = kMaxFrames * kChannels;
+static constexpr int kMaxWidth = 64;     // Hidden and output layers
+static constexpr int kMaxLayers = 4;
+static constexpr int kMaxClasses = 8;
+
+// Output classes, in model order
+enum class NetClass : uint8_t { Idle, FlickLeft, FlickRight, DoubleTap, Circle };
+static constexpr int kClasses = 5;
+
+struct ModelHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t layers;
+    uint8_t classes;
+    uint8_t frames;       // Window length
+    uint8_t channels;
+    uint8_t frameHz;      // Frames are averages of sampleHz / frameHz samples
+    uint8_t inputShift;   // int8 input = average raw LSB >> inputShift
+    uint32_t outScaleQ16; // Logit units per output LSB
+};
+
+enum : uint8_t { LayerDense = 1 };
+enum : uint8_t { LayerRelu = 0x01 };
+
+struct LayerHeader {
+    uint8_t type;
+    uint8_t flags;
+    uint16_t inputs;      // Multiple of 4
+    uint16_t outputs;
+    uint16_t reserved;
+};
+
+// A layer's view into the blob
+struct Layer {
+    const int8_t* weights;
+    const int32_t* bias;
+    const int32_t* mult;
+    const int8_t* shift;
+    uint16_t inputs;
+    uint16_t outputs;
+    bool relu;
+};
+
+struct Result {
+    NetClass label;
+    int16_t margin;              // Top logit minus the runner-up, output LSB
+    int8_t logits[kMaxClasses];
+};
+
+inline size_t align4(size_t n) { return (n + 3) & ~(size_t)3; }
+
+inline int8_t requantize(int32_t acc, int32_t mult, int8_t shift, bool relu) {
+    const int s = 31 + shift;
+    int32_t v = (int32_t)(((int64_t)acc * mult + ((int64_t)1 << (s - 1))) >> s);
+    if (relu && v < 0) v = 0;
+    return (int8_t)(v > 127 ? 127 : (v < -128 ? -128 : v));
+}
+
+// Hand-tuned kernel. Inputs are widened to int16 once per layer so the
+// inner loop is 16x16 MACs (single-cycle MUL16S on the LX6); two rows share
+// every input load and the loop is unrolled by 4.
+inline void dense(const Layer& layer, const int8_t* in, int8_t* out, int16_t* wide) {
+    const int n = layer.inputs;
+    for (int i = 0; i < n; i++) wide[i] = in[i];
+
+    int r = 0;
+    for (; r + 1 < layer.outputs; r += 2) {
+        const int8_t* w0 = layer.weights + r * n;
+        const int8_t* w1 = w0 + n;
+        int32_t acc0 = layer.bias[r], acc1 = layer.bias[r + 1];
+        for (int i = 0; i < n; i += 4) {
+            const int32_t x0 = wide[i], x1 = wide[i + 1], x2 = wide[i + 2], x3 = wide[i + 3];
+            acc0 += w0[i] * x0 + w0[i + 1] * x1 + w0[i + 2] * x2 + w0[i + 3] * x3;
+            acc1 += w1[i] * x0 + w1[i + 1] * x1 + w1[i + 2] * x2 + w1[i + 3] * x3;
+        }
+        out[r] = requantize(acc0, layer.mult[r], layer.shift[r], layer.relu);
+        out[r + 1] = requantize(acc1, layer.mult[r + 1], layer.shift[r + 1], layer.relu);
+    }
+    if (r < layer.outputs) {
+        const int8_t* w0 = layer.weights + r * n;
+        int32_t acc0 = layer.bias[r];
+        for (int i = 0; i < n; i += 4) {
+            acc0 += w0[i] * wide[i] + w0[i + 1] * wide[i + 1] + w0[i + 2] * wide[i + 2] + w0[i + 3] * wide[i + 3];
+        }
+        out[r] = requantize(acc0, layer.mult[r], layer.shift[r], layer.relu);
+    }
+}
+
+class Model {
+public:
+    // Validates the blob and points the layers into it; false leaves the model unusable
+    bool load(const uint8_t* blob, size_t length) {
+        m_valid = false;
+        m_macs = 0;
+        if (blob == nullptr || ((uintptr_t)blob & 3) != 0 || length < sizeof(ModelHeader)) return false;
+        memcpy(&m_header, blob, sizeof(ModelHeader));
+        const ModelHeader& h = m_header;
+        if (h.magic != kMagic || h.version != kVersion) return false;
+        if (h.layers == 0 || h.layers > kMaxLayers || h.classes < 2 || h.classes > kMaxClasses) return false;
+        if (h.channels != kChannels || h.frames == 0 || h.frames > kMaxFrames || h.frameHz == 0) return false;
+
+        size_t pos = sizeof(ModelHeader);
+        int width = h.frames * h.channels;
+        for (int l = 0; l < h.layers; l++) {
+            if (pos + sizeof(LayerHeader) > length) return false;
+            LayerHeader lh;
+            memcpy(&lh, blob + pos, sizeof(lh));
+            pos += sizeof(lh);
+            if (lh.type != LayerDense || lh.inputs != width || (lh.inputs & 3) != 0) return false;
+            if (lh.outputs == 0 || lh.outputs > kMaxWidth) return false;
+
+            Layer& layer = m_layers[l];
+            layer.inputs = lh.inputs;
+            layer.outputs = lh.outputs;
+            layer.relu = (lh.flags & LayerRelu) != 0;
+            const size_t weightBytes = (size_t)lh.inputs * lh.outputs;
+            const size_t rowBytes = (size_t)lh.outputs * 4;
+            if (pos + align4(weightBytes) + 2 * rowBytes + align4(lh.outputs) > length) return false;
+            layer.weights = reinterpret_cast<const int8_t*>(blob + pos);
+            pos += align4(weightBytes);
+            layer.bias = reinterpret_cast<const int32_t*>(blob + pos);
+            pos += rowBytes;
+            layer.mult = reinterpret_cast<const int32_t*>(blob + pos);
+            pos += rowBytes;
+            layer.shift = reinterpret_cast<const int8_t*>(blob + pos);
+            pos += align4(lh.outputs);
+            for (int r = 0; r < lh.outputs; r++) {
+                if (layer.shift[r] < -30 || layer.shift[r] > 31) return false;
+            }
+            m_macs += (uint32_t)weightBytes;
+            width = lh.outputs;
+        }
+        if (width != h.classes) return false;
+        m_valid = true;
+        return true;
+    }
+
+    bool valid() const { return m_valid; }
+    const ModelHeader& header() const { return m_header; }
+    int inputs() const { return m_header.frames * m_header.channels; }
+    uint32_t macs() const { return m_macs; }
+    const Layer& layer(int index) const { return m_layers[index]; }
+
+    // A logit margin (Q8) in output LSB, for Trigger
+    int16_t marginLsb(uint32_t logitsQ8) const {
+        return m_header.outScaleQ16 > 0 ? (int16_t)((logitsQ8 << 8) / m_header.outScaleQ16) : 0;
+    }
+
+    // `window` holds frames x channels int8 values, oldest frame first
+    void classify(const int8_t* window, Result& out) {
+        const int8_t* in = window;
+        int8_t* buf = m_bufA;
+        for (int l = 0; l < m_header.layers; l++) {
+            dense(m_layers[l], in, buf, m_wide);
+            in = buf;
+            buf = buf == m_bufA ? m_bufB : m_bufA;
+        }
+        int best = 0, second = -1;
+        for (int c = 0; c < m_header.classes; c++) {
+            out.logits[c] = in[c];
+            if (c == 0) continue;
+            if (in[c] > in[best]) {
+                second = best;
+                best = c;
+            } else if (second < 0 || in[c] > in[second]) {
+                second = c;
+            }
+        }
+        out.label = static_cast<NetClass>(best);
+        out.margin = (int16_t)(in[best] - in[second]);
+    }
+
+private:
+    ModelHeader m_header = {};
+    Layer m_layers[kMaxLayers] = {};
+    bool m_valid = false;
+    uint32_t m_macs = 0;
+    int16_t m_wide[kMaxInputs];
+    int8_t m_bufA[kMaxWidth];
+    int8_t m_bufB[kMaxWidth];
+};
+
+/**
+ * Front end: averages the sensor-rate stream into frames (linear
+ * acceleration = raw minus fused gravity, and raw gyro), scaled to int8,
+ * and keeps the last `frames` of them. Still windows are flagged so the
+ * caller can skip inference entirely.
+ */
+class Window {
+public:
+    void configure(const ModelHeader& header, uint32_t sampleHz, int32_t activeLevel = 6) {
+        m_frames = header.frames;
+        m_shift = header.inputShift;
+        m_decimate = header.frameHz > 0 && sampleHz > header.frameHz ? sampleHz / header.frameHz : 1;
+        m_activeLevel = activeLevel;
+        reset();
+    }
+
+    void reset() {
+        memset(m_ring, 0, sizeof(m_ring));
+        memset(m_sum, 0, sizeof(m_sum));
+        m_phase = 0;
+        m_count = 0;
+        m_lastActive = 0;
+        m_anyActive = false;
+    }
+
+    // One sensor sample; true when it completed a frame
+    bool add(const int16_t linear[3], const int16_t gyro[3]) {
+        for (int a = 0; a < 3; a++) {
+            m_sum[a] += linear[a];
+            m_sum[3 + a] += gyro[a];
+        }
+        if (++m_phase < m_decimate) return false;
+
+        const int32_t div = (int32_t)m_decimate << m_shift;
+        int8_t* frame = m_ring[m_count % kMaxFrames];
+        int32_t energy = 0;
+        for (int c = 0; c < kChannels; c++) {
+            int32_t v = m_sum[c] / div;
+            v = v > 127 ? 127 : (v < -127 ? -127 : v);
+            frame[c] = (int8_t)v;
+            if (c < 3) energy += v < 0 ? -v : v;
+            m_sum[c] = 0;
+        }
+        m_phase = 0;
+        m_count++;
+        if (energy >= m_activeLevel) {
+            m_lastActive = m_count;
+            m_anyActive = true;
+        }
+        return true;
+    }
+
+    // Frames completed so far
+    uint32_t count() const { return m_count; }
+    bool full() const { return m_count >= m_frames; }
+
+    // Some frame in the current window moved
+    bool active() const { return m_anyActive && m_count - m_lastActive < m_frames; }
+
+    // Oldest frame first; frames x channels bytes
+    void copy(int8_t* out) const {
+        for (uint32_t f = 0; f < m_frames; f++) {
+            memcpy(out + f * kChannels, m_ring[(m_count - m_frames + f) % kMaxFrames], kChannels);
+        }
+    }
+
+private:
+    int8_t m_ring[kMaxFrames][kChannels];
+    int32_t m_sum[kChannels] = {};
+    uint32_t m_frames = 0;
+    uint32_t m_decimate = 1;
+    uint8_t m_shift = 0;
+    int32_t m_activeLevel = 6;
+    uint32_t m_phase = 0;
+    uint32_t m_count = 0;
+    uint32_t m_lastActive = 0;
+    bool m_anyActive = false;
+};
+
+/**
+ * Turns per-window results into events: a non-idle class must win by
+ * `minMargin`, and the same gesture is not reported again until the
+ * window has slid past it.
+ */
+class Trigger {
+public:
+    Trigger() {}
+    Trigger(int16_t minMargin, uint32_t refractoryFrames)
+        : m_minMargin(minMargin), m_refractory(refractoryFrames) {}
+
+    // `frame` is the window's newest frame number
+    bool accept(const Result& r, uint32_t frame) {
+        if (r.label == NetClass::Idle || r.margin < m_minMargin) return false;
+        if (m_fired && frame - m_lastFrame < m_refractory) return false;
+        m_fired = true;
+        m_lastFrame = frame;
+        return true;
+    }
+
+    void reset() { m_fired = false; }
+
+private:
+    int16_t m_minMargin = 0;
+    uint32_t m_refractory = 0;
+    bool m_fired = false;
+    uint32_t m_lastFrame = 0;
+};
+
+}  // namespace gesturenet
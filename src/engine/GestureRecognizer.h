@@ -0,0 +1,210 @@
+#pragma once
+#include <stdint.h>
+#include "SpscQueue.h"
+
+// Panel-relative tilt direction: Left/Right along X (10 px), Up/Down along Y (16 px)
+enum class TiltDir : uint8_t { None, Left, Right, Up, Down };
+
+enum class GestureType : uint8_t {
+    Tilt,       // Tilt direction changed (dir; None = back to level)
+    TiltHold,   // Same direction held for holdMs (once per hold)
+    Shake,      // Sustained back-and-forth motion started
+    ShakeEnd,   // ... and has stopped
+    Tap,        // Single short knock
+    FaceDown,   // Turned face down (held for faceDownMs)
+    FaceUp,     // No longer face down
+    // From the learned classifier (GestureClassifier), not this recognizer
+    Flick,      // Quick flick and stop (dir Left / Right)
+    DoubleTap,  // Two knocks on the panel face
+    Circle,     // Board moved once round a circle
+};
+
+struct Gesture {
+    GestureType type;
+    TiltDir dir;  // Tilt / TiltHold / Flick only
+};
+
+/**
+ * @brief Turns the fused sensor stream into debounced gesture events, once
+ * per sample, so modes subscribe instead of re-thresholding accX/accY in
+ * every loop(). Tilt uses enter/exit thresholds (hysteresis) on the
+ * calibrated gravity tilt. Shake and tap look at linear acceleration (raw
+ * accel minus the fused gravity), so leaning never reads as motion.
+ * Pure and host-portable; times are sample timestamps in microseconds.
+ */
+class GestureRecognizer {
+public:
+    struct Thresholds {
+        int32_t tiltEnter = 3000;     // LSB of calibrated tilt (16384 = 1 g)
+        int32_t tiltExit = 2000;
+        uint32_t holdMs = 2000;
+        int32_t motionLsb = 6000;     // |linear accel| (L1, LSB) counted as a jolt
+        uint8_t shakeJolts = 4;       // Jolts inside shakeWindowMs that make a shake
+        uint32_t shakeWindowMs = 1000;
+        uint32_t shakeQuietMs = 400;  // No jolt for this long ends a shake
+        uint32_t tapMaxMs = 40;       // A tap's jolt is shorter than this ...
+        uint32_t tapQuietMs = 150;    // ... and followed by this much quiet
+        int32_t faceDownZ = -12000;   // Gravity Z (Q14) to enter / leave face-down
+        int32_t faceUpZ = -8000;
+        uint32_t faceDownMs = 500;
+    };
+
+    GestureRecognizer() {}
+    explicit GestureRecognizer(const Thresholds& t) : m_t(t) {}
+
+    // One fused sample: calibrated panel tilt, raw accel and fused gravity (both Q14)
+    void update(uint32_t tUs, int32_t tiltX, int32_t tiltY, const int16_t accel[3], const int16_t gravity[3]) {
+        updateTilt(tUs, tiltX, tiltY);
+        updateMotion(tUs, accel, gravity);
+        updateFace(tUs, gravity[2]);
+    }
+
+    // Returns true and fills `gesture` while events are pending
+    bool poll(Gesture& gesture) { return m_events.pop(gesture); }
+
+    // Current debounced state, for modes that act while a tilt is held
+    TiltDir tilt() const { return m_dir; }
+    bool shaking() const { return m_shaking; }
+    bool faceDown() const { return m_faceDown; }
+
+    uint32_t count(GestureType type) const { return m_counts[static_cast<int>(type)]; }
+    uint32_t dropped() const { return m_events.dropped(); }
+
+    // Drops pending events and held state (mode switch); the next sample
+    // re-reports the current tilt to the new mode
+    void reset() {
+        Gesture stale;
+        while (m_events.pop(stale)) {}
+        m_dir = TiltDir::None;
+        m_holdSent = false;
+        m_joltCount = 0;
+        m_inJolt = false;
+        m_tapPending = false;
+        m_shaking = false;  // The new mode never saw the Shake, so no ShakeEnd either
+    }
+
+private:
+    static constexpr int kTypes = static_cast<int>(GestureType::Circle) + 1;
+
+    static int32_t absl(int32_t v) { return v < 0 ? -v : v; }
+    static uint32_t usFromMs(uint32_t ms) { return ms * 1000UL; }
+
+    void emit(GestureType type, TiltDir dir = TiltDir::None) {
+        Gesture g = { type, dir };
+        m_events.push(g);
+        m_counts[static_cast<int>(type)]++;
+    }
+
+    // Dominant axis wins. The current direction holds until it drops below
+    // exit, and only gives way to another direction that has crossed enter.
+    TiltDir classify(int32_t x, int32_t y) const {
+        const TiltDir strongest = absl(x) >= absl(y) ? (x < 0 ? TiltDir::Left : TiltDir::Right)
+                                                     : (y < 0 ? TiltDir::Up : TiltDir::Down);
+        const bool entered = dirValue(strongest, x, y) > m_t.tiltEnter;
+        if (m_dir != TiltDir::None && dirValue(m_dir, x, y) > m_t.tiltExit) {
+            return strongest != m_dir && entered ? strongest : m_dir;
+        }
+        return entered ? strongest : TiltDir::None;
+    }
+
+    static int32_t dirValue(TiltDir dir, int32_t x, int32_t y) {
+        switch (dir) {
+            case TiltDir::Left:  return -x;
+            case TiltDir::Right: return x;
+            case TiltDir::Up:    return -y;
+            case TiltDir::Down:  return y;
+            default:             return 0;
+        }
+    }
+
+    void updateTilt(uint32_t tUs, int32_t x, int32_t y) {
+        const TiltDir dir = classify(x, y);
+        if (dir != m_dir) {
+            m_dir = dir;
+            m_dirSinceUs = tUs;
+            m_holdSent = false;
+            emit(GestureType::Tilt, dir);
+        } else if (dir != TiltDir::None && !m_holdSent && tUs - m_dirSinceUs >= usFromMs(m_t.holdMs)) {
+            m_holdSent = true;
+            emit(GestureType::TiltHold, dir);
+        }
+    }
+
+    void updateMotion(uint32_t tUs, const int16_t accel[3], const int16_t gravity[3]) {
+        const int32_t linear = absl(accel[0] - gravity[0]) + absl(accel[1] - gravity[1]) + absl(accel[2] - gravity[2]);
+        const bool jolt = linear > m_t.motionLsb;
+
+        if (jolt && !m_inJolt) {
+            // Rising edge: one jolt
+            m_inJolt = true;
+            m_joltStartUs = tUs;
+            if (m_joltCount == 0 || tUs - m_firstJoltUs > usFromMs(m_t.shakeWindowMs)) {
+                m_joltCount = 0;
+                m_firstJoltUs = tUs;
+            }
+            m_joltCount++;
+            if (!m_shaking && m_joltCount >= m_t.shakeJolts) {
+                m_shaking = true;
+                m_tapPending = false;
+                emit(GestureType::Shake);
+            }
+            if (m_tapPending) m_tapPending = false;  // Second knock: not a single tap
+            else if (!m_shaking) m_tapCandidate = true;
+        } else if (!jolt && m_inJolt) {
+            m_inJolt = false;
+            m_lastJoltEndUs = tUs;
+            if (m_tapCandidate && tUs - m_joltStartUs <= usFromMs(m_t.tapMaxMs)) m_tapPending = true;
+            m_tapCandidate = false;
+        }
+        if (m_inJolt) m_lastJoltEndUs = tUs;
+
+        if (m_tapPending && !m_inJolt && tUs - m_lastJoltEndUs >= usFromMs(m_t.tapQuietMs)) {
+            m_tapPending = false;
+            if (!m_shaking) emit(GestureType::Tap);
+        }
+        if (m_shaking && !m_inJolt && tUs - m_lastJoltEndUs >= usFromMs(m_t.shakeQuietMs)) {
+            m_shaking = false;
+            m_joltCount = 0;
+            emit(GestureType::ShakeEnd);
+        }
+    }
+
+    void updateFace(uint32_t tUs, int16_t gravityZ) {
+        if (!m_faceDown) {
+            if (gravityZ > m_t.faceDownZ) {
+                m_faceDownArmed = false;
+            } else if (!m_faceDownArmed) {
+                m_faceDownArmed = true;
+                m_faceDownSinceUs = tUs;
+            } else if (tUs - m_faceDownSinceUs >= usFromMs(m_t.faceDownMs)) {
+                m_faceDown = true;
+                emit(GestureType::FaceDown);
+            }
+        } else if (gravityZ > m_t.faceUpZ) {
+            m_faceDown = false;
+            m_faceDownArmed = false;
+            emit(GestureType::FaceUp);
+        }
+    }
+
+    Thresholds m_t;
+    SpscQueue<Gesture, 16> m_events;
+    uint32_t m_counts[kTypes] = {};
+
+    TiltDir m_dir = TiltDir::None;
+    uint32_t m_dirSinceUs = 0;
+    bool m_holdSent = false;
+
+    bool m_inJolt = false;
+    bool m_shaking = false;
+    bool m_tapCandidate = false;
+    bool m_tapPending = false;
+    uint8_t m_joltCount = 0;
+    uint32_t m_joltStartUs = 0;
+    uint32_t m_firstJoltUs = 0;
+    uint32_t m_lastJoltEndUs = 0;
+
+    bool m_faceDown = false;
+    bool m_faceDownArmed = false;
+    uint32_t m_faceDownSinceUs = 0;
+};
@@ -0,0 +1,532 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LifeGrid.h"
+
+/**
+ * @brief HashLife: Life-like rules on a 2^30 x 2^30 universe as a memoized
+ * quadtree. Equal subtrees are one shared node (hash-consed), and every
+ * node caches its centre advanced 2^min(step, level - 2) generations, so
+ * regular patterns advance 2^step generations per step() at a cost that
+ * grows with the pattern's variety, not its size or age. Leaves are 8x8
+ * bitmaps; the 16x16 base case runs on LifeGrid's bit-sliced kernel.
+ *
+ * Nodes live in a fixed pool allocated by begin(). Between steps, a pool
+ * past 3/4 full is collected: nodes unreachable from the universe are
+ * freed, then, if that is not enough, the cached results are evicted too.
+ * A step that still runs out of nodes is redone with an empty cache and,
+ * failing that, at half the step size (stats().stepDrops). Pure and
+ * host-portable; rules with B0 are not supported.
+ */
+class HashLife {
+public:
+    typedef uint16_t NodeId;
+    static constexpr NodeId kNone = 0xFFFF;
+    static constexpr uint32_t kMaxNodes = 0xFFFF;
+    static constexpr uint32_t kMinNodes = 256;
+    static constexpr int kLeafLevel = 3;   // 8x8 cells
+    static constexpr int kMaxLevel = 30;   // Universe is [-2^29, 2^29) on both axes
+    static constexpr int kMaxStepLog2 = kMaxLevel - 3;
+
+    struct Stats {
+        uint32_t joins = 0, joinHits = 0;      // Hash-consing lookups
+        uint32_t results = 0, resultHits = 0;  // Memoized successor lookups
+        uint32_t collections = 0;
+        uint32_t evictions = 0;                // Collections that also dropped the result cache
+        uint32_t overflows = 0;                // Steps redone after the pool ran out
+        uint32_t stepDrops = 0;                // ... that had to halve the step size
+    };
+
+    HashLife() {}
+    ~HashLife() { release(); }
+    HashLife(const HashLife&) = delete;
+    HashLife& operator=(const HashLife&) = delete;
+
+    // Pool of `capacity` nodes (clamped to kMinNodes..kMaxNodes); false if out of memory
+    bool begin(uint32_t capacity) {
+        release();
+        capacity = capacity < kMinNodes ? kMinNodes : (capacity > kMaxNodes ? kMaxNodes : capacity);
+        m_buckets = buckets(capacity);
+        m_nodes = static_cast<Node*>(malloc(sizeof(Node) * capacity));
+        m_table = static_cast<NodeId*>(malloc(sizeof(NodeId) * m_buckets));
+        if (m_nodes == nullptr || m_table == nullptr) {
+            release();
+            return false;
+        }
+        m_capacity = capacity;
+        m_stats = Stats();
+        clear();
+        return true;
+    }
+
+    void release() {
+        free(m_nodes);
+        free(m_table);
+        m_nodes = nullptr;
+        m_table = nullptr;
+        m_capacity = 0;
+        m_used = 0;
+    }
+
+    static size_t bytesFor(uint32_t capacity) {
+        return sizeof(Node) * capacity + sizeof(NodeId) * buckets(capacity);
+    }
+
+    bool ready() const { return m_nodes != nullptr; }
+    uint32_t capacity() const { return m_capacity; }
+    uint32_t used() const { return m_used; }
+    size_t bytes() const { return ready() ? bytesFor(m_capacity) : 0; }
+    const Stats& stats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+    // Empties the universe and the pool
+    void clear() {
+        if (!ready()) return;
+        for (uint32_t i = 0; i < m_buckets; i++) m_table[i] = kNone;
+        m_free = kNone;
+        for (uint32_t id = m_capacity; id-- > 0;) {
+            m_nodes[id].level = kFreeLevel;
+            m_nodes[id].next = m_free;
+            m_free = (NodeId)id;
+        }
+        m_used = 0;
+        m_overflow = false;
+        m_empty[kLeafLevel] = leaf(0);
+        for (int level = kLeafLevel + 1; level <= kMaxLevel; level++) {
+            const NodeId e = m_empty[level - 1];
+            m_empty[level] = join(e, e, e, e);
+        }
+        m_root = m_empty[kMinRootLevel];
+        m_generation = 0;
+    }
+
+    // False for B0 rules (an empty universe would not stay empty)
+    bool setRule(const LifeRule& rule) {
+        if (rule.birth & 1) return false;
+        m_rule = rule;
+        dropResults();
+        return true;
+    }
+    const LifeRule& rule() const { return m_rule; }
+
+    // step() advances 2^stepLog2 generations
+    void setStepLog2(int stepLog2) {
+        stepLog2 = stepLog2 < 0 ? 0 : (stepLog2 > kMaxStepLog2 ? kMaxStepLog2 : stepLog2);
+        if (stepLog2 == m_stepLog2) return;
+        m_stepLog2 = stepLog2;
+        dropResults();  // Cached results are for the old step size
+    }
+    int stepLog2() const { return m_stepLog2; }
+
+    uint64_t generation() const { return m_generation; }
+    uint32_t population() const { return ready() ? m_nodes[m_root].population : 0; }
+    int rootLevel() const { return ready() ? m_nodes[m_root].level : 0; }
+
+    // False if the cell is outside the universe or the pool is full
+    bool setCell(int32_t x, int32_t y, bool alive) {
+        if (!ready() || x < -kHalfMax || x >= kHalfMax || y < -kHalfMax || y >= kHalfMax) return false;
+        if (!reserve(2 * (kMaxLevel + 2))) return false;
+        while (!contains(x, y)) expand();
+        const int level = m_nodes[m_root].level;
+        const int32_t half = (int32_t)1 << (level - 1);
+        m_root = set(m_root, level, x + half, y + half, alive);
+        return true;
+    }
+
+    bool cell(int32_t x, int32_t y) const {
+        if (!ready() || !contains(x, y)) return false;
+        NodeId id = m_root;
+        int level = m_nodes[id].level;
+        const int32_t half = (int32_t)1 << (level - 1);
+        const uint32_t ux = (uint32_t)(x + half), uy = (uint32_t)(y + half);
+        while (level > kLeafLevel && m_nodes[id].population != 0) {
+            level--;
+            id = child(id, ((uy >> level) & 1) * 2 + ((ux >> level) & 1));
+        }
+        return (leafRow(id, uy & 7) >> (ux & 7)) & 1;
+    }
+
+    // Run-length encoded pattern ("bo$2bo$3o!"; '#' and "x = ..." lines are
+    // skipped) with its top-left cell at (x, y). False on a bad character or
+    // when the pool fills up.
+    bool loadRle(const char* rle, int32_t x, int32_t y) {
+        int32_t cx = x, cy = y;
+        int32_t run = 0;
+        for (const char* p = rle; *p != '\0' && *p != '!'; p++) {
+            if ((*p == '#' || *p == 'x') && (p == rle || p[-1] == '\n')) {
+                while (*p != '\0' && *p != '\n') p++;
+                if (*p == '\0') break;
+                continue;
+            }
+            if (*p >= '0' && *p <= '9') {
+                run = run * 10 + (*p - '0');
+                continue;
+            }
+            const int32_t n = run > 0 ? run : 1;
+            run = 0;
+            if (*p == 'b' || *p == '.') {
+                cx += n;
+            } else if (*p == 'o' || *p == 'O') {
+                for (int32_t i = 0; i < n; i++) {
+                    if (!setCell(cx++, cy, true)) return false;
+                }
+            } else if (*p == '$') {
+                cy += n;
+                cx = x;
+            } else if (*p != '\n' && *p != '\r' && *p != ' ') {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Cells [x0, x0 + width) x [y0, y0 + height) as row words: rows[y] bit x.
+    // width <= 32.
+    void window(int32_t x0, int32_t y0, int width, int height, uint32_t* rows) const {
+        for (int y = 0; y < height; y++) rows[y] = 0;
+        if (!ready()) return;
+        const int level = m_nodes[m_root].level;
+        const int32_t half = (int32_t)1 << (level - 1);
+        Window w = { (int64_t)x0, (int64_t)y0, width, height, rows };
+        fill(w, m_root, level, -(int64_t)half, -(int64_t)half);
+    }
+
+    // Advances 2^stepLog2() generations (less only if the pool is too small;
+    // see stats().stepDrops). False when the pattern no longer fits at all.
+    bool step() {
+        if (!ready()) return false;
+        if (m_used > m_capacity / 4 * 3) collect(true);
+        if (m_used > m_capacity / 4 * 3) collect(false);
+        if (!reserve(8 * kMaxLevel)) return false;  // Padding the root must not overflow
+
+        int stepLog2 = m_stepLog2;
+        for (int attempt = 0; ; attempt++) {
+            const NodeId saved = m_root;
+            pad(stepLog2);
+            m_overflow = false;
+            const NodeId next = successor(m_root, stepLog2);
+            if (!m_overflow) {
+                m_root = next;
+                break;
+            }
+            // Out of nodes: retry with the cache evicted, then with smaller steps
+            m_root = saved;
+            m_stats.overflows++;
+            collect(false);
+            if (attempt == 0) continue;
+            if (stepLog2 == 0) return false;
+            m_stepLog2 = --stepLog2;  // The cache is empty, so nothing is stale
+            m_stats.stepDrops++;
+        }
+        m_generation += (uint64_t)1 << stepLog2;
+        shrink();
+        return true;
+    }
+
+    // Frees nodes unreachable from the universe; keepResults = false also
+    // evicts every cached result (and whatever only they referenced)
+    void collect(bool keepResults) {
+        if (!ready()) return;
+        m_stats.collections++;
+        if (!keepResults) m_stats.evictions++;
+        for (uint32_t id = 0; id < m_capacity; id++) m_nodes[id].mark = 0;
+        mark(m_root, keepResults);
+        for (int level = kLeafLevel; level <= kMaxLevel; level++) mark(m_empty[level], keepResults);
+
+        for (uint32_t i = 0; i < m_buckets; i++) m_table[i] = kNone;
+        m_free = kNone;
+        m_used = 0;
+        for (uint32_t id = m_capacity; id-- > 0;) {
+            Node& n = m_nodes[id];
+            if (n.level != kFreeLevel && n.mark) {
+                if (!keepResults) n.result = kNone;
+                const uint32_t b = bucket(n.level, n.child);
+                n.next = m_table[b];
+                m_table[b] = (NodeId)id;
+                m_used++;
+            } else {
+                n.level = kFreeLevel;
+                n.next = m_free;
+                m_free = (NodeId)id;
+            }
+        }
+    }
+
+private:
+    static constexpr uint8_t kFreeLevel = 0xFF;
+    static constexpr int kMinRootLevel = kLeafLevel + 2;  // Grandchildren are whole leaves
+    static constexpr int32_t kHalfMax = (int32_t)1 << (kMaxLevel - 1);
+
+    // Inner nodes hold their quadrants (nw, ne, sw, se); leaves hold their
+    // 8x8 cells in the same four words, two rows of 8 bits per word
+    struct Node {
+        NodeId child[4];
+        NodeId next;        // Hash chain, or free list
+        NodeId result;      // Memoized successor
+        uint32_t population;
+        uint8_t level;
+        uint8_t mark;
+    };
+
+    struct Window {
+        int64_t x0, y0;
+        int width, height;
+        uint32_t* rows;
+    };
+
+    static uint32_t buckets(uint32_t capacity) {
+        uint32_t n = 1;
+        while (n < capacity) n <<= 1;
+        return n;
+    }
+
+    uint32_t bucket(int level, const NodeId* key) const {
+        uint32_t h = ((((uint32_t)key[0] * 0x9E3779B1u + key[1]) * 0x85EBCA77u + key[2]) * 0xC2B2AE3Du + key[3]) ^
+                     ((uint32_t)level << 27);
+        h ^= h >> 15;
+        h *= 0x2C1B3C6Du;
+        h ^= h >> 13;
+        return h & (m_buckets - 1);
+    }
+
+    // The unique node with this level and key. When the pool is exhausted it
+    // flags m_overflow and returns the empty node so the caller can unwind.
+    NodeId intern(int level, const NodeId* key, uint32_t population) {
+        m_stats.joins++;
+        const uint32_t b = bucket(level, key);
+        for (NodeId id = m_table[b]; id != kNone; id = m_nodes[id].next) {
+            const Node& n = m_nodes[id];
+            if (n.level == level && memcmp(n.child, key, sizeof(n.child)) == 0) {
+                m_stats.joinHits++;
+                return id;
+            }
+        }
+        if (m_free == kNone) {
+            m_overflow = true;
+            return m_empty[level];
+        }
+        const NodeId id = m_free;
+        Node& n = m_nodes[id];
+        m_free = n.next;
+        memcpy(n.child, key, sizeof(n.child));
+        n.result = kNone;
+        n.population = population;
+        n.level = (uint8_t)level;
+        n.mark = 0;
+        n.next = m_table[b];
+        m_table[b] = id;
+        m_used++;
+        return id;
+    }
+
+    NodeId join(NodeId nw, NodeId ne, NodeId sw, NodeId se) {
+        const NodeId key[4] = { nw, ne, sw, se };
+        const uint64_t population = (uint64_t)m_nodes[nw].population + m_nodes[ne].population +
+                                    m_nodes[sw].population + m_nodes[se].population;
+        return intern(m_nodes[nw].level + 1, key, population > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)population);
+    }
+
+    // Leaf from eight rows of 8 cells (row y in bits 8y..8y+7)
+    NodeId leaf(uint64_t cells) {
+        const NodeId key[4] = { (NodeId)cells, (NodeId)(cells >> 16), (NodeId)(cells >> 32), (NodeId)(cells >> 48) };
+        uint32_t population = 0;
+        for (uint64_t v = cells; v != 0; v &= v - 1) population++;
+        return intern(kLeafLevel, key, population);
+    }
+
+    uint32_t leafRow(NodeId id, int y) const { return (m_nodes[id].child[y >> 1] >> ((y & 1) * 8)) & 0xFF; }
+    NodeId child(NodeId id, int q) const { return m_nodes[id].child[q]; }
+
+    // Level-(k-1) nodes straddling two or four level-(k-1) quadrants
+    NodeId horizontal(NodeId w, NodeId e) {
+        return join(child(w, 1), child(e, 0), child(w, 3), child(e, 2));
+    }
+    NodeId vertical(NodeId n, NodeId s) {
+        return join(child(n, 2), child(n, 3), child(s, 0), child(s, 1));
+    }
+    NodeId centre(NodeId nw, NodeId ne, NodeId sw, NodeId se) {
+        if (m_nodes[nw].level > kLeafLevel) return join(child(nw, 3), child(ne, 2), child(sw, 1), child(se, 0));
+        uint64_t cells = 0;
+        for (int y = 0; y < 8; y++) {
+            const NodeId w = y < 4 ? nw : sw, e = y < 4 ? ne : se;
+            const int src = (y + 4) & 7;
+            cells |= (uint64_t)((leafRow(w, src) >> 4) | ((leafRow(e, src) & 0x0F) << 4)) << (8 * y);
+        }
+        return leaf(cells);
+    }
+
+    // Centre (level k-1) of a level-k node, 2^min(stepLog2, k-2) generations on
+    NodeId successor(NodeId id, int stepLog2) {
+        const Node& n = m_nodes[id];
+        const int level = n.level;
+        if (n.population == 0) return m_empty[level - 1];
+        m_stats.results++;
+        if (n.result != kNone) {
+            m_stats.resultHits++;
+            return n.result;
+        }
+        if (m_overflow) return m_empty[level - 1];
+
+        NodeId r;
+        if (level == kLeafLevel + 1) {
+            r = base(id, stepLog2 < 2 ? 1 << stepLog2 : 4);
+        } else {
+            const NodeId a = n.child[0], b = n.child[1], c = n.child[2], d = n.child[3];
+            const NodeId c1 = successor(a, stepLog2);
+            const NodeId c2 = successor(horizontal(a, b), stepLog2);
+            const NodeId c3 = successor(b, stepLog2);
+            const NodeId c4 = successor(vertical(a, c), stepLog2);
+            const NodeId c5 = successor(centre(a, b, c, d), stepLog2);
+            const NodeId c6 = successor(vertical(b, d), stepLog2);
+            const NodeId c7 = successor(c, stepLog2);
+            const NodeId c8 = successor(horizontal(c, d), stepLog2);
+            const NodeId c9 = successor(d, stepLog2);
+            if (stepLog2 < level - 2) {
+                // Partial step: the nine already moved 2^stepLog2; just re-centre
+                r = join(centre(c1, c2, c4, c5), centre(c2, c3, c5, c6),
+                         centre(c4, c5, c7, c8), centre(c5, c6, c8, c9));
+            } else {
+                // Full step: a second round of 2^(k-3) on the four overlapping quarters
+                r = join(successor(join(c1, c2, c4, c5), stepLog2), successor(join(c2, c3, c5, c6), stepLog2),
+                         successor(join(c4, c5, c7, c8), stepLog2), successor(join(c5, c6, c8, c9), stepLog2));
+            }
+        }
+        if (m_overflow) return m_empty[level - 1];  // r may hold placeholders; never cache it
+        m_nodes[id].result = r;
+        return r;
+    }
+
+    // 16x16 cells -> the centre 8x8 `generations` (<= 4) on. Cells past the
+    // block edge read as dead, which cannot reach the centre in time.
+    NodeId base(NodeId id, int generations) {
+        uint32_t a[16], b[16];
+        for (int y = 0; y < 8; y++) {
+            a[y] = leafRow(child(id, 0), y) | (leafRow(child(id, 1), y) << 8);
+            a[y + 8] = leafRow(child(id, 2), y) | (leafRow(child(id, 3), y) << 8);
+        }
+        uint32_t* cur = a;
+        uint32_t* next = b;
+        for (int g = 0; g < generations; g++) {
+            LifeGrid::advance(cur, next, 16, 16, false, m_rule);
+            uint32_t* t = cur;
+            cur = next;
+            next = t;
+        }
+        uint64_t cells = 0;
+        for (int y = 0; y < 8; y++) cells |= (uint64_t)((cur[y + 4] >> 4) & 0xFF) << (8 * y);
+        return leaf(cells);
+    }
+
+    bool contains(int32_t x, int32_t y) const {
+        const int32_t half = (int32_t)1 << (m_nodes[m_root].level - 1);
+        return x >= -half && x < half && y >= -half && y < half;
+    }
+
+    // True when everything alive lies in the centre half of the root
+    bool centred() const {
+        const Node& n = m_nodes[m_root];
+        uint32_t inner = 0;
+        for (int q = 0; q < 4; q++) inner += m_nodes[child(n.child[q], 3 - q)].population;
+        return inner == n.population;
+    }
+
+    // One level up, same centre. No-op at kMaxLevel, where the universe ends.
+    void expand() {
+        const Node& n = m_nodes[m_root];
+        if (n.level >= kMaxLevel) return;
+        const NodeId e = m_empty[n.level - 1];
+        const NodeId a = n.child[0], b = n.child[1], c = n.child[2], d = n.child[3];
+        m_root = join(join(e, e, e, a), join(e, e, b, e), join(e, c, e, e), join(d, e, e, e));
+    }
+
+    // Root big enough that nothing can leave the successor's area in 2^stepLog2 generations
+    void pad(int& stepLog2) {
+        while (m_nodes[m_root].level < kMaxLevel &&
+               (m_nodes[m_root].level < stepLog2 + 2 || !centred())) {
+            expand();
+        }
+        expand();
+        const int level = m_nodes[m_root].level;
+        if (stepLog2 > level - 2) stepLog2 = level - 2;
+    }
+
+    // Drops empty border levels so the root stays small
+    void shrink() {
+        while (m_nodes[m_root].level > kMinRootLevel && centred() && m_free != kNone) {
+            const Node& n = m_nodes[m_root];
+            m_root = centre(n.child[0], n.child[1], n.child[2], n.child[3]);
+        }
+    }
+
+    // Makes sure `count` nodes are free (collecting if need be)
+    bool reserve(uint32_t count) {
+        if (m_capacity - m_used >= count) return true;
+        collect(true);
+        if (m_capacity - m_used >= count) return true;
+        collect(false);
+        return m_capacity - m_used >= count;
+    }
+
+    NodeId set(NodeId id, int level, int32_t x, int32_t y, bool alive) {
+        if (level == kLeafLevel) {
+            uint64_t cells = 0;
+            for (int row = 0; row < 8; row++) cells |= (uint64_t)leafRow(id, row) << (8 * row);
+            const uint64_t bit = (uint64_t)1 << (y * 8 + x);
+            return leaf(alive ? cells | bit : cells & ~bit);
+        }
+        const int32_t half = (int32_t)1 << (level - 1);
+        const int q = (y >= half ? 2 : 0) + (x >= half ? 1 : 0);
+        NodeId quads[4] = { child(id, 0), child(id, 1), child(id, 2), child(id, 3) };
+        quads[q] = set(quads[q], level - 1, x & (half - 1), y & (half - 1), alive);
+        return join(quads[0], quads[1], quads[2], quads[3]);
+    }
+
+    void fill(const Window& w, NodeId id, int level, int64_t ox, int64_t oy) const {
+        const int64_t size = (int64_t)1 << level;
+        if (m_nodes[id].population == 0 || ox >= w.x0 + w.width || oy >= w.y0 + w.height ||
+            ox + size <= w.x0 || oy + size <= w.y0) {
+            return;
+        }
+        if (level == kLeafLevel) {
+            const int64_t dx = ox - w.x0;  // -7 .. width-1
+            const uint64_t mask = w.width >= 32 ? 0xFFFFFFFFu : ((1u << w.width) - 1);
+            for (int y = 0; y < 8; y++) {
+                const int64_t row = oy + y - w.y0;
+                if (row < 0 || row >= w.height) continue;
+                const uint64_t bits = leafRow(id, y);
+                w.rows[row] |= (uint32_t)((dx >= 0 ? bits << dx : bits >> -dx) & mask);
+            }
+            return;
+        }
+        const int64_t half = size / 2;
+        for (int q = 0; q < 4; q++) fill(w, child(id, q), level - 1, ox + (q & 1) * half, oy + (q >> 1) * half);
+    }
+
+    void mark(NodeId id, bool withResults) {
+        Node& n = m_nodes[id];
+        if (n.mark) return;
+        n.mark = 1;
+        if (n.level > kLeafLevel) {
+            for (int q = 0; q < 4; q++) mark(n.child[q], withResults);
+        }
+        if (withResults && n.result != kNone) mark(n.result, withResults);
+    }
+
+    void dropResults() {
+        for (uint32_t id = 0; id < m_capacity; id++) m_nodes[id].result = kNone;
+    }
+
+    Node* m_nodes = nullptr;
+    NodeId* m_table = nullptr;
+    uint32_t m_capacity = 0, m_buckets = 0, m_used = 0;
+    NodeId m_free = kNone;
+    NodeId m_root = kNone;
+    NodeId m_empty[kMaxLevel + 1] = {};
+    bool m_overflow = false;
+
+    LifeRule m_rule;
+    int m_stepLog2 = 0;
+    uint64_t m_generation = 0;
+    Stats m_stats;
+};
@@ -0,0 +1,214 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "FixedMath.h"
+
+// Life-like rule: bit n of `birth` / `survive` is set when n live
+// neighbours give birth to a dead cell / keep a live cell alive
+struct LifeRule {
+    uint16_t birth = 1u << 3;
+    uint16_t survive = (1u << 2) | (1u << 3);
+
+    // "B3/S23" notation (case-insensitive; either half may be empty, e.g. "B2/S")
+    static bool parse(const char* text, LifeRule& out) {
+        LifeRule r;
+        r.birth = 0;
+        r.survive = 0;
+        const char* p = text;
+        if (p == nullptr || (*p != 'B' && *p != 'b')) return false;
+        for (p++; *p >= '0' && *p <= '8'; p++) r.birth |= (uint16_t)(1u << (*p - '0'));
+        if (*p++ != '/' || (*p != 'S' && *p != 's')) return false;
+        for (p++; *p >= '0' && *p <= '8'; p++) r.survive |= (uint16_t)(1u << (*p - '0'));
+        if (*p != '\0') return false;
+        out = r;
+        return true;
+    }
+};
+
+/**
+ * @brief Bit-parallel Life-like automaton on row words (up to 32 x 32).
+ * Each row is one word, so a generation works on all cells of a row at
+ * once: the eight neighbours are shifted copies of three rows, summed
+ * with bit-sliced adders into four count bit planes, and the rule picks
+ * the count planes it needs. Edges either wrap (torus) or read as dead.
+ * A short history of board hashes detects still lifes and oscillators
+ * up to kHistory generations. Pure and host-portable.
+ */
+class LifeGrid {
+public:
+    static constexpr int kMaxRows = 32;
+    static constexpr int kHistory = 16;
+
+    LifeGrid(int width = 16, int height = 10) { configure(width, height); }
+
+    void configure(int width, int height) {
+        m_width = width < 1 ? 1 : (width > 32 ? 32 : width);
+        m_height = height < 1 ? 1 : (height > kMaxRows ? kMaxRows : height);
+        clear();
+    }
+
+    void setRule(const LifeRule& rule) {
+        m_rule = rule;
+        resetHistory();
+    }
+    void setTorus(bool torus) {
+        m_torus = torus;
+        resetHistory();
+    }
+
+    const LifeRule& rule() const { return m_rule; }
+    bool torus() const { return m_torus; }
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Row y holds cells x = 0..width-1 in bits 0..width-1. Call
+    // resetHistory() after editing rows directly.
+    uint32_t* rows() { return m_rows; }
+    const uint32_t* rows() const { return m_rows; }
+
+    void clear() {
+        memset(m_rows, 0, sizeof(m_rows));
+        resetHistory();
+    }
+
+    // Fills about `percent` of the cells from a private xorshift stream
+    void randomize(uint32_t seed, int percent) {
+        uint32_t s = seed ? seed : 0x9E3779B9u;
+        const uint32_t threshold = (uint32_t)(percent * 655.36);  // Of 65536
+        for (int y = 0; y < m_height; y++) {
+            uint32_t row = 0;
+            for (int x = 0; x < m_width; x++) {
+                if ((fixmath::xorshift32(s) >> 16) < threshold) row |= 1u << x;
+            }
+            m_rows[y] = row;
+        }
+        resetHistory();
+    }
+
+    void resetHistory() {
+        m_historyCount = 0;
+        m_period = 0;
+        m_generation = 0;
+    }
+
+    // One generation; false when the board did not change
+    bool step() {
+        if (m_historyCount == 0) push(hash());  // The starting board is part of the history
+        const bool changed = advance(m_rows, m_next, m_width, m_height, m_torus, m_rule);
+        memcpy(m_rows, m_next, sizeof(uint32_t) * m_height);
+        m_generation++;
+        remember();
+        return changed;
+    }
+
+    // The kernel behind step(): one generation of `height` row words of
+    // `width` cells from `in` to `out` (which must not overlap). Returns
+    // whether any cell changed.
+    static bool advance(const uint32_t* in, uint32_t* out, int width, int height, bool torus, const LifeRule& rule) {
+        const uint32_t mask = width >= 32 ? 0xFFFFFFFFu : ((1u << width) - 1);
+
+        // Horizontal neighbour sums per row, reused by the rows above and below:
+        // all three cells (2 bits) and the two side cells only (2 bits)
+        uint32_t t0[kMaxRows], t1[kMaxRows], s0[kMaxRows], s1[kMaxRows];
+        for (int y = 0; y < height; y++) {
+            const uint32_t row = in[y];
+            uint32_t l = (row << 1) & mask, r = row >> 1;  // Bit x receives cell x-1 / x+1
+            if (torus) {
+                l |= row >> (width - 1);
+                r = (r | (row << (width - 1))) & mask;
+            }
+            s0[y] = l ^ r;
+            s1[y] = l & r;
+            t0[y] = s0[y] ^ row;
+            t1[y] = s1[y] | (s0[y] & row);
+        }
+
+        bool changed = false;
+        for (int y = 0; y < height; y++) {
+            uint32_t u0 = 0, u1 = 0, d0 = 0, d1 = 0;
+            if (torus || y > 0) {
+                const int up = y > 0 ? y - 1 : height - 1;
+                u0 = t0[up];
+                u1 = t1[up];
+            }
+            if (torus || y < height - 1) {
+                const int down = y < height - 1 ? y + 1 : 0;
+                d0 = t0[down];
+                d1 = t1[down];
+            }
+
+            // Count = u + s + d (three 2-bit numbers) as bit planes c0..c3
+            const uint32_t m0 = s0[y], m1 = s1[y];
+            const uint32_t c0 = u0 ^ m0 ^ d0;
+            const uint32_t carry = (u0 & m0) | (d0 & (u0 ^ m0));
+            const uint32_t x1 = u1 ^ m1 ^ d1;
+            const uint32_t k1 = (u1 & m1) | (d1 & (u1 ^ m1));
+            const uint32_t c1 = x1 ^ carry;
+            const uint32_t k2 = x1 & carry;
+            const uint32_t c2 = k1 ^ k2;
+            const uint32_t c3 = k1 & k2;
+
+            const uint32_t alive = in[y];
+            const uint32_t next = ((alive & countIn(rule.survive, c0, c1, c2, c3)) |
+                                   (~alive & countIn(rule.birth, c0, c1, c2, c3))) & mask;
+            out[y] = next;
+            changed |= next != alive;
+        }
+        return changed;
+    }
+
+    // Period of the cycle the board has entered (1 = still life or empty);
+    // 0 while none has been seen in the last kHistory generations
+    int period() const { return m_period; }
+    uint32_t generation() const { return m_generation; }
+
+    uint32_t population() const {
+        uint32_t n = 0;
+        for (int y = 0; y < m_height; y++) n += fixmath::popcount32(m_rows[y]);
+        return n;
+    }
+
+    uint32_t hash() const {
+        uint32_t h = 0x811C9DC5u;
+        for (int y = 0; y < m_height; y++) h = (h ^ m_rows[y]) * 0x01000193u;
+        return h ^ (h >> 15);
+    }
+
+private:
+    // Cells whose neighbour count (planes c0..c3) is in `counts`
+    static uint32_t countIn(uint16_t counts, uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3) {
+        uint32_t hit = 0;
+        for (int n = 0; counts != 0 && n <= 8; n++, counts >>= 1) {
+            if (!(counts & 1)) continue;
+            hit |= (n & 1 ? c0 : ~c0) & (n & 2 ? c1 : ~c1) & (n & 4 ? c2 : ~c2) & (n & 8 ? c3 : ~c3);
+        }
+        return hit;
+    }
+
+    void push(uint32_t h) {
+        m_history[m_historyHead & (kHistory - 1)] = h;
+        m_historyHead++;
+        if (m_historyCount < kHistory) m_historyCount++;
+    }
+
+    // A repeat of any remembered board means a cycle of that distance
+    void remember() {
+        const uint32_t h = hash();
+        for (int d = 1; m_period == 0 && d <= m_historyCount; d++) {
+            if (m_history[(m_historyHead - d) & (kHistory - 1)] == h) m_period = d;
+        }
+        push(h);
+    }
+
+    int m_width = 16, m_height = 10;
+    bool m_torus = true;
+    LifeRule m_rule;
+    uint32_t m_rows[kMaxRows] = {};
+    uint32_t m_next[kMaxRows] = {};
+
+    uint32_t m_history[kHistory] = {};
+    uint32_t m_historyHead = 0;
+    int m_historyCount = 0;
+    int m_period = 0;
+    uint32_t m_generation = 0;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+// Well-known Life (B3/S23) starting patterns in run-length encoding
+struct LifePattern {
+    const char* name;
+    const char* rle;
+};
+
+static const LifePattern kLifePatterns[] = {
+    { "R-pentomino", "b2o$2o$bo!" },                       // Settles at generation 1103, 116 cells
+    { "Acorn", "bo5b$3bo3b$2o2b3o!" },                     // Settles at generation 5206, 633 cells
+    { "Diehard", "6bob$2o6b$bo3b3o!" },                    // Dies out at generation 130
+    { "Gosper gun", "24bo$22bobo$12b2o6b2o12b2o$11bo3bo4b2o12b2o$2o8bo5bo3b2o$"
+                    "2o8bo3bob2o4bobo$10bo5bo7bo$11bo3bo$12b2o!" },  // A glider every 30 generations
+    { "Infinite growth", "3obo$o$3b2o$b2obo$obobo!" },      // Smallest infinitely growing pattern
+};
+
+static constexpr int kLifePatternCount = sizeof(kLifePatterns) / sizeof(kLifePatterns[0]);
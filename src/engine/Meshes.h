@@ -0,0 +1,60 @@
+#pragma once
+#include <stdint.h>
+
+// Wireframe solids for engine/Wireframe.h: vertices in Q8 (every vertex
+// 1.0 = 256 from the centre, +-1), edges as vertex index pairs. Const
+// tables, so they stay in flash.
+struct Mesh {
+    const char* name;
+    const int16_t (*vertices)[3];
+    uint8_t vertexCount;
+    const uint8_t (*edges)[2];
+    uint8_t edgeCount;
+};
+
+static const int16_t kCubeVertices[8][3] = {
+    { -148, -148, -148 }, { 148, -148, -148 }, { 148, 148, -148 }, { -148, 148, -148 },
+    { -148, -148, 148 },  { 148, -148, 148 },  { 148, 148, 148 },  { -148, 148, 148 },
+};
+static const uint8_t kCubeEdges[12][2] = {
+    { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },  // Back face
+    { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },  // Front face
+    { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },  // Connecting lines
+};
+
+static const int16_t kOctahedronVertices[6][3] = {
+    { 256, 0, 0 }, { -256, 0, 0 }, { 0, 256, 0 }, { 0, -256, 0 }, { 0, 0, 256 }, { 0, 0, -256 },
+};
+static const uint8_t kOctahedronEdges[12][2] = {
+    { 0, 2 }, { 0, 3 }, { 0, 4 }, { 0, 5 }, { 1, 2 }, { 1, 3 },
+    { 1, 4 }, { 1, 5 }, { 2, 4 }, { 2, 5 }, { 3, 4 }, { 3, 5 },
+};
+
+static const int16_t kTetrahedronVertices[4][3] = {
+    { 148, 148, 148 }, { 148, -148, -148 }, { -148, 148, -148 }, { -148, -148, 148 },
+};
+static const uint8_t kTetrahedronEdges[6][2] = {
+    { 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 2 }, { 1, 3 }, { 2, 3 },
+};
+
+// (0, +-1, +-phi) and its cyclic permutations, scaled to 1.0
+static const int16_t kIcosahedronVertices[12][3] = {
+    { 0, 135, 218 },  { 0, 135, -218 },  { 0, -135, 218 },  { 0, -135, -218 },
+    { 135, 218, 0 },  { 135, -218, 0 },  { -135, 218, 0 },  { -135, -218, 0 },
+    { 218, 0, 135 },  { -218, 0, 135 },  { 218, 0, -135 },  { -218, 0, -135 },
+};
+static const uint8_t kIcosahedronEdges[30][2] = {
+    { 0, 2 },  { 0, 4 },  { 0, 6 },  { 0, 8 },  { 0, 9 },  { 1, 3 },  { 1, 4 },  { 1, 6 },
+    { 1, 10 }, { 1, 11 }, { 2, 5 },  { 2, 7 },  { 2, 8 },  { 2, 9 },  { 3, 5 },  { 3, 7 },
+    { 3, 10 }, { 3, 11 }, { 4, 6 },  { 4, 8 },  { 4, 10 }, { 5, 7 },  { 5, 8 },  { 5, 10 },
+    { 6, 9 },  { 6, 11 }, { 7, 9 },  { 7, 11 }, { 8, 10 }, { 9, 11 },
+};
+
+static const Mesh kMeshes[] = {
+    { "Cube", kCubeVertices, 8, kCubeEdges, 12 },
+    { "Octahedron", kOctahedronVertices, 6, kOctahedronEdges, 12 },
+    { "Tetrahedron", kTetrahedronVertices, 4, kTetrahedronEdges, 6 },
+    { "Icosahedron", kIcosahedronVertices, 12, kIcosahedronEdges, 30 },
+};
+
+static constexpr int kMeshCount = sizeof(kMeshes) / sizeof(kMeshes[0]);
@@ -0,0 +1,74 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Word-level blend between two panel frames (10 row words of 16 bits).
+ * The outgoing frame is captured once; the incoming frame is whatever the new
+ * mode rendered this tick, so it keeps animating underneath the effect.
+ */
+class ModeTransition {
+public:
+    static constexpr int kRows = 10;
+    static constexpr int kCols = 16;
+
+    enum class Style : uint8_t {
+        Wipe,      // Sweeps across the 16 columns, one bit-mask per step
+        Dissolve,  // Ordered 4x4 Bayer dissolve, 16 levels
+    };
+
+    void start(const uint16_t from[kRows], Style style, uint32_t nowMs, uint32_t durationMs) {
+        memcpy(m_from, from, sizeof(m_from));
+        m_style = style;
+        m_startMs = nowMs;
+        m_durationMs = durationMs > 0 ? durationMs : 1;
+        m_active = true;
+    }
+
+    bool active() const { return m_active; }
+
+    void cancel() { m_active = false; }
+
+    // Writes the blended frame into `out`; finishes itself after durationMs
+    void blend(const uint16_t to[kRows], uint16_t out[kRows], uint32_t nowMs) {
+        const uint32_t elapsed = nowMs - m_startMs;
+        if (!m_active || elapsed >= m_durationMs) {
+            m_active = false;
+            memcpy(out, to, sizeof(uint16_t) * kRows);
+            return;
+        }
+
+        // 0..16: how much of the incoming frame is shown
+        const uint32_t level = (elapsed * 17) / m_durationMs;
+
+        for (int r = 0; r < kRows; r++) {
+            const uint16_t mask = m_style == Style::Wipe ? wipeMask(level) : dissolveMask(r, level);
+            out[r] = (to[r] & mask) | (m_from[r] & ~mask);
+        }
+    }
+
+private:
+    static uint16_t wipeMask(uint32_t level) {
+        return level >= 16 ? 0xFFFF : static_cast<uint16_t>((1u << level) - 1);
+    }
+
+    // Pixel (r, c) switches once level exceeds its Bayer threshold
+    static uint16_t dissolveMask(int r, uint32_t level) {
+        static const uint8_t kBayer4[4][4] = {
+            { 0,  8,  2, 10},
+            {12,  4, 14,  6},
+            { 3, 11,  1,  9},
+            {15,  7, 13,  5},
+        };
+        const uint8_t* t = kBayer4[r & 3];
+        const uint16_t nibble = (t[0] < level ? 1 : 0) | (t[1] < level ? 2 : 0)
+                              | (t[2] < level ? 4 : 0) | (t[3] < level ? 8 : 0);
+        return nibble * 0x1111;  // Pattern repeats every 4 columns
+    }
+
+    uint16_t m_from[kRows] = {};
+    Style m_style = Style::Dissolve;
+    uint32_t m_startMs = 0;
+    uint32_t m_durationMs = 1;
+    bool m_active = false;
+};
@@ -0,0 +1,144 @@
+#pragma once
+#include <stdint.h>
+#include "FixedMath.h"
+
+/**
+ * @brief Integer noise and dithering for the ambient modes: value noise,
+ * 2D simplex noise and fractal sums of it, sum-of-sines plasma, and
+ * ordered (Bayer) and temporal dithering from 0..255 levels down to the
+ * 1-bit panel. Header-only and host-portable, no floating point.
+ *
+ * Coordinates are Q8 (256 per lattice cell); noise comes back as signed
+ * Q8, within +-1.0 (+-256). Lattice hashing uses Perlin's permutation
+ * table and simplex gradients come from a 16-direction unit table, both
+ * const so they stay in flash.
+ */
+namespace noise {
+
+namespace detail {
+
+static const uint8_t kPerm[256] = {
+    151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+    140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+    247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+     57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+     74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+     60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+     65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+    200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+     52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+    207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+    119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+    129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+    218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+     81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+    184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+    222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180,
+};
+
+// Unit gradients every 22.5 degrees, Q8
+static const int16_t kGradX[16] = { 256, 237, 181, 98, 0, -98, -181, -237, -256, -237, -181, -98, 0, 98, 181, 237 };
+static const int16_t kGradY[16] = { 0, 98, 181, 237, 256, 237, 181, 98, 0, -98, -181, -237, -256, -237, -181, -98 };
+
+// 4x4 Bayer matrix: thresholds 0..15 in ordered-dither sequence
+static const uint8_t kBayer4[16] = { 0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5 };
+
+inline uint8_t hash(int32_t i, int32_t j) { return kPerm[(kPerm[i & 255] + j) & 255]; }
+
+// 3t^2 - 2t^3 for t in Q8 0..256
+inline int32_t fade(int32_t t) { return (t * t * (768 - 2 * t)) >> 16; }
+
+// One simplex corner: offsets in Q12, result Q12 before the gain
+inline int32_t corner(int32_t dx, int32_t dy, uint8_t h) {
+    int32_t t = 2048 - ((dx * dx + dy * dy) >> 12);
+    if (t <= 0) return 0;
+    t = (t * t) >> 12;
+    t = (t * t) >> 12;
+    return (t * ((kGradX[h & 15] * dx + kGradY[h & 15] * dy) >> 8)) >> 12;
+}
+
+static constexpr int32_t kSkew = 23984;    // (sqrt(3) - 1) / 2, Q16
+static constexpr int32_t kUnskew = 13849;  // (3 - sqrt(3)) / 6, Q16
+static constexpr int32_t kSimplexGain = 99;  // Scales the corner sum to about +-1.0
+
+}  // namespace detail
+
+// Value noise: hashed lattice values, smoothstep-blended
+inline int16_t value(int32_t x, int32_t y) {
+    const int32_t i = x >> 8, j = y >> 8;
+    const int32_t fx = detail::fade(x & 255), fy = detail::fade(y & 255);
+    const int32_t v00 = detail::hash(i, j) * 2 - 255, v10 = detail::hash(i + 1, j) * 2 - 255;
+    const int32_t v01 = detail::hash(i, j + 1) * 2 - 255, v11 = detail::hash(i + 1, j + 1) * 2 - 255;
+    const int32_t top = v00 + (((v10 - v00) * fx) >> 8);
+    const int32_t bottom = v01 + (((v11 - v01) * fx) >> 8);
+    return (int16_t)(top + (((bottom - top) * fy) >> 8));
+}
+
+// 2D simplex noise: three corners of the skewed triangle, each a radial falloff times a gradient
+inline int16_t simplex(int32_t x, int32_t y) {
+    const int32_t s = (int32_t)(((int64_t)(x + y) * detail::kSkew) >> 16);
+    const int32_t i = (x + s) >> 8, j = (y + s) >> 8;
+    const int32_t t = (int32_t)(((int64_t)(i + j) * detail::kUnskew) >> 8);
+
+    // Offsets from the three corners, Q8 then Q12
+    const int32_t x0 = x - (i << 8) + t, y0 = y - (j << 8) + t;
+    const int32_t i1 = x0 > y0 ? 1 : 0, j1 = 1 - i1;
+    const int32_t g = detail::kUnskew >> 8;
+    const int32_t x1 = x0 - (i1 << 8) + g, y1 = y0 - (j1 << 8) + g;
+    const int32_t x2 = x0 - 256 + 2 * g, y2 = y0 - 256 + 2 * g;
+
+    const int32_t sum = detail::corner(x0 << 4, y0 << 4, detail::hash(i, j)) +
+                        detail::corner(x1 << 4, y1 << 4, detail::hash(i + i1, j + j1)) +
+                        detail::corner(x2 << 4, y2 << 4, detail::hash(i + 1, j + 1));
+    return (int16_t)fixmath::clamp((sum * detail::kSimplexGain) >> 4, -256, 256);
+}
+
+// Fractal sum of simplex octaves, each at twice the frequency and half the weight
+inline int16_t fbm(int32_t x, int32_t y, int octaves) {
+    int32_t sum = 0, weight = 0;
+    for (int o = 0, amplitude = 256; o < octaves && amplitude > 0; o++, amplitude >>= 1) {
+        sum += simplex(x, y) * amplitude;
+        weight += amplitude;
+        x = x * 2 + (97 << 8);  // Offset so octaves do not share a lattice origin
+        y = y * 2 + (41 << 8);
+    }
+    return weight ? (int16_t)(sum / weight) : 0;
+}
+
+// Signed Q8 noise (+-256) to a 0..255 level
+inline uint8_t toLevel(int32_t v) { return (uint8_t)fixmath::clamp((v + 256) >> 1, 0, 255); }
+
+// Classic plasma: four table sines (binary-angle phases) summed to a 0..255 level
+inline uint8_t plasma(uint16_t a, uint16_t b, uint16_t c, uint16_t d) {
+    const int32_t sum = fixmath::sin8(a) + fixmath::sin8(b) + fixmath::sin8(c) + fixmath::sin8(d);  // +-1024
+    return (uint8_t)fixmath::clamp((sum + 1024) >> 3, 0, 255);
+}
+
+enum class Dither : uint8_t {
+    Threshold,  // Lit at 50% and above
+    Bayer,      // 4x4 ordered pattern: 17 steady grey levels
+    Temporal,   // Bayer pattern rotated every frame: each pixel averages its own level over 16 frames
+};
+
+// Threshold (0..255) the pixel at (x, y) is compared against on `frame`
+inline uint8_t threshold(Dither kind, int x, int y, uint8_t frame) {
+    if (kind == Dither::Threshold) return 128;
+    uint8_t cell = detail::kBayer4[((y & 3) << 2) | (x & 3)];
+    if (kind == Dither::Temporal) cell = (uint8_t)((cell + detail::kBayer4[frame & 15]) & 15);
+    return (uint8_t)(cell * 16 + 8);
+}
+
+// Writes width x height levels (row-major) into a 1-bit framebuffer in the
+// GFXcanvas1 layout, overwriting every pixel
+inline void dither(const uint8_t* levels, int width, int height, Dither kind, uint8_t frame, uint8_t* buffer) {
+    const int stride = (width + 7) / 8;
+    for (int y = 0; y < height; y++) {
+        uint8_t* row = buffer + y * stride;
+        for (int b = 0; b < stride; b++) row[b] = 0;
+        for (int x = 0; x < width; x++) {
+            if (levels[y * width + x] >= threshold(kind, x, y, frame)) row[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+        }
+    }
+}
+
+}  // namespace noise
@@ -0,0 +1,168 @@
+#pragma once
+#include <stdint.h>
+#include "FixedMath.h"
+
+/**
+ * @brief Fixed-point complementary filter: fuses gyro and accelerometer into
+ * a gravity vector in the sensor frame, plus roll and pitch.
+ * Each sample, the estimate is rotated by the gyro (small-angle update,
+ * g += g x w*dt). It is then pulled toward the measured acceleration with a
+ * gain set by the time constant. The pull is skipped when |a| is far from
+ * 1 g (shaking, impacts). The same error (a x g) feeds a slow integral that
+ * cancels gyro offset, which is the Mahony I term. A Newton step keeps |g| at
+ * 1 g. Integer only (one 64-bit product per cross term), sized for 500+ Hz on
+ * the game core. Pure and host-portable.
+ *
+ * Units: raw MPU6050 LSB in (+-2 g, +-250 dps). Gravity out in Q14
+ * (16384 = 1 g, same scale as raw accel). Angles are binary (65536 = one
+ * turn, so 16384 = 90 deg).
+ */
+class OrientationFilter {
+public:
+    static constexpr int32_t kOneG = 16384;           // accel LSB per g
+    static constexpr int32_t kGyroLsbPerDps10 = 1310; // 131.0 LSB per deg/s, x10
+
+    // sampleHz: rate update() is called at; timeConstantMs: accel correction
+    OrientationFilter(uint32_t sampleHz = 500, uint32_t timeConstantMs = 500) {
+        configure(sampleHz, timeConstantMs);
+    }
+
+    void configure(uint32_t sampleHz, uint32_t timeConstantMs) {
+        // Radians per gyro LSB per sample, Q30: (pi / 180) / 131 / sampleHz
+        const double radPerLsb = 3.14159265358979 / 180.0 / (kGyroLsbPerDps10 / 10.0);
+        m_gyroScaleQ30 = (int32_t)(radPerLsb / sampleHz * (double)(1L << 30) + 0.5);
+        // Per-sample blend toward the accelerometer, Q16 (dt / tau)
+        const uint32_t samplesPerTau = sampleHz * timeConstantMs / 1000;
+        m_accelGainQ16 = samplesPerTau > 0 ? (int32_t)(65536 / samplesPerTau) : 65536;
+        if (m_accelGainQ16 < 1) m_accelGainQ16 = 1;
+        m_calmSamples = (uint16_t)(sampleHz * kCalmMs / 1000);
+        // Integral gain k^2 / 16: over-damped (zeta 2), offset settles in ~15 tau
+        m_biasGainQ30 = (int32_t)(((int64_t)m_accelGainQ16 * m_accelGainQ16) >> 6);
+        if (m_biasGainQ30 < 1) m_biasGainQ30 = 1;
+        m_maxBiasQ30 = kMaxGyroBiasLsb * m_gyroScaleQ30;
+    }
+
+    // Seeds the estimate from a single accelerometer reading (no convergence ramp)
+    void reset(int16_t ax, int16_t ay, int16_t az) {
+        m_g[0] = (int32_t)ax * kInScale;
+        m_g[1] = (int32_t)ay * kInScale;
+        m_g[2] = (int32_t)az * kInScale;
+        normalize();
+        if (m_g[0] == 0 && m_g[1] == 0 && m_g[2] == 0) m_g[2] = kUnit;
+        m_calmRun = 0;
+    }
+
+    // Also forgets the learned gyro offset
+    void resetBias() { m_biasQ30[0] = m_biasQ30[1] = m_biasQ30[2] = 0; }
+
+    void update(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz) {
+        // 1. Rotate by the gyro: g += g x theta (theta in Q30 radians)
+        const int32_t tx = (int32_t)gx * m_gyroScaleQ30 + m_biasQ30[0];
+        const int32_t ty = (int32_t)gy * m_gyroScaleQ30 + m_biasQ30[1];
+        const int32_t tz = (int32_t)gz * m_gyroScaleQ30 + m_biasQ30[2];
+        const int32_t x = m_g[0], y = m_g[1], z = m_g[2];
+        m_g[0] = x + mulQ30(y, tz) - mulQ30(z, ty);
+        m_g[1] = y + mulQ30(z, tx) - mulQ30(x, tz);
+        m_g[2] = z + mulQ30(x, ty) - mulQ30(y, tx);
+
+        // 2. Pull toward the accelerometer once it has read about 1 g for
+        // kCalmMs; the gain tapers to zero at the edge of the window. A shake
+        // only crosses 1 g briefly, so it never gets to steer the estimate.
+        const int32_t hx = ax >> 1, hy = ay >> 1, hz = az >> 1;  // Q13: squares fit 32 bits
+        const int32_t mag2 = hx * hx + hy * hy + hz * hz;        // (1 g)^2 == 1 << 26
+        const int32_t off = mag2 > kOneMag2 ? mag2 - kOneMag2 : kOneMag2 - mag2;
+        if (off >= kMag2Window) {
+            m_calmRun = 0;
+        } else if (m_calmRun < m_calmSamples) {
+            m_calmRun++;
+        }
+        m_accelTrusted = m_calmRun >= m_calmSamples && off < kMag2Window;
+        if (m_accelTrusted) {
+            const int32_t taper = (kMag2Window - off) >> kTaperShift;  // Q8 of the window
+            const int32_t gain = (m_accelGainQ16 * taper) >> 8;
+            const int32_t biasGain = (int32_t)(((int64_t)m_biasGainQ30 * taper) >> 8);
+            const int32_t mx = (int32_t)ax * kInScale, my = (int32_t)ay * kInScale, mz = (int32_t)az * kInScale;
+            // Rotation that would carry g onto a: e = a x g (Q24, ~sin of the error)
+            const int32_t ex = mulQ24(my, m_g[2]) - mulQ24(mz, m_g[1]);
+            const int32_t ey = mulQ24(mz, m_g[0]) - mulQ24(mx, m_g[2]);
+            const int32_t ez = mulQ24(mx, m_g[1]) - mulQ24(my, m_g[0]);
+            integrateBias(0, ex, biasGain);
+            integrateBias(1, ey, biasGain);
+            integrateBias(2, ez, biasGain);
+            m_g[0] += mulQ16(mx - m_g[0], gain);
+            m_g[1] += mulQ16(my - m_g[1], gain);
+            m_g[2] += mulQ16(mz - m_g[2], gain);
+        }
+
+        // 3. Keep |g| at 1 g
+        normalize();
+    }
+
+    // Unit gravity in the sensor frame, Q14 (16384 = 1 g)
+    int16_t gravity(int axis) const { return (int16_t)(m_g[axis] >> (kStateBits - 14)); }
+
+    // Binary angles (65536 = one turn), derived on demand from the gravity vector
+    int16_t roll() const { return atan2(gravity(1), gravity(2)); }
+    int16_t pitch() const {
+        const int32_t gy = gravity(1), gz = gravity(2);
+        return atan2(-gravity(0), (int32_t)isqrt((uint32_t)(gy * gy + gz * gz)));
+    }
+
+    // Learned gyro offset correction, in gyro LSB (rounded toward zero)
+    int32_t gyroBias(int axis) const { return m_biasQ30[axis] / m_gyroScaleQ30; }
+
+    // False while the last sample was rejected as non-gravity acceleration
+    bool accelTrusted() const { return m_accelTrusted; }
+
+    static int32_t toCentiDegrees(int16_t angle) { return ((int32_t)angle * 36000) >> 16; }
+
+    // Shared with the modes (engine/FixedMath.h)
+    static int16_t atan2(int32_t y, int32_t x) { return fixmath::atan2(y, x); }
+    static uint32_t isqrt(uint32_t v) { return fixmath::isqrt(v); }
+
+private:
+    static constexpr int kStateBits = 24;                  // 1 g == 1 << 24
+    static constexpr int32_t kUnit = 1L << kStateBits;
+    static constexpr int32_t kInScale = 1 << (kStateBits - 14);
+    static constexpr int32_t kOneMag2 = 1L << 26;
+    static constexpr int kTaperShift = 16;
+    static constexpr uint32_t kCalmMs = 20;
+    static constexpr int32_t kMag2Window = 256L << kTaperShift;  // |a|^2 within ~0.39 of 1 g^2 (0.78..1.17 g)
+    static constexpr int32_t kMaxGyroBiasLsb = 131 * 20;  // +-20 deg/s of offset
+
+    static int32_t mulQ30(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 30); }
+    static int32_t mulQ24(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 24); }
+    static int32_t mulQ16(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 16); }
+
+    void integrateBias(int axis, int32_t errQ24, int32_t gainQ30) {
+        int32_t b = m_biasQ30[axis] + mulQ30(errQ24 * 64, gainQ30);
+        if (b > m_maxBiasQ30) b = m_maxBiasQ30;
+        if (b < -m_maxBiasQ30) b = -m_maxBiasQ30;
+        m_biasQ30[axis] = b;
+    }
+
+    void normalize() {
+        // One Newton step of 1/sqrt around 1: g *= (3 - |g|^2) / 2
+        const int64_t n2 = (int64_t)m_g[0] * m_g[0] + (int64_t)m_g[1] * m_g[1] + (int64_t)m_g[2] * m_g[2];
+        const int32_t n2q = (int32_t)(n2 >> kStateBits);  // |g|^2 in Q24
+        if (n2q <= 0 || n2q > 4 * kUnit) {
+            // Far off (seed from a bad sample): exact renormalisation
+            const uint32_t len = isqrt((uint32_t)(n2 >> (2 * kStateBits - 28)));  // Q14
+            if (len == 0) return;
+            for (int a = 0; a < 3; a++) m_g[a] = (int32_t)(((int64_t)m_g[a] << 14) / len);
+            return;
+        }
+        const int32_t factor = (3 * kUnit - n2q) >> 1;
+        for (int a = 0; a < 3; a++) m_g[a] = (int32_t)(((int64_t)m_g[a] * factor) >> kStateBits);
+    }
+
+    int32_t m_g[3] = { 0, 0, kUnit };
+    int32_t m_gyroScaleQ30 = 0;
+    int32_t m_accelGainQ16 = 0;
+    int32_t m_biasGainQ30 = 0;
+    int32_t m_maxBiasQ30 = 0;
+    int32_t m_biasQ30[3] = { 0, 0, 0 };  // Q30 radians per sample
+    uint16_t m_calmSamples = 0;
+    uint16_t m_calmRun = 0;
+    bool m_accelTrusted = true;
+};
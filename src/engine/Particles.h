@@ -0,0 +1,204 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "FixedMath.h"
+
+/**
+ * @brief Fixed-point particle system for the particle modes. Positions and
+ * velocities are Q8.8 pixels (per step), kept as separate arrays so the
+ * update loop streams through them. Slots come from a free list and the
+ * live ones are kept in a packed index list, so spawning and killing are
+ * O(1) and the update and raster loops touch live particles only, without
+ * a branch on dead slots. Every step adds the system's gravity, scales
+ * the velocity by its drag, moves, runs lifetimes down and kills
+ * particles that leave the bounds. Pure and host-portable.
+ *
+ * Rasterizing ORs particles into row words, one per pixel row with the
+ * leftmost pixel in the top bit (0x8000 >> x): the GFXcanvas1 byte layout,
+ * two bytes at a time.
+ */
+template <int Capacity>
+class ParticleSystem {
+    static_assert(Capacity > 0 && Capacity <= 255, "slots are indexed with uint8_t");
+
+public:
+    static constexpr int kCapacity = Capacity;
+    static constexpr uint8_t kForever = 255;  // Lifetime that never runs down
+
+    // Spawns particles at (x, y) plus [0, spread) jitter, moving at (vx, vy)
+    // plus a speed in [speedMin, speedMax] along an angle in
+    // [angle, angle + angleRange) (binary angles, 16384 = +y = down)
+    struct Emitter {
+        fixmath::q8 x = 0, y = 0;
+        fixmath::q8 spreadX = 0, spreadY = 0;
+        fixmath::q8 vx = 0, vy = 0;
+        fixmath::q8 speedMin = 0, speedMax = 0;
+        uint16_t angle = 0, angleRange = 0;
+        uint8_t lifeMin = kForever, lifeMax = kForever;
+        uint16_t rateQ8 = 0;  // Particles per step for stream() (Q8; fractions carry over)
+        uint16_t carry = 0;
+    };
+
+    ParticleSystem() { clear(); }
+
+    void clear() {
+        memset(m_life, 0, sizeof(m_life));
+        for (int i = 0; i < Capacity; i++) m_free[i] = (uint8_t)(Capacity - 1 - i);  // Slot 0 pops first
+        m_freeCount = Capacity;
+        m_count = 0;
+    }
+
+    // Emitter jitter stream (xorshift); any seed but 0
+    void seed(uint32_t seed) { m_rng = seed ? seed : 0x9E3779B9u; }
+
+    void setGravity(fixmath::q8 gx, fixmath::q8 gy) {
+        m_gx = gx;
+        m_gy = gy;
+    }
+    // Velocity scale per step in Q8: 256 keeps it, less slows, more speeds up
+    void setDrag(int32_t dragQ8) { m_drag = dragQ8; }
+    // Particles more than `margin` pixels outside width x height are killed
+    void setBounds(int width, int height, int margin = 0) {
+        m_minX = (int32_t)-margin * 256;
+        m_minY = (int32_t)-margin * 256;
+        m_maxX = (int32_t)(width + margin) * 256;
+        m_maxY = (int32_t)(height + margin) * 256;
+    }
+
+    // Slot of the new particle, or -1 when full
+    int spawn(fixmath::q8 x, fixmath::q8 y, fixmath::q8 vx, fixmath::q8 vy, uint8_t life = kForever) {
+        if (m_freeCount == 0 || life == 0) return -1;
+        const int i = m_free[--m_freeCount];
+        m_x[i] = x;
+        m_y[i] = y;
+        m_vx[i] = vx;
+        m_vy[i] = vy;
+        m_life[i] = life;
+        m_where[i] = (uint8_t)m_count;
+        m_live[m_count++] = (uint8_t)i;
+        return i;
+    }
+
+    void kill(int i) {
+        if (m_life[i]) release(i);
+    }
+
+    // Spawns up to `count` particles from the emitter; returns how many fit
+    int burst(const Emitter& e, int count) {
+        int made = 0;
+        for (; made < count; made++) {
+            const int32_t speed = e.speedMin + (int32_t)range((uint32_t)(e.speedMax - e.speedMin + 1));
+            const uint16_t angle = (uint16_t)(e.angle + range(e.angleRange));
+            const uint8_t life = (uint8_t)(e.lifeMin + range((uint32_t)(e.lifeMax - e.lifeMin + 1)));
+            const int slot = spawn((fixmath::q8)(e.x + (int32_t)range((uint32_t)e.spreadX)),
+                                   (fixmath::q8)(e.y + (int32_t)range((uint32_t)e.spreadY)),
+                                   (fixmath::q8)(e.vx + ((fixmath::cos(angle) * speed) >> 16)),
+                                   (fixmath::q8)(e.vy + ((fixmath::sin(angle) * speed) >> 16)), life);
+            if (slot < 0) break;
+        }
+        return made;
+    }
+
+    // Spawns this step's share of the emitter's rate
+    int stream(Emitter& e) {
+        e.carry += e.rateQ8;
+        const int count = e.carry >> 8;
+        e.carry &= 0xFF;
+        return burst(e, count);
+    }
+
+    // One step for every live particle; returns how many were updated
+    int step() {
+        const int updated = m_count;
+        for (int k = 0; k < m_count;) {
+            const int i = m_live[k];
+            int32_t vx = m_vx[i] + m_gx, vy = m_vy[i] + m_gy;
+            if (m_drag != 256) {
+                vx = scale(vx);
+                vy = scale(vy);
+            }
+            const int32_t x = m_x[i] + vx, y = m_y[i] + vy;
+            m_vx[i] = (fixmath::q8)fixmath::clamp(vx, INT16_MIN, INT16_MAX);
+            m_vy[i] = (fixmath::q8)fixmath::clamp(vy, INT16_MIN, INT16_MAX);
+            m_x[i] = (fixmath::q8)fixmath::clamp(x, INT16_MIN, INT16_MAX);
+            m_y[i] = (fixmath::q8)fixmath::clamp(y, INT16_MIN, INT16_MAX);
+            bool dead = x < m_minX || x >= m_maxX || y < m_minY || y >= m_maxY;
+            if (m_life[i] != kForever && --m_life[i] == 0) dead = true;
+            if (dead) release(i);  // The last live particle moves into k
+            else k++;
+        }
+        m_updates += (uint32_t)updated;
+        return updated;
+    }
+
+    // ORs every live particle on screen into rows[y] (0x8000 >> x); with
+    // trails, also the pixel it came from this step
+    void raster(uint16_t* rows, int width, int height, bool trails = false) const {
+        for (int k = 0; k < m_count; k++) {
+            const int i = m_live[k];
+            plot(rows, width, height, m_x[i] >> 8, m_y[i] >> 8);
+            if (trails) plot(rows, width, height, (m_x[i] - m_vx[i]) >> 8, (m_y[i] - m_vy[i]) >> 8);
+        }
+    }
+
+    // Live particles are slot(0) .. slot(count() - 1); walk them backwards
+    // to kill as you go (a kill moves the last one into the gap)
+    int count() const { return m_count; }
+    int slot(int k) const { return m_live[k]; }
+    bool alive(int i) const { return m_life[i] != 0; }
+    fixmath::q8 x(int i) const { return m_x[i]; }
+    fixmath::q8 y(int i) const { return m_y[i]; }
+    fixmath::q8 vx(int i) const { return m_vx[i]; }
+    fixmath::q8 vy(int i) const { return m_vy[i]; }
+    uint8_t life(int i) const { return m_life[i]; }
+
+    // Particle updates since the last reset (for throughput logs)
+    uint32_t updates() const { return m_updates; }
+    void resetUpdates() { m_updates = 0; }
+
+    // Uniform in [0, n)
+    uint32_t range(uint32_t n) {
+        if (n <= 1) return 0;
+        return (uint32_t)(((uint64_t)fixmath::xorshift32(m_rng) * n) >> 32);
+    }
+
+private:
+    void release(int i) {
+        const int k = m_where[i];
+        const uint8_t last = m_live[--m_count];
+        m_live[k] = last;
+        m_where[last] = (uint8_t)k;
+        m_life[i] = 0;
+        m_free[m_freeCount++] = (uint8_t)i;
+    }
+
+    // v * drag, rounded half away from zero so speeds grow and decay alike both ways
+    int32_t scale(int32_t v) const {
+        const int32_t t = v * m_drag;
+        return (t + 128 + (t >> 31)) >> 8;
+    }
+
+    // Branch-free: particles drift on and off screen at random, which a
+    // branch would mispredict about half the time. Off-screen ones OR an
+    // empty mask into a clamped row.
+    static void plot(uint16_t* rows, int width, int height, int px, int py) {
+        const uint32_t on = ((unsigned)px < (unsigned)width) & ((unsigned)py < (unsigned)height);
+        const int row = py < 0 ? 0 : (py >= height ? height - 1 : py);
+        rows[row] |= (uint16_t)((0x8000u >> (px & 15)) & (0u - on));
+    }
+
+    fixmath::q8 m_x[Capacity], m_y[Capacity];
+    fixmath::q8 m_vx[Capacity], m_vy[Capacity];
+    uint8_t m_life[Capacity];  // 0 = free slot
+    uint8_t m_free[Capacity];  // Free-slot stack
+    uint8_t m_live[Capacity];  // Packed live slots
+    uint8_t m_where[Capacity]; // Index of each live slot in m_live
+    int m_freeCount = 0;
+    int m_count = 0;
+
+    fixmath::q8 m_gx = 0, m_gy = 0;
+    int32_t m_drag = 256;
+    int32_t m_minX = INT32_MIN, m_minY = INT32_MIN, m_maxX = INT32_MAX, m_maxY = INT32_MAX;
+    uint32_t m_rng = 0x9E3779B9u;
+    uint32_t m_updates = 0;
+};
@@ -0,0 +1,228 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Fixed-timestep 2D physics for the ball games: bodies are boxes
+ * (Q8 pixels, 1 x 1 units for a point) moving through a field of wall
+ * cells, kept as row words (rows[y] bit x), plus moving boxes such as
+ * paddles. Pure and host-portable.
+ *
+ * Motion is swept one axis at a time: every cell row or column the
+ * leading face crosses during a step is tested, so nothing passes through
+ * a one-pixel wall however fast it moves. A hit stops the body at the
+ * face, scales the normal velocity by -restitution and the tangential one
+ * by 1 - friction, and spends the rest of the step's travel going back
+ * the other way (scaled by restitution too).
+ *
+ * FixedStep turns wall-clock time into a whole number of steps with an
+ * accumulator, so the games run at the same speed whatever the frame rate.
+ */
+
+// Q8 pixels and Q8 pixels per step
+struct PhysicsBody {
+    int32_t x = 0, y = 0;
+    int32_t vx = 0, vy = 0;
+    int32_t w = 1, h = 1;             // 256 = one pixel; 1 = a point
+    int32_t restitution = 256;        // Q8 share of the normal speed kept on a hit
+    int32_t friction = 0;             // Q8 share of the tangential speed lost on a hit
+    int32_t damping = 256;            // Q8 velocity scale per step
+    int32_t maxSpeed = 0x7FFFFFFF;    // Per axis, Q8 per step
+};
+
+// A solid, possibly moving, rectangle (Q8 pixels)
+struct PhysicsBox {
+    int32_t x, y, w, h;
+};
+
+struct PhysicsHit {
+    uint8_t axis;           // 0 = moving along x, 1 = along y
+    int8_t dir;             // Direction of travel into the obstacle (+1 / -1)
+    int8_t box;             // Box index, or -1 for a wall cell or closed edge
+    int16_t cellX, cellY;   // Wall cell (outside the field for an edge)
+    int32_t speed;          // Velocity along the axis just before the hit
+};
+
+class PhysicsWorld {
+public:
+    enum Edge : uint8_t { Left = 1, Right = 2, Top = 4, Bottom = 8 };
+
+    PhysicsWorld(int width = 10, int height = 16) { setSize(width, height); }
+
+    void setSize(int width, int height) {
+        m_width = width;
+        m_height = height;
+    }
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Wall cells: rows[y] bit x, `height` rows (nullptr = none). Not copied.
+    void setWalls(const uint16_t* rows) { m_walls = rows; }
+    // Edges (Edge bits) that are open: bodies may leave through them
+    void setOpenEdges(uint8_t edges) { m_open = edges; }
+    // Solid boxes (paddles); not copied, so move them in place between steps
+    void setBoxes(const PhysicsBox* boxes, int count) {
+        m_boxes = boxes;
+        m_boxCount = count;
+    }
+
+    bool solid(int cx, int cy) const {
+        if (cx < 0 && !(m_open & Left)) return true;
+        if (cx >= m_width && !(m_open & Right)) return true;
+        if (cy < 0 && !(m_open & Top)) return true;
+        if (cy >= m_height && !(m_open & Bottom)) return true;
+        if (cx < 0 || cx >= m_width || cy < 0 || cy >= m_height || !m_walls) return false;
+        return (m_walls[cy] >> cx) & 1;
+    }
+
+    // One step: accelerate by (ax, ay), damp, cap, then sweep x and y.
+    // Up to maxHits hits are written to hits; returns how many happened.
+    int step(PhysicsBody& b, int32_t ax, int32_t ay, PhysicsHit* hits = nullptr, int maxHits = 0) {
+        b.vx = cap(scale(b.vx + ax, b.damping), b.maxSpeed);
+        b.vy = cap(scale(b.vy + ay, b.damping), b.maxSpeed);
+        int count = 0;
+        count += sweep(b, 0, hits, maxHits, count);
+        count += sweep(b, 1, hits, maxHits, count);
+        return count;
+    }
+
+    // True if the body overlaps a wall cell, closed edge or box
+    bool overlaps(const PhysicsBody& b) const {
+        for (int cy = cell(b.y); cy <= cell(b.y + b.h - 1); cy++) {
+            for (int cx = cell(b.x); cx <= cell(b.x + b.w - 1); cx++) {
+                if (solid(cx, cy)) return true;
+            }
+        }
+        for (int i = 0; i < m_boxCount; i++) {
+            const PhysicsBox& r = m_boxes[i];
+            if (b.x < r.x + r.w && r.x < b.x + b.w && b.y < r.y + r.h && r.y < b.y + b.h) return true;
+        }
+        return false;
+    }
+
+private:
+    static int cell(int32_t v) { return v >> 8; }  // Floor, also below zero
+
+    // v * q8, rounded half away from zero
+    static int32_t scale(int32_t v, int32_t q8) {
+        if (q8 == 256) return v;
+        const int32_t t = v * q8;
+        return (t + 128 + (t >> 31)) >> 8;
+    }
+
+    static int32_t cap(int32_t v, int32_t limit) { return v > limit ? limit : (v < -limit ? -limit : v); }
+
+    // First solid cell in line c (a column when moving along x, a row
+    // along y) between lo and hi on the other axis
+    bool lineSolid(int axis, int c, int lo, int hi, int16_t& hitX, int16_t& hitY) const {
+        for (int o = lo; o <= hi; o++) {
+            const int cx = axis ? o : c, cy = axis ? c : o;
+            if (solid(cx, cy)) {
+                hitX = (int16_t)cx;
+                hitY = (int16_t)cy;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int sweep(PhysicsBody& b, int axis, PhysicsHit* hits, int maxHits, int written) {
+        int32_t& pos = axis ? b.y : b.x;
+        int32_t& vel = axis ? b.vy : b.vx;
+        int32_t& tangent = axis ? b.vx : b.vy;
+        const int32_t size = axis ? b.h : b.w;
+        const int32_t other = axis ? b.x : b.y;
+        const int32_t otherSize = axis ? b.w : b.h;
+        const int lo = cell(other), hi = cell(other + otherSize - 1);
+
+        int count = 0;
+        int32_t d = vel;
+        for (int bounce = 0; bounce < 4 && d != 0; bounce++) {
+            PhysicsHit hit = { (uint8_t)axis, (int8_t)(d > 0 ? 1 : -1), -1, 0, 0, vel };
+            int32_t reach = d;
+            bool blocked = false;
+
+            // Wall cells and edges, nearest line first
+            if (d > 0) {
+                const int32_t lead = pos + size - 1;  // Last unit the body covers
+                for (int c = cell(lead) + 1; c <= cell(lead + d) && !blocked; c++) {
+                    if (lineSolid(axis, c, lo, hi, hit.cellX, hit.cellY)) {
+                        reach = c * 256 - (pos + size);
+                        blocked = true;
+                    }
+                }
+            } else {
+                for (int c = cell(pos) - 1; c >= cell(pos + d) && !blocked; c--) {
+                    if (lineSolid(axis, c, lo, hi, hit.cellX, hit.cellY)) {
+                        reach = (c + 1) * 256 - pos;
+                        blocked = true;
+                    }
+                }
+            }
+
+            // Boxes beside the path, if nearer (ones already overlapping are ignored)
+            for (int i = 0; i < m_boxCount; i++) {
+                const PhysicsBox& r = m_boxes[i];
+                const int32_t rp = axis ? r.y : r.x, rs = axis ? r.h : r.w;
+                const int32_t ro = axis ? r.x : r.y, ros = axis ? r.w : r.h;
+                if (!(other < ro + ros && ro < other + otherSize)) continue;
+                if (d > 0 && pos + size <= rp && pos + size + reach > rp) {
+                    reach = rp - (pos + size);
+                    blocked = true;
+                    hit.box = (int8_t)i;
+                } else if (d < 0 && pos >= rp + rs && pos + reach < rp + rs) {
+                    reach = rp + rs - pos;
+                    blocked = true;
+                    hit.box = (int8_t)i;
+                }
+            }
+
+            pos += reach;
+            if (!blocked) break;
+
+            if (hits && written + count < maxHits) hits[written + count] = hit;
+            count++;
+            vel = -scale(vel, b.restitution);
+            tangent = scale(tangent, 256 - b.friction);
+            d = -scale(d - reach, b.restitution);
+        }
+        return count;
+    }
+
+    int m_width = 10, m_height = 16;
+    const uint16_t* m_walls = nullptr;
+    uint8_t m_open = 0;
+    const PhysicsBox* m_boxes = nullptr;
+    int m_boxCount = 0;
+};
+
+class FixedStep {
+public:
+    explicit FixedStep(uint32_t stepUs, int maxSteps = 4) : m_stepUs(stepUs), m_maxSteps(maxSteps) {}
+
+    void reset(uint32_t nowUs) {
+        m_last = nowUs;
+        m_accumulator = 0;
+    }
+
+    // Steps due since the last call; after a stall longer than maxSteps
+    // the backlog is dropped rather than run all at once
+    int advance(uint32_t nowUs) {
+        m_accumulator += nowUs - m_last;
+        m_last = nowUs;
+        uint32_t due = m_accumulator / m_stepUs;
+        if (due > (uint32_t)m_maxSteps) {
+            m_accumulator = 0;
+            return m_maxSteps;
+        }
+        m_accumulator -= due * m_stepUs;
+        return (int)due;
+    }
+
+    uint32_t stepUs() const { return m_stepUs; }
+
+private:
+    uint32_t m_stepUs;
+    int m_maxSteps;
+    uint32_t m_last = 0;
+    uint32_t m_accumulator = 0;
+};
@@ -0,0 +1,130 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "FixedMath.h"
+
+/**
+ * @brief Falling sand on row words (up to 32 x 32), moved a whole row at a
+ * time with mask operations. Gravity points in one of eight directions
+ * (octants of a binary angle); angles between two octants alternate
+ * between them in proportion, so the pile follows the tilt smoothly.
+ *
+ * Each step, every grain tries the gravity direction first and then the
+ * two neighbouring directions (the diagonals under a straight pull, the
+ * straight moves under a diagonal one), in random order per grain. Rows
+ * are resolved from the leading edge back, so a column can fall together;
+ * a grain that moved this step cannot move again, and every move goes to
+ * a cell that is empty at that moment, so grains are never lost or made.
+ * Pure and host-portable.
+ */
+class SandGrid {
+public:
+    static constexpr int kMaxRows = 32;
+
+    SandGrid(int width = 16, int height = 10) { configure(width, height); }
+
+    void configure(int width, int height) {
+        m_width = width < 1 ? 1 : (width > 32 ? 32 : width);
+        m_height = height < 1 ? 1 : (height > kMaxRows ? kMaxRows : height);
+        m_mask = m_width == 32 ? 0xFFFFFFFFu : ((1u << m_width) - 1);
+        clear();
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Row y holds cells x = 0..width-1 in bits 0..width-1
+    uint32_t* rows() { return m_rows; }
+    const uint32_t* rows() const { return m_rows; }
+
+    void clear() { memset(m_rows, 0, sizeof(m_rows)); }
+
+    // Tie-break stream (xorshift); any seed but 0
+    void seed(uint32_t seed) { m_rng = seed ? seed : 0x9E3779B9u; }
+
+    bool get(int x, int y) const {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height && ((m_rows[y] >> x) & 1);
+    }
+    void set(int x, int y, bool on) {
+        if (x < 0 || x >= m_width || y < 0 || y >= m_height) return;
+        if (on) m_rows[y] |= 1u << x;
+        else m_rows[y] &= ~(1u << x);
+    }
+
+    uint32_t population() const {
+        uint32_t n = 0;
+        for (int y = 0; y < m_height; y++) n += fixmath::popcount32(m_rows[y]);
+        return n;
+    }
+
+    // Unit step of octant 0..7, counter-clockwise from +x: (1,0), (1,1), (0,1), ...
+    static int octantX(int octant) {
+        static const int8_t kX[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+        return kX[octant & 7];
+    }
+    static int octantY(int octant) {
+        static const int8_t kY[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+        return kY[octant & 7];
+    }
+
+    // Octant for this step from a binary angle (65536 = one turn, 0 = +x,
+    // 16384 = +y): the one below, or the one above as often as the angle
+    // is past it (error diffusion, so the mix is exact over a few steps)
+    int octantFor(uint16_t angle) {
+        const int below = angle >> 13;
+        m_dither += angle & 0x1FFF;
+        if (m_dither < 0x2000) return below;
+        m_dither -= 0x2000;
+        return (below + 1) & 7;
+    }
+
+    // One step under gravity at `angle`; returns the number of grains that moved
+    int step(uint16_t angle) { return stepOctant(octantFor(angle)); }
+
+    int stepOctant(int octant) {
+        uint32_t moved[kMaxRows] = {};  // Grains that already moved this step, at their new cells
+        uint32_t first[kMaxRows];       // Grains that try octant - 1 before octant + 1
+        for (int y = 0; y < m_height; y++) first[y] = next();
+
+        int count = move(octant, kAll, moved, first);
+        count += move(octant - 1, kFirst, moved, first);
+        count += move(octant + 1, kSecond, moved, first);
+        count += move(octant + 1, kFirst, moved, first);
+        count += move(octant - 1, kSecond, moved, first);
+        return count;
+    }
+
+private:
+    enum Group { kAll, kFirst, kSecond };
+
+    // One pass in one direction for a group of grains, leading row first
+    int move(int octant, Group group, uint32_t* moved, const uint32_t* first) {
+        const int dx = octantX(octant), dy = octantY(octant);
+        int count = 0;
+        for (int i = 0; i < m_height; i++) {
+            const int y = dy > 0 ? m_height - 1 - i : i;
+            const int to = y + dy;
+            if (to < 0 || to >= m_height) continue;
+            uint32_t grains = m_rows[y] & ~moved[y];
+            if (group == kFirst) grains &= first[y];
+            else if (group == kSecond) grains &= ~first[y];
+            uint32_t landing = dx > 0 ? (grains << 1) : (dx < 0 ? grains >> 1 : grains);
+            landing &= m_mask & ~m_rows[to];
+            if (landing == 0) continue;
+            const uint32_t leaving = dx > 0 ? landing >> 1 : (dx < 0 ? landing << 1 : landing);
+            m_rows[y] &= ~leaving;
+            m_rows[to] |= landing;
+            moved[to] |= landing;
+            count += fixmath::popcount32(landing);
+        }
+        return count;
+    }
+
+    uint32_t next() { return fixmath::xorshift32(m_rng); }
+
+    int m_width = 16, m_height = 10;
+    uint32_t m_mask = 0xFFFF;
+    uint32_t m_rows[kMaxRows] = {};
+    uint32_t m_rng = 0x9E3779B9u;
+    uint32_t m_dither = 0;
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Integer accelerometer pipeline: bias removal, first-order IIR
+ * low-pass and per-axis sign, all in fixed point (no float or double).
+ * State is raw LSB in Q.kStateBits. Alpha is the weight of the new sample
+ * in 1/256 (77 ~= the old 0.3 blend). Pure and host-portable.
+ *
+ * Range: inputs are int16 LSB and biases are clamped to +-1 g at +-2 g, so
+ * (sample - state) * alpha stays below 2^31.
+ */
+class SensorFilter {
+public:
+    enum Axis { X = 0, Y = 1, Z = 2 };
+    static constexpr int kAxes = 3;
+    static constexpr int kStateBits = 6;
+    static constexpr int kAlphaBits = 8;
+    static constexpr int32_t kOneG = 16384;  // LSB per g at the +-2 g range
+    static constexpr int32_t kMaxBiasQ = kOneG << kStateBits;
+
+    explicit SensorFilter(uint16_t alpha = 77) { setAlpha(alpha); }
+
+    void setAlpha(uint16_t alpha) { m_alpha = alpha == 0 ? 1 : (alpha > 256 ? 256 : alpha); }
+    uint16_t alpha() const { return m_alpha; }
+
+    // Offset subtracted before filtering, in state units (LSB << kStateBits)
+    void setBias(int axis, int32_t biasQ) {
+        if (biasQ > kMaxBiasQ) biasQ = kMaxBiasQ;
+        if (biasQ < -kMaxBiasQ) biasQ = -kMaxBiasQ;
+        m_bias[axis] = biasQ;
+    }
+    int32_t bias(int axis) const { return m_bias[axis]; }
+
+    // -1 flips an axis after bias removal (board mounting)
+    void setSign(int axis, int8_t sign) { m_sign[axis] = sign < 0 ? -1 : 1; }
+
+    // Jumps the filter to `raw` (no settling ramp after calibration or wake)
+    void reset(const int16_t raw[kAxes]) {
+        for (int a = 0; a < kAxes; a++) m_state[a] = input(a, raw[a]);
+    }
+
+    void update(const int16_t raw[kAxes]) {
+        for (int a = 0; a < kAxes; a++) {
+            const int32_t x = input(a, raw[a]);
+            m_state[a] += ((x - m_state[a]) * m_alpha) >> kAlphaBits;
+        }
+    }
+
+    // Filtered axis in state units
+    int32_t q(int axis) const { return m_state[axis]; }
+
+    // Filtered axis in raw LSB, rounded to nearest
+    int32_t lsb(int axis) const { return (m_state[axis] + (1 << (kStateBits - 1))) >> kStateBits; }
+
+    // Filtered axis scaled so that 1 g == unitsPerG, rounded to nearest
+    int32_t units(int axis, int32_t unitsPerG) const {
+        const int shift = 14 + kStateBits;  // kOneG == 1 << 14
+        const int64_t scaled = (int64_t)m_state[axis] * unitsPerG;
+        return (int32_t)((scaled + ((int64_t)1 << (shift - 1))) >> shift);
+    }
+
+    // One unfiltered sample with bias and sign applied, raw LSB
+    int32_t corrected(int axis, int16_t raw) const { return input(axis, raw) / (1 << kStateBits); }
+
+    // Averages `count` raw samples into a bias in state units
+    static int32_t biasFromSum(int32_t sum, int32_t count) {
+        return count > 0 ? (int32_t)((int64_t)sum * (1 << kStateBits) / count) : 0;
+    }
+
+private:
+    int32_t input(int axis, int16_t raw) const {
+        const int32_t x = (int32_t)raw * (1 << kStateBits) - m_bias[axis];
+        return m_sign[axis] < 0 ? -x : x;
+    }
+
+    int32_t m_state[kAxes] = {0, 0, 0};
+    int32_t m_bias[kAxes] = {0, 0, 0};
+    int8_t m_sign[kAxes] = {1, 1, 1};
+    uint16_t m_alpha = 77;
+};
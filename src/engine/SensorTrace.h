@@ -0,0 +1,254 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Compact binary sensor trace: timestamped raw IMU samples and
+ * debounced button edges, in the order the game task saw them.
+ *
+ * Layout: a fixed Header, then records. Each record is a tag byte, the time
+ * since the previous record (unsigned LEB128, microseconds) and, for
+ * samples, the six raw axes (ax ay az gx gy gz) as zig-zag LEB128 deltas
+ * from the previous sample. A still device costs ~10 bytes per sample
+ * instead of 16. Little-endian, identical on the ESP32 and the host.
+ * Pure and host-portable.
+ */
+namespace sensortrace {
+
+static constexpr uint32_t kMagic = 0x3154584Du;  // "MXT1"
+static constexpr uint16_t kVersion = 1;
+static constexpr int kAxes = 6;
+static constexpr size_t kMaxRecordBytes = 1 + 5 + kAxes * 3;
+
+struct Header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t sampleHz;
+    uint32_t seed;        // random() seed the mode ran with
+    int32_t biasX, biasY; // Calibration in effect (SensorFilter state units)
+    uint8_t modeIndex;
+    uint8_t reserved[3];
+    uint32_t records;
+    uint32_t bytes;       // Whole trace, header included
+    uint32_t durationUs;
+};
+
+enum Tag : uint8_t {
+    TagSample = 0x01,
+    TagEdge = 0x02,        // | TagPressed for a press
+    TagPressed = 0x04,
+};
+
+struct Record {
+    enum class Type : uint8_t { Sample, Edge };
+    Type type;
+    uint32_t tUs;          // Since the start of the trace
+    int16_t imu[kAxes];    // Sample: ax ay az gx gy gz
+    bool pressed;          // Edge
+};
+
+class Writer {
+public:
+    Writer() {}
+    Writer(uint8_t* buffer, size_t capacity) : m_buf(buffer), m_cap(capacity) {}
+
+    bool begin(const Header& header) {
+        m_header = header;
+        m_header.magic = kMagic;
+        m_header.version = kVersion;
+        m_header.records = 0;
+        m_header.durationUs = 0;
+        m_len = sizeof(Header);
+        m_started = false;
+        m_full = m_buf == nullptr || m_cap < sizeof(Header);
+        memset(m_prev, 0, sizeof(m_prev));
+        finish();
+        return !m_full;
+    }
+
+    // Returns false (and stops accepting) once the buffer is full
+    bool addSample(uint32_t tUs, const int16_t imu[kAxes]) {
+        if (!open(tUs, TagSample)) return false;
+        for (int a = 0; a < kAxes; a++) {
+            putSigned((int32_t)imu[a] - m_prev[a]);
+            m_prev[a] = imu[a];
+        }
+        return true;
+    }
+
+    bool addEdge(uint32_t tUs, bool pressed) {
+        return open(tUs, (uint8_t)(TagEdge | (pressed ? TagPressed : 0)));
+    }
+
+    // Writes the header counters; the buffer is a complete trace after this
+    size_t finish() {
+        m_header.bytes = (uint32_t)m_len;
+        if (m_buf != nullptr && m_cap >= sizeof(Header)) memcpy(m_buf, &m_header, sizeof(Header));
+        return m_len;
+    }
+
+    bool full() const { return m_full; }
+    size_t size() const { return m_len; }
+    const Header& header() const { return m_header; }
+
+private:
+    bool open(uint32_t tUs, uint8_t tag) {
+        if (m_full || m_len + kMaxRecordBytes > m_cap) {
+            m_full = true;
+            return false;
+        }
+        if (!m_started) {
+            m_started = true;
+            m_startUs = m_lastUs = tUs;
+        }
+        // Edges reach the game task after the samples around them; keep
+        // the order it saw them in and never step back in time
+        if ((int32_t)(tUs - m_lastUs) < 0) tUs = m_lastUs;
+        m_buf[m_len++] = tag;
+        putUnsigned(tUs - m_lastUs);
+        m_lastUs = tUs;
+        m_header.records++;
+        m_header.durationUs = tUs - m_startUs;
+        return true;
+    }
+
+    void putUnsigned(uint32_t v) {
+        while (v >= 0x80) {
+            m_buf[m_len++] = (uint8_t)(v | 0x80);
+            v >>= 7;
+        }
+        m_buf[m_len++] = (uint8_t)v;
+    }
+
+    void putSigned(int32_t v) { putUnsigned(((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); }
+
+    uint8_t* m_buf = nullptr;
+    size_t m_cap = 0;
+    size_t m_len = 0;
+    Header m_header = {};
+    bool m_started = false;
+    bool m_full = true;
+    uint32_t m_startUs = 0;
+    uint32_t m_lastUs = 0;
+    int32_t m_prev[kAxes] = {};
+};
+
+class Reader {
+public:
+    Reader() {}
+    Reader(const uint8_t* data, size_t length) { open(data, length); }
+
+    // False if the header is missing, foreign or claims more bytes than given
+    bool open(const uint8_t* data, size_t length) {
+        m_data = data;
+        m_len = 0;
+        m_valid = false;
+        if (data == nullptr || length < sizeof(Header)) return false;
+        memcpy(&m_header, data, sizeof(Header));
+        if (m_header.magic != kMagic || m_header.version != kVersion) return false;
+        if (m_header.bytes < sizeof(Header) || m_header.bytes > length) return false;
+        m_len = m_header.bytes;
+        m_valid = true;
+        rewind();
+        return true;
+    }
+
+    void rewind() {
+        m_pos = sizeof(Header);
+        m_tUs = 0;
+        memset(m_prev, 0, sizeof(m_prev));
+    }
+
+    bool valid() const { return m_valid; }
+    const Header& header() const { return m_header; }
+
+    // Next record in order; false at the end (or on a truncated record)
+    bool next(Record& out) {
+        if (!m_valid || m_pos >= m_len) return false;
+        const uint8_t tag = m_data[m_pos++];
+        uint32_t dt;
+        if (!getUnsigned(dt)) return false;
+        m_tUs += dt;
+        out.tUs = m_tUs;
+        if (tag & TagEdge) {
+            out.type = Record::Type::Edge;
+            out.pressed = (tag & TagPressed) != 0;
+            return true;
+        }
+        if (!(tag & TagSample)) return false;
+        out.type = Record::Type::Sample;
+        out.pressed = false;
+        for (int a = 0; a < kAxes; a++) {
+            uint32_t z;
+            if (!getUnsigned(z)) return false;
+            m_prev[a] += (int32_t)(z >> 1) ^ -(int32_t)(z & 1);
+            out.imu[a] = (int16_t)m_prev[a];
+        }
+        return true;
+    }
+
+private:
+    bool getUnsigned(uint32_t& v) {
+        v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            if (m_pos >= m_len) return false;
+            const uint8_t b = m_data[m_pos++];
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    const uint8_t* m_data = nullptr;
+    size_t m_len = 0;
+    size_t m_pos = 0;
+    bool m_valid = false;
+    Header m_header = {};
+    uint32_t m_tUs = 0;
+    int32_t m_prev[kAxes] = {};
+};
+
+/**
+ * Paces a trace against a clock: poll() hands out every record whose trace
+ * time has come, re-stamped onto the caller's timeline. The same records
+ * come out in the same order whatever the poll cadence, so a host loop with
+ * a simulated clock and the device loop see identical input.
+ */
+class Player {
+public:
+    bool start(const uint8_t* data, size_t length, uint32_t nowUs) {
+        m_startUs = nowUs;
+        m_havePending = false;
+        m_done = !m_reader.open(data, length);
+        return !m_done;
+    }
+
+    bool poll(uint32_t nowUs, Record& out) {
+        if (m_done) return false;
+        if (!m_havePending) {
+            if (!m_reader.next(m_pending)) {
+                m_done = true;
+                return false;
+            }
+            m_havePending = true;
+        }
+        if ((int32_t)(nowUs - m_startUs - m_pending.tUs) < 0) return false;
+        out = m_pending;
+        out.tUs += m_startUs;
+        m_havePending = false;
+        return true;
+    }
+
+    bool done() const { return m_done; }
+    void stop() { m_done = true; }
+    const Header& header() const { return m_reader.header(); }
+
+private:
+    Reader m_reader;
+    Record m_pending = {};
+    bool m_havePending = false;
+    bool m_done = true;
+    uint32_t m_startUs = 0;
+};
+
+}  // namespace sensortrace
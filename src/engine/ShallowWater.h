@@ -0,0 +1,205 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "FixedMath.h"
+
+/**
+ * @brief Water seen from the side, as a row of columns with a height each
+ * (a 1D shallow-water heightfield). Pure integer math and host-portable.
+ *
+ * The box is width x height cells (panel x by panel y). Whichever of its
+ * four walls gravity points at most is the floor; the columns stand on it,
+ * so there are `height` columns of depth `width` on a floor of +-x and
+ * `width` columns of depth `height` on +-y. Heights are Q16 cells, fine
+ * enough that rounding leaves no visible ripple once the water is still.
+ *
+ * Neighbouring columns exchange water through a flow that the difference
+ * in level pushes (times the component of gravity into the floor) and the
+ * sideways component of gravity pulls, so a tilted surface settles
+ * perpendicular to gravity and sloshes on the way; the flow keeps its
+ * momentum from step to step and loses 1/2^damping of it each step. A
+ * column never gives more than it holds and never ends fuller than the
+ * box, and every exchange is an integer amount taken from one column and
+ * added to the other, so the volume never changes, including when the
+ * floor moves to another wall (the water is re-stacked on the new floor).
+ */
+class ShallowWater {
+public:
+    static constexpr int kMaxCells = 32;
+    static constexpr int32_t kOneG = 1 << 14;  // Gravity units, as SensorFilter
+    static constexpr int32_t kCell = 1 << 16;  // One cell of height
+
+    enum Floor : uint8_t { PosX, NegX, PosY, NegY };
+
+    ShallowWater(int width = 10, int height = 16) { configure(width, height); }
+
+    void configure(int width, int height) {
+        m_width = width < 2 ? 2 : (width > kMaxCells ? kMaxCells : width);
+        m_height = height < 2 ? 2 : (height > kMaxCells ? kMaxCells : height);
+        m_floor = PosY;
+        clear();
+    }
+
+    void clear() {
+        memset(m_level, 0, sizeof(m_level));
+        memset(m_flow, 0, sizeof(m_flow));
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Level change per step per cell of height difference at 1 g, Q8 (about
+    // 0.15 by default: waves cross ~0.4 cells per step). Keep it under 256.
+    void setStiffness(int32_t q8) { m_stiffness = q8 < 1 ? 1 : (q8 > 255 ? 255 : q8); }
+    // Flow lost per step: 1/2^shift
+    void setDamping(int shift) { m_damping = shift < 1 ? 1 : (shift > 16 ? 16 : shift); }
+
+    Floor floor() const { return m_floor; }
+    int columns() const { return vertical() ? m_width : m_height; }
+    int depth() const { return vertical() ? m_height : m_width; }
+
+    // Column heights in Q16 cells, from the floor up
+    int32_t* levels() { return m_level; }
+    const int32_t* levels() const { return m_level; }
+
+    // Still water of `volume` (Q16 cells) on the current floor
+    void fill(int32_t volume) {
+        clear();
+        const int n = columns();
+        const int32_t capacity = (int32_t)n * depth() * kCell;
+        if (volume > capacity) volume = capacity;
+        if (volume < 0) volume = 0;
+        for (int i = 0; i < n; i++) m_level[i] = volume / n + (i < volume % n ? 1 : 0);
+    }
+
+    // Still water with the given floor and column heights (clamped to the box)
+    void load(Floor floor, const int32_t* levels) {
+        m_floor = floor;
+        clear();
+        for (int i = 0; i < columns(); i++) m_level[i] = clamp(levels[i], 0, depth() * kCell);
+    }
+
+    int32_t volume() const {
+        int32_t total = 0;
+        for (int i = 0; i < columns(); i++) total += m_level[i];
+        return total;
+    }
+
+    // How full cell (x, y) is, 0..kCell
+    int32_t cell(int x, int y) const {
+        if (x < 0 || x >= m_width || y < 0 || y >= m_height) return 0;
+        int column, up;
+        switch (m_floor) {
+            case PosX: column = y; up = m_width - 1 - x; break;
+            case NegX: column = y; up = x; break;
+            case PosY: column = x; up = m_height - 1 - y; break;
+            default: column = x; up = y; break;
+        }
+        const int32_t above = m_level[column] - up * kCell;
+        return above <= 0 ? 0 : (above >= kCell ? kCell : above);
+    }
+
+    // Gravity in the box's plane, kOneG = 1 g. Moves the floor to the wall it
+    // points at most once that beats the current floor by `hysteresis`.
+    void setGravity(int32_t gx, int32_t gy, int32_t hysteresis = kOneG / 8) {
+        gx = clamp(gx, -2 * kOneG, 2 * kOneG);
+        gy = clamp(gy, -2 * kOneG, 2 * kOneG);
+        const int32_t pull[4] = { gx, -gx, gy, -gy };
+        int best = m_floor;
+        for (int f = 0; f < 4; f++) if (pull[f] > pull[best]) best = f;
+        if (best != m_floor && pull[best] > pull[m_floor] + hysteresis) restack((Floor)best);
+        m_down = pull[m_floor];
+        m_side = vertical() ? gx : gy;
+    }
+
+    // Kicks every flow by up to +-amount (Q16 cells per step), pseudo-randomly
+    void splash(uint32_t seed, int32_t amount) {
+        if (seed == 0) seed = 0x9E3779B9u;
+        for (int i = 0; i + 1 < columns(); i++) {
+            m_flow[i] += (int32_t)(fixmath::xorshift32(seed) % (uint32_t)(2 * amount + 1)) - amount;
+        }
+    }
+
+    // One time step; returns the total level change, Q16 cells (0 once the water is still)
+    int32_t step() {
+        const int n = columns();
+        const int32_t capacity = depth() * kCell;
+        const int32_t down = m_down > 0 ? m_down : 0;  // Water on the ceiling just drifts
+
+        // Pressure and tilt accelerate each flow (Q16 cells per step from column i to i + 1)
+        for (int i = 0; i + 1 < n; i++) {
+            const int64_t push = ((int64_t)down * (m_level[i] - m_level[i + 1]) + (int64_t)m_side * kCell) >> 14;
+            m_flow[i] += (int32_t)((push * m_stiffness) >> 8);
+            // Damping rounds away from zero, so the last trickle stops too
+            m_flow[i] -= (m_flow[i] + (m_flow[i] > 0 ? (1 << m_damping) - 1 : 0)) >> m_damping;
+        }
+
+        // No column gives more than it has: outflows are scaled down together
+        for (int i = 0; i < n; i++) {
+            const int32_t right = m_flow[i] > 0 ? m_flow[i] : 0;
+            const int32_t left = i > 0 && m_flow[i - 1] < 0 ? -m_flow[i - 1] : 0;
+            const int32_t out = right + left;
+            if (out <= m_level[i]) continue;
+            if (right) m_flow[i] = (int32_t)((int64_t)right * m_level[i] / out);
+            if (left) m_flow[i - 1] = -(int32_t)((int64_t)left * m_level[i] / out);
+        }
+
+        int32_t change = 0;
+        for (int i = 0; i + 1 < n; i++) {
+            m_level[i] -= m_flow[i];
+            m_level[i + 1] += m_flow[i];
+            change += m_flow[i] < 0 ? -m_flow[i] : m_flow[i];
+        }
+
+        // A full column can take no more: overflow spills on sideways, out
+        // and back, and always fits because the volume does
+        for (int i = 0; i + 1 < n; i++) {
+            if (m_level[i] <= capacity) continue;
+            m_level[i + 1] += m_level[i] - capacity;
+            m_level[i] = capacity;
+            if (m_flow[i] < 0) m_flow[i] = 0;
+        }
+        for (int i = n - 1; i > 0; i--) {
+            if (m_level[i] <= capacity) continue;
+            m_level[i - 1] += m_level[i] - capacity;
+            m_level[i] = capacity;
+            if (m_flow[i - 1] > 0) m_flow[i - 1] = 0;
+        }
+        return change;
+    }
+
+    // Cells at least half full, as panel row words: rows[x] bit y
+    void render(uint32_t* rows) const {
+        for (int x = 0; x < m_width; x++) {
+            rows[x] = 0;
+            for (int y = 0; y < m_height; y++) if (cell(x, y) >= kCell / 2) rows[x] |= 1u << y;
+        }
+    }
+
+private:
+    bool vertical() const { return m_floor == PosY || m_floor == NegY; }
+
+    static int32_t clamp(int32_t v, int32_t lo, int32_t hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+    // Stacks every column's share of each cell onto the new floor. Sums
+    // straight into the new columns (128 bytes of stack), not via a copy of
+    // the whole cell grid, which would be 4 KB of the game task's stack.
+    void restack(Floor floor) {
+        const bool toVertical = floor == PosY || floor == NegY;
+        int32_t next[kMaxCells] = {};
+        for (int x = 0; x < m_width; x++) {
+            for (int y = 0; y < m_height; y++) next[toVertical ? x : y] += cell(x, y);
+        }
+        m_floor = floor;
+        clear();
+        memcpy(m_level, next, sizeof(m_level));
+    }
+
+    int m_width = 10, m_height = 16;
+    Floor m_floor = PosY;
+    int32_t m_down = kOneG, m_side = 0;
+    int32_t m_stiffness = 38;
+    int m_damping = 7;
+    int32_t m_level[kMaxCells] = {};
+    int32_t m_flow[kMaxCells] = {};  // Last one always 0
+};
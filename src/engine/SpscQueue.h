@@ -0,0 +1,83 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring of fixed-size slots.
+ * No heap: storage lives inside the object. Capacity must be a power of two;
+ * one producer context (task or ISR) and one consumer task only.
+ * push()/pop() are force-inlined so they stay in IRAM when called from an ISR.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    __attribute__((always_inline)) inline bool push(const T& item) {
+        const uint32_t head = m_head.load(std::memory_order_relaxed);
+        const uint32_t used = head - m_tail.load(std::memory_order_acquire);
+        if (used >= Capacity) {
+            m_dropped++;
+            return false;
+        }
+        if (used + 1 > m_peak) m_peak = used + 1;
+        m_slots[head & (Capacity - 1)] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Two-phase push for large slots: fill claim() in place, then commit()
+    T* claim() {
+        const uint32_t head = m_head.load(std::memory_order_relaxed);
+        const uint32_t used = head - m_tail.load(std::memory_order_acquire);
+        if (used >= Capacity) {
+            m_dropped++;
+            return nullptr;
+        }
+        if (used + 1 > m_peak) m_peak = used + 1;
+        return &m_slots[head & (Capacity - 1)];
+    }
+
+    void commit() {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    __attribute__((always_inline)) inline bool pop(T& out) {
+        const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) return false;
+        out = m_slots[tail & (Capacity - 1)];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer-side peek for large slots: read front() in place, then release()
+    const T* front() const {
+        const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) return nullptr;
+        return &m_slots[tail & (Capacity - 1)];
+    }
+
+    void release() {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    uint32_t dropped() const { return m_dropped; }
+    // Most slots ever in use at once (a claimed slot counts)
+    uint32_t peak() const { return m_peak; }
+
+private:
+    T m_slots[Capacity];
+    std::atomic<uint32_t> m_head{0};
+    std::atomic<uint32_t> m_tail{0};
+    uint32_t m_dropped = 0;  // Producer-side only
+    uint32_t m_peak = 0;     // Producer-side only
+};
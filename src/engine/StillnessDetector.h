@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Finds windows of raw accelerometer samples where the device did not
+ * move: every axis stayed within `maxSpread` LSB for `windowSamples` samples.
+ * A completed window exposes its per-axis mean (a clean bias estimate).
+ * Pure and host-portable.
+ */
+class StillnessDetector {
+public:
+    StillnessDetector(uint16_t windowSamples, int16_t maxSpread)
+        : m_window(windowSamples), m_spread(maxSpread) {}
+
+    // Returns true when a still window completes; mean() holds its average
+    bool add(int16_t x, int16_t y, int16_t z) {
+        const int16_t v[3] = { x, y, z };
+        if (m_count > 0) {
+            for (int a = 0; a < 3; a++) {
+                const int16_t lo = v[a] < m_min[a] ? v[a] : m_min[a];
+                const int16_t hi = v[a] > m_max[a] ? v[a] : m_max[a];
+                if (hi - lo > m_spread) {
+                    m_count = 0;  // Moved: this sample starts a new window
+                    break;
+                }
+            }
+        }
+        for (int a = 0; a < 3; a++) {
+            if (m_count == 0) {
+                m_min[a] = m_max[a] = v[a];
+                m_sum[a] = 0;
+            }
+            if (v[a] < m_min[a]) m_min[a] = v[a];
+            if (v[a] > m_max[a]) m_max[a] = v[a];
+            m_sum[a] += v[a];
+        }
+        if (++m_count < m_window) return false;
+
+        for (int a = 0; a < 3; a++) m_mean[a] = (int16_t)(m_sum[a] / (int32_t)m_count);
+        m_count = 0;
+        return true;
+    }
+
+    void reset() { m_count = 0; }
+
+    // Average of the last completed window, raw LSB
+    int16_t mean(int axis) const { return m_mean[axis]; }
+
+private:
+    uint16_t m_window;
+    int16_t m_spread;
+    uint16_t m_count = 0;
+    int16_t m_min[3] = {0, 0, 0};
+    int16_t m_max[3] = {0, 0, 0};
+    int32_t m_sum[3] = {0, 0, 0};
+    int16_t m_mean[3] = {0, 0, 0};
+};
@@ -0,0 +1,189 @@
+#pragma once
+#include <stdint.h>
+#include "FixedMath.h"
+#include "Meshes.h"
+
+/**
+ * @brief Fixed-point wireframe renderer: one Q14 rotation matrix per frame,
+ * perspective (or orthographic) projection, near-plane and screen clipping,
+ * and Bresenham lines written straight into a 1-bit framebuffer in the
+ * GFXcanvas1 layout (rows of (width + 7) / 8 bytes, most significant bit
+ * leftmost). Pure and host-portable.
+ *
+ * View space: x right, y down (as the panel), z into the screen. The mesh
+ * centre sits `distance` in front of the eye; a point at depth z lands
+ * focal * x / z pixels from the viewport centre. Distance 0 switches to
+ * orthographic: focal pixels per unit.
+ */
+class Wireframe {
+public:
+    static constexpr int kMaxVertices = 32;
+    static constexpr int32_t kNearQ8 = 32;  // Near plane, 1/8 unit in front of the eye
+
+    struct Matrix { int32_t m[3][3]; };  // Q14
+
+    struct Stats {
+        uint32_t vertices = 0;  // Transformed and projected
+        uint32_t edges = 0;     // Drawn (at least partly on screen)
+        uint32_t culled = 0;    // Entirely behind the near plane or off screen
+        uint32_t pixels = 0;    // Plotted (overlaps counted again)
+    };
+
+    static Matrix identity() {
+        Matrix r = { { { 1 << 14, 0, 0 }, { 0, 1 << 14, 0 }, { 0, 0, 1 << 14 } } };
+        return r;
+    }
+
+    static Matrix multiply(const Matrix& a, const Matrix& b) {
+        Matrix r;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                r.m[i][j] = (a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + (1 << 13)) >> 14;
+            }
+        }
+        return r;
+    }
+
+    // Rotation about x by ax, then about y by ay, then about z by az (binary angles)
+    static Matrix rotation(uint16_t ax, uint16_t ay, uint16_t az) {
+        const int32_t cx = fixmath::cos(ax) >> 2, sx = fixmath::sin(ax) >> 2;
+        const int32_t cy = fixmath::cos(ay) >> 2, sy = fixmath::sin(ay) >> 2;
+        const int32_t cz = fixmath::cos(az) >> 2, sz = fixmath::sin(az) >> 2;
+        const Matrix rx = { { { 1 << 14, 0, 0 }, { 0, cx, -sx }, { 0, sx, cx } } };
+        const Matrix ry = { { { cy, 0, sy }, { 0, 1 << 14, 0 }, { -sy, 0, cy } } };
+        const Matrix rz = { { { cz, -sz, 0 }, { sz, cz, 0 }, { 0, 0, 1 << 14 } } };
+        return multiply(rz, multiply(ry, rx));
+    }
+
+    // Framebuffer size; the projection centre is (width / 2, height / 2)
+    void setViewport(int width, int height) {
+        m_width = width;
+        m_height = height;
+        m_stride = (width + 7) / 8;
+    }
+
+    // distance in Q8 units (0 = orthographic), focal in pixels
+    void setCamera(int32_t distanceQ8, int32_t focal) {
+        m_distance = distanceQ8;
+        m_focal = focal;
+    }
+
+    // Adds `mesh` under `rotation`, scaled by scaleQ8, to the framebuffer
+    void draw(const Mesh& mesh, const Matrix& rotation, int32_t scaleQ8, uint8_t* buffer) {
+        int32_t view[kMaxVertices][3];
+        int32_t screen[kMaxVertices][2];
+        const int count = mesh.vertexCount < kMaxVertices ? mesh.vertexCount : kMaxVertices;
+
+        for (int i = 0; i < count; i++) {
+            const int16_t* v = mesh.vertices[i];
+            for (int r = 0; r < 3; r++) {
+                const int32_t p = (rotation.m[r][0] * v[0] + rotation.m[r][1] * v[1] + rotation.m[r][2] * v[2]) >> 14;
+                view[i][r] = (p * scaleQ8) >> 8;
+            }
+            view[i][2] += m_distance;
+            if (m_distance == 0 || view[i][2] >= kNearQ8) project(view[i], screen[i]);
+        }
+        m_stats.vertices += count;
+
+        for (int e = 0; e < mesh.edgeCount; e++) {
+            const int a = mesh.edges[e][0], b = mesh.edges[e][1];
+            if (a >= count || b >= count) continue;
+            int32_t pa[2] = { screen[a][0], screen[a][1] };
+            int32_t pb[2] = { screen[b][0], screen[b][1] };
+
+            // Edges through the near plane are cut at it
+            if (m_distance != 0) {
+                const bool inA = view[a][2] >= kNearQ8, inB = view[b][2] >= kNearQ8;
+                if (!inA && !inB) {
+                    m_stats.culled++;
+                    continue;
+                }
+                if (!inA || !inB) {
+                    const int32_t* in = inA ? view[a] : view[b];
+                    const int32_t* out = inA ? view[b] : view[a];
+                    const int32_t dz = in[2] - out[2];
+                    int32_t cut[3] = {
+                        out[0] + (int32_t)((int64_t)(in[0] - out[0]) * (kNearQ8 - out[2]) / dz),
+                        out[1] + (int32_t)((int64_t)(in[1] - out[1]) * (kNearQ8 - out[2]) / dz),
+                        kNearQ8,
+                    };
+                    project(cut, inA ? pb : pa);
+                }
+            }
+
+            if (!clip(pa, pb)) {
+                m_stats.culled++;
+                continue;
+            }
+            line(pa[0], pa[1], pb[0], pb[1], buffer);
+            m_stats.edges++;
+        }
+    }
+
+    const Stats& stats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+private:
+    // View space (Q8) to pixels, rounded to nearest
+    void project(const int32_t* v, int32_t* out) const {
+        for (int i = 0; i < 2; i++) {
+            const int64_t q4 = m_distance == 0 ? ((int64_t)v[i] * m_focal) >> 4
+                                               : ((int64_t)v[i] * m_focal * 16) / v[2];
+            out[i] = (int32_t)((q4 + 8) >> 4) + (i == 0 ? m_width : m_height) / 2;
+        }
+    }
+
+    int outcode(const int32_t* p) const {
+        return (p[0] < 0 ? 1 : 0) | (p[0] >= m_width ? 2 : 0) | (p[1] < 0 ? 4 : 0) | (p[1] >= m_height ? 8 : 0);
+    }
+
+    // Cohen-Sutherland against the framebuffer; false if nothing is left
+    bool clip(int32_t* a, int32_t* b) const {
+        int codeA = outcode(a), codeB = outcode(b);
+        while (codeA | codeB) {
+            if (codeA & codeB) return false;
+            int32_t* p = codeA ? a : b;
+            const int32_t* q = codeA ? b : a;
+            const int code = codeA ? codeA : codeB;
+            const int64_t dx = q[0] - p[0], dy = q[1] - p[1];
+            if (code & (4 | 8)) {
+                const int32_t y = (code & 4) ? 0 : m_height - 1;
+                p[0] += (int32_t)(dx * (y - p[1]) / dy);
+                p[1] = y;
+            } else {
+                const int32_t x = (code & 1) ? 0 : m_width - 1;
+                p[1] += (int32_t)(dy * (x - p[0]) / dx);
+                p[0] = x;
+            }
+            if (p == a) codeA = outcode(a);
+            else codeB = outcode(b);
+        }
+        return true;
+    }
+
+    // Bresenham; both ends are on screen
+    void line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t* buffer) {
+        const int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1, sx = x0 < x1 ? 1 : -1;
+        const int32_t dy = y1 > y0 ? y0 - y1 : y1 - y0, sy = y0 < y1 ? 1 : -1;
+        int32_t err = dx + dy;
+        for (;;) {
+            buffer[y0 * m_stride + (x0 >> 3)] |= (uint8_t)(0x80 >> (x0 & 7));
+            m_stats.pixels++;
+            if (x0 == x1 && y0 == y1) break;
+            const int32_t e2 = 2 * err;
+            if (e2 >= dy) {
+                err += dy;
+                x0 += sx;
+            }
+            if (e2 <= dx) {
+                err += dx;
+                y0 += sy;
+            }
+        }
+    }
+
+    int m_width = 10, m_height = 16, m_stride = 2;
+    int32_t m_distance = 3 << 8;
+    int32_t m_focal = 12;
+    Stats m_stats;
+};
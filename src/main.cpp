@@ -1,11 +1,24 @@
 #include <Arduino.h>
-#include <OneButton.h>
 #include <Wire.h>
+#include <esp_timer.h>
 #include "Config.h"
 #include "Globals.h"
 #include "drivers/DisplayDriver.h"
 #include "drivers/CommsManager.h"
+#include "drivers/ButtonInput.h"
+#include "drivers/ImuSampler.h"
 #include "ResourceMonitor.h"
+#include "FrameBudget.h"
+#include "StaticTasks.h"
+#include "IdleGate.h"
+#include "PowerManager.h"
+#include "SleepManager.h"
+#include "CalibrationStore.h"
+#include "SensorRecorder.h"
+#include "GestureClassifier.h"
+#include "engine/DriftTracker.h"
+#include "engine/StillnessDetector.h"
+#include "engine/ModeTransition.h"
 
 #ifndef VERSION_TAG
   #define VERSION_TAG "DEV-LOCAL"
@@ -24,50 +37,310 @@
 #include "modes/ModeMatrix.h"
 #include "modes/ModePomodoro.h"
 #include "modes/BleCanvasMode.h"
+#include "modes/ModePlasma.h"
+#include "modes/ModeLavaLamp.h"
+#include "modes/ModeClouds.h"
+#include "modes/ModeLifeUniverse.h"
+#include "modes/ModeWater.h"
+#include "modes/ModeCube.h"
+#include "modes/ModeStarfield.h"
+#include "modes/ModeFireworks.h"
+#include "modes/ModeRain.h"
+#include "modes/ModeBreakout.h"
+#include "modes/ModeMaze.h"
+#include "modes/ModeLander.h"
+#include "modes/ModeInvaders.h"
 
 int savedModeIndex = 0;      // To remember where we were
 bool isSpecialMode = false;  // To track if we are in the special mode
 const int SPECIAL_MODE_ID = 10; // Index of ModeMatrix (or whichever you want)
-const int VISIBLE_MODES = 11;
 const int APP_CONTROLLED_MODE_ID = 11;
+const int SCROLL_MODE_ID = 8;
 // --- GLOBALS ---
 GFXcanvas1 canvas(MATRIX_WIDTH, MATRIX_HEIGHT);
 MPU6050 mpu(0x68, &Wire);
-float accX = 0, accY = 0;
-
-// NEW: Calibration Variables
-float calibX = 0, calibY = 0;
+int32_t accX = 0, accY = 0;
+SensorFilter sensorFilter;  // Calibration offsets live here as filter biases
+OrientationFilter orientation(IMU_SAMPLE_HZ, FUSION_TAU_MS);
+bool orientationSeeded = false;
+uint32_t fusionCyclesX8 = 0;  // EWMA (1/8 weight) of CPU cycles per fused sample
+
+static GestureRecognizer::Thresholds gestureThresholds() {
+    GestureRecognizer::Thresholds t;
+    t.tiltEnter = GESTURE_TILT_ENTER;
+    t.tiltExit = GESTURE_TILT_EXIT;
+    t.holdMs = GESTURE_HOLD_MS;
+    t.motionLsb = GESTURE_MOTION_LSB;
+    t.faceDownZ = FACE_DOWN_Z;
+    t.faceDownMs = GESTURE_FACE_DOWN_MS;
+    return t;
+}
+GestureRecognizer gestures(gestureThresholds());
+GestureClassifier classifier;
+CalibrationStore calibration;
+StillnessDetector stillness(CALIB_STILL_SAMPLES, CALIB_STILL_SPREAD);
+DriftTracker drift(CALIB_DRIFT_LSB, CALIB_DRIFT_STEP_LSB, CALIB_DRIFT_MAX_LSB, CALIB_DRIFT_AGREE, CALIB_DRIFT_GAP_MS);
+bool recalibrateRequested = false;
 
 SemaphoreHandle_t dispMutex;
-volatile bool modeChangeRequest = false;
-volatile int requestedModeIndex = 0;
+static StaticSemaphore_t dispMutexBuffer;
+STATIC_TASK_BUFFERS(gameTask, GAME_TASK_STACK);
+STATIC_TASK_BUFFERS(commsTask, COMMS_TASK_STACK);
+EngineMailbox commsMailbox;
+EngineMailbox inputMailbox;
 volatile int activeModeIndex = 0;
-String appScrollText = "circuito_suman";
-volatile int appScrollDirection = 0;
-volatile bool appScrollDirectionOverride = false;
+AppScrollState appScroll = { "circuito_suman", 0, 0, false };
 
 Mode* currentMode = nullptr;
-Mode* allModes[12]; 
-const int MODE_COUNT = 12;
+Mode* allModes[25]; 
+ModeLifeUniverse* universeMode = nullptr;  // allModes[15]; also a stats source
+const int MODE_COUNT = 25;
 int modeIndex = 0;
 
-OneButton btn(btn_pin, true); 
+ButtonInput btn;
+ImuSampler imu;
+IdleGate idleGate;
+PowerManager power;
+SleepManager sleepManager;
+SensorRecorder recorder;
+EventGroupHandle_t engineEvents = nullptr;
+
+void nextMode();
+void resetMode();
+void toggleSpecialMode();
+
+// Global actions for button events the active mode didn't consume
+static void dispatchButton(ButtonEvent event) {
+    idleGate.resume();
+    sleepManager.noteActivity();
+    if (currentMode != nullptr && currentMode->onButton(event)) return;
+
+    switch (event) {
+        case ButtonEvent::Click:       nextMode(); break;
+        case ButtonEvent::DoubleClick: resetMode(); break;
+        case ButtonEvent::LongPress:   toggleSpecialMode(); break;
+        case ButtonEvent::DoubleLongPress:
+            postEngineCommand(inputMailbox, EngineCommandType::Recalibrate, 0);
+            break;
+        default: break;
+    }
+}
+
+// Gestures go to the active mode; face-down also drives the sleep timer
+static void dispatchGesture(const Gesture& gesture) {
+    switch (gesture.type) {
+        case GestureType::Shake:
+        case GestureType::Tap:
+        case GestureType::Flick:
+        case GestureType::DoubleTap:
+        case GestureType::Circle:
+            sleepManager.noteActivity();
+            break;
+        case GestureType::FaceDown:
+            sleepManager.noteFaceDown(true);
+            break;
+        case GestureType::FaceUp:
+            sleepManager.noteFaceDown(false);
+            sleepManager.noteActivity();
+            break;
+        default: break;
+    }
+    if (currentMode != nullptr && currentMode->onGesture(gesture)) idleGate.resume();
+}
 
 
 ResourceMonitor monitor; 
+FrameBudget frameBudget;
+static_assert(MODE_COUNT <= FrameBudget::kMaxModes, "FrameBudget needs a stats slot per mode");
+
+// Last frame handed to the display; the outgoing image for transitions
+uint16_t presentedRows[MATRIX_WIDTH];
+ModeTransition transition;
+uint32_t lastSwitchUs = 0, maxSwitchUs = 0;
+
+// Caller holds dispMutex
+static void presentFrame() {
+    uint16_t rows[MATRIX_WIDTH];
+    canvasToPanelRows(rows);
+    transition.blend(rows, presentedRows, millis());
+    displayPresent(presentedRows);
+}
 
+// --- ENGINE COMMANDS (game task only) ---
+// Caller holds dispMutex. The panel keeps showing the outgoing frame while
+// the new mode sets up into the canvas, then blends over MODE_TRANSITION_MS.
+static void switchMode(int index) {
+    int normalized = index % MODE_COUNT;
+    if (normalized < 0) normalized += MODE_COUNT;
+
+    const int64_t t0 = esp_timer_get_time();
+    const bool stepForward = normalized == (modeIndex + 1) % MODE_COUNT;
+    currentMode->teardown();
+    modeIndex = normalized;
+    currentMode = allModes[modeIndex];
+    power.apply(currentMode->powerClass());
+    currentMode->setup();
+    activeModeIndex = modeIndex;
+    frameBudget.resetPolicy();
+    idleGate.resume();
+    gestures.reset();
+    classifier.reset();
+
+    lastSwitchUs = (uint32_t)(esp_timer_get_time() - t0);
+    if (lastSwitchUs > maxSwitchUs) maxSwitchUs = lastSwitchUs;
+
+    transition.start(presentedRows,
+                     stepForward ? ModeTransition::Style::Wipe : ModeTransition::Style::Dissolve,
+                     millis(), MODE_TRANSITION_MS);
+}
 
-// --- FAST LOGIC ENGINE ---
-void taskGameEngine(void * parameter) {
-    // 1. Hardware Init
-    Wire.begin();
-    Wire.setClock(400000); // 400kHz I2C Speed
-    mpu.initialize();
-    
-    // --- 2. CALIBRATION SEQUENCE ---
+static void ensureAppControlledMode() {
+    if (modeIndex != APP_CONTROLLED_MODE_ID) switchMode(APP_CONTROLLED_MODE_ID);
+}
+
+static void setScrollText(const EngineCommand& cmd) {
+    memcpy(appScroll.text, cmd.data, cmd.length + 1);
+    appScroll.revision++;
+}
+
+static void renderTextToCanvas(const char* text) {
+    canvas.fillScreen(0);
+    canvas.setTextSize(1);
+    canvas.setTextWrap(false);
+    canvas.setCursor(0, 4);
+    canvas.print(text);
+}
+
+static void applyCanvasPacked(const uint8_t* payload) {
+    canvas.fillScreen(0);
+    for (int y = 0; y < 16; ++y) {
+        const int rowBase = y * 10;
+        for (int x = 0; x < 10; ++x) {
+            const int bitIndex = rowBase + x;
+            if (payload[bitIndex >> 3] & (1u << (bitIndex & 7))) {
+                canvas.drawPixel(x, y, 1);
+            }
+        }
+    }
+}
+
+// Fused state restarts from the next sample (trace start / end)
+static void resetSensorPipeline() {
+    orientationSeeded = false;
+    orientation.resetBias();
+    stillness.reset();
+}
+
+// Calibration in effect before a replay swapped in the trace's
+static int32_t liveBiasX = 0, liveBiasY = 0;
+
+static void stopTrace() {
+    const bool wasReplaying = recorder.replaying();
+    recorder.stop();
+    if (!wasReplaying) return;
+    sensorFilter.setBias(SensorFilter::X, liveBiasX);
+    sensorFilter.setBias(SensorFilter::Y, liveBiasY);
+    btn.setReplay(false);
+    resetSensorPipeline();
+}
+
+// Recording and replay both restart the mode, so the trace starts from
+// setup() with a known random() seed and calibration
+static void applyTraceCommand(TraceAction action) {
+    switch (action) {
+        case TraceAction::Stop:
+            stopTrace();
+            break;
+        case TraceAction::Record: {
+            if (recorder.state() != SensorRecorder::State::Idle) stopTrace();
+            const uint32_t seed = esp_random();
+            if (!recorder.startRecording(modeIndex, seed, sensorFilter.bias(SensorFilter::X),
+                                         sensorFilter.bias(SensorFilter::Y))) break;
+            randomSeed(seed);
+            resetSensorPipeline();
+            switchMode(modeIndex);
+            break;
+        }
+        case TraceAction::Replay: {
+            if (recorder.state() != SensorRecorder::State::Idle) stopTrace();
+            if (!recorder.startReplay((uint32_t)esp_timer_get_time())) break;
+            const sensortrace::Header& h = recorder.header();
+            liveBiasX = sensorFilter.bias(SensorFilter::X);
+            liveBiasY = sensorFilter.bias(SensorFilter::Y);
+            sensorFilter.setBias(SensorFilter::X, h.biasX);
+            sensorFilter.setBias(SensorFilter::Y, h.biasY);
+            btn.setReplay(true);
+            resetSensorPipeline();
+            randomSeed(h.seed);
+            switchMode(h.modeIndex);
+            break;
+        }
+    }
+}
+
+static void applyEngineCommand(const EngineCommand& cmd) {
+    switch (cmd.type) {
+        case EngineCommandType::SetMode:
+            switchMode(cmd.value);
+            break;
+        case EngineCommandType::StepMode:
+            switchMode(modeIndex + cmd.value);
+            break;
+        case EngineCommandType::SetScrollText:
+            setScrollText(cmd);
+            if (cmd.value != 0 && modeIndex != SCROLL_MODE_ID) switchMode(SCROLL_MODE_ID);
+            break;
+        case EngineCommandType::SetScrollDirection:
+            appScroll.directionOverride = cmd.value >= 0;
+            if (cmd.value >= 0) appScroll.direction = cmd.value;
+            break;
+        case EngineCommandType::ShowText:
+            if (modeIndex == SCROLL_MODE_ID) {
+                setScrollText(cmd);
+            } else {
+                ensureAppControlledMode();
+                renderTextToCanvas(reinterpret_cast<const char*>(cmd.data));
+            }
+            break;
+        case EngineCommandType::Recalibrate:
+            // A trace replays against the offsets it started with; new ones would fork it
+            if (recorder.recording() || recorder.replaying()) {
+                Serial.println("[Trace] recalibrate ignored while a trace runs");
+                break;
+            }
+            recalibrateRequested = true;  // Runs outside dispMutex, see the game loop
+            break;
+        case EngineCommandType::SetCanvas:
+            if (cmd.length == kCanvasPackedBytes) {
+                ensureAppControlledMode();
+                applyCanvasPacked(cmd.data);
+            }
+            break;
+        case EngineCommandType::Trace:
+            applyTraceCommand(static_cast<TraceAction>(cmd.value));
+            break;
+    }
+}
+
+// Applies everything queued since the last frame
+static void drainMailbox(EngineMailbox& box) {
+    if (box.empty()) return;
+    sleepManager.noteActivity();
+    xSemaphoreTake(dispMutex, portMAX_DELAY);
+    while (const EngineCommand* cmd = box.front()) {
+        applyEngineCommand(*cmd);
+        box.release();
+    }
+    xSemaphoreGive(dispMutex);
+}
+
+
+// ~1 s of averaged samples with a blinking centre dot; device must lie still
+static void calibrateAccelerometer() {
     // Visual Cue: Clear screen
     xSemaphoreTake(dispMutex, portMAX_DELAY);
     canvas.fillScreen(0);
+    displayPresentCanvas();
     xSemaphoreGive(dispMutex);
 
     long sumX = 0, sumY = 0;
@@ -75,11 +348,12 @@ void taskGameEngine(void * parameter) {
 
     // Collect 100 samples (takes ~1 second)
     for(int i=0; i<SAMPLES; i++) {
-        int16_t rawX, rawY, rawZ;
-        mpu.getAcceleration(&rawX, &rawY, &rawZ);
+        ImuSample sample, queued;
+        imu.latest(sample);
+        while (imu.pop(queued)) {}  // This task owns the ring; keep it from overflowing
         
-        sumX += rawX;
-        sumY += rawY;
+        sumX += sample.ax;
+        sumY += sample.ay;
 
         // Blinking Center Dot Animation
         if(i % 10 == 0) {
@@ -87,82 +361,247 @@ void taskGameEngine(void * parameter) {
             // Toggle center pixel
             bool on = (i / 10) % 2 == 0;
             canvas.drawPixel(MATRIX_WIDTH/2, MATRIX_HEIGHT/2, on ? 1 : 0);
+            displayPresentCanvas();
             xSemaphoreGive(dispMutex);
         }
         vTaskDelay(10); // 10ms delay * 100 samples = 1000ms total
     }
 
     // Calculate Average Offset
-    calibX = (float)sumX / SAMPLES;
-    calibY = (float)sumY / SAMPLES;
+    sensorFilter.setBias(SensorFilter::X, SensorFilter::biasFromSum(sumX, SAMPLES));
+    sensorFilter.setBias(SensorFilter::Y, SensorFilter::biasFromSum(sumY, SAMPLES));
+    calibration.save(sensorFilter.bias(SensorFilter::X), sensorFilter.bias(SensorFilter::Y),
+                     CalibrationStore::Source::Measured);
+    stillness.reset();
+    drift.anchor();
 
     // Clear Screen after calibration
     xSemaphoreTake(dispMutex, portMAX_DELAY);
     canvas.fillScreen(0);
+    canvasToPanelRows(presentedRows);
+    displayPresent(presentedRows);
     xSemaphoreGive(dispMutex);
-    // -------------------------------
+}
 
-    // 3. Instantiate Modes
-    allModes[0] = new ModeMarble();
-    allModes[1] = new ModeSparkle();
-    allModes[2] = new ModeFluid();
-    allModes[3] = new ModeHeart();
-    allModes[4] = new ModeLife();
-    allModes[5] = new ModePong();
-    allModes[6] = new ModeSnake();
-    allModes[7] = new ModeTetris();
-    allModes[8] = new ModeScroll();
-    allModes[9] = new ModeMatrix();
-    allModes[10] = new ModePomodoro();
-    allModes[11] = new BleCanvasMode();
+// A still, nearly flat, face-up window is evidence about the zero; the
+// tracker moves it a few LSB at a time, only after windows minutes apart
+// agree, and no further than CALIB_DRIFT_MAX_LSB from the last calibration.
+// Nudges are never written to NVS: a cold boot returns to the last calibration.
+static void checkCalibrationDrift() {
+    if (currentMode != nullptr && currentMode->measuresTilt()) return;
+    const int32_t one = 1 << SensorFilter::kStateBits;
+    const int32_t errX = stillness.mean(SensorFilter::X) - sensorFilter.bias(SensorFilter::X) / one;
+    const int32_t errY = stillness.mean(SensorFilter::Y) - sensorFilter.bias(SensorFilter::Y) / one;
+    const bool flat = abs(stillness.mean(SensorFilter::Z) - SensorFilter::kOneG) < CALIB_FLAT_Z_TOL
+                   && abs(errX) < CALIB_FLAT_LSB && abs(errY) < CALIB_FLAT_LSB;
+    if (!drift.addWindow(errX, errY, flat, millis())) return;
+
+    sensorFilter.setBias(SensorFilter::X, sensorFilter.bias(SensorFilter::X) + drift.nudge(0) * one);
+    sensorFilter.setBias(SensorFilter::Y, sensorFilter.bias(SensorFilter::Y) + drift.nudge(1) * one);
+    calibration.noteSource(CalibrationStore::Source::Drift);
+}
+
+// One IMU sample through fusion and gesture recognition. Replayed samples,
+// and live ones while recording, skip the calibration drift check: a trace
+// only stores the offsets it started with, so they must not move under it.
+static void processSample(const ImuSample& sample, bool live) {
+    if (!orientationSeeded) {
+        orientation.reset(sample.ax, sample.ay, sample.az);
+        orientationSeeded = true;
+    }
+    const uint32_t c0 = ESP.getCycleCount();
+    orientation.update(sample.ax, sample.ay, sample.az, sample.gx, sample.gy, sample.gz);
+    fusionCyclesX8 = fusionCyclesX8 - (fusionCyclesX8 >> 3) + (ESP.getCycleCount() - c0);
+
+    const int16_t accel[3] = { sample.ax, sample.ay, sample.az };
+    const int16_t gravity[3] = { orientation.gravity(0), orientation.gravity(1), orientation.gravity(2) };
+    gestures.update(sample.tUs,
+                    sensorFilter.corrected(SensorFilter::X, gravity[0]),
+                    sensorFilter.corrected(SensorFilter::Y, gravity[1]),
+                    accel, gravity);
+    const int16_t gyro[3] = { sample.gx, sample.gy, sample.gz };
+    classifier.addSample(accel, gravity, gyro);
+    if (live) {
+        recorder.recordSample(sample);
+        if (stillness.add(sample.ax, sample.ay, sample.az) && !recorder.recording()) checkCalibrationDrift();
+    }
+}
+
+// Replay: the trace stands in for the IMU and the button pin; live samples are dropped
+static void replayTrace(ImuSample& sample) {
+    while (imu.pop(sample)) {}
+    sensortrace::Record rec;
+    while (recorder.poll((uint32_t)esp_timer_get_time(), rec)) {
+        if (rec.type == sensortrace::Record::Type::Edge) {
+            btn.injectEdge(rec.pressed, rec.tUs);
+            continue;
+        }
+        sample.tUs = rec.tUs;
+        sample.ax = rec.imu[0]; sample.ay = rec.imu[1]; sample.az = rec.imu[2];
+        sample.gx = rec.imu[3]; sample.gy = rec.imu[4]; sample.gz = rec.imu[5];
+        processSample(sample, false);
+    }
+    if (recorder.finished()) {
+        Serial.println("[Trace] replay finished");
+        stopTrace();
+    }
+}
 
-    currentMode = allModes[0];
+// --- FAST LOGIC ENGINE ---
+void taskGameEngine(void * parameter) {
+    // 1. Hardware Init (the IMU task owns the bus and the sensor)
+    imu.waitReady();
+    
+    // --- 2. CALIBRATION SEQUENCE ---
+    // Only measured when nothing valid is stored; otherwise the first frame comes ~1 s sooner
+    int32_t biasX, biasY;
+    if (sleepManager.resumed()) {
+        // Picked up after deep sleep: reuse the offsets in RTC memory
+        sensorFilter.setBias(SensorFilter::X, sleepManager.resumeBiasX());
+        sensorFilter.setBias(SensorFilter::Y, sleepManager.resumeBiasY());
+        calibration.noteSource(CalibrationStore::Source::Rtc);
+    } else if (calibration.load(biasX, biasY)) {
+        sensorFilter.setBias(SensorFilter::X, biasX);
+        sensorFilter.setBias(SensorFilter::Y, biasY);
+    } else {
+        calibrateAccelerometer();
+    }
+
+    // Cold boot starts at mode 0; a motion wake resumes the hibernated mode
+    modeIndex = sleepManager.resumeModeIndex();
+    if (modeIndex < 0 || modeIndex >= MODE_COUNT) modeIndex = 0;
+    activeModeIndex = modeIndex;
+    currentMode = allModes[modeIndex];
+    power.apply(currentMode->powerClass());
     currentMode->setup();
+    sleepManager.restoreModeState(currentMode);
 
     TickType_t xLastWakeTime = xTaskGetTickCount();
+    ImuSample sample = {};
 
     while(true) {
-        // A. Read Sensors (Apply Calibration)
-        int16_t rawX, rawY, rawZ;
-        mpu.getAcceleration(&rawX, &rawY, &rawZ);
-        
-        // Subtract Calibration Data
-        float adjX = rawX - calibX;
-        float adjY = rawY - calibY;
-
-        // Simple Low Pass Filter
-        accX = (accX * 0.7) + (adjX * 0.3);
+        // A. Static frame: block until comms, a button edge or the idle tick.
+        // Keep polling while a gesture is open so click/long-press timeouts fire.
+        if (idleGate.idle() && commsMailbox.empty()) {
+            idleGate.wait(btn.busy() ? 1 : idleGate.tickTicks(currentMode->idlePolicy()));
+        }
+        idleGate.countWakeup();
+
+        // B. Read Sensors (Apply Calibration). The IMU task has already done the
+        // I2C work; fuse every sample queued since the last frame, at the sensor rate.
+        const int64_t imuStart = esp_timer_get_time();
+        if (recorder.replaying()) replayTrace(sample);
+        else while (imu.pop(sample)) processSample(sample, true);
+        imu.noteConsumerUs((uint32_t)(esp_timer_get_time() - imuStart));
+        imu.setBatch(idleGate.idle() ? IMU_IDLE_BATCH : IMU_BATCH);
         
-        // Note: Preserving your original negative sign for Y axis orientation
-        // If Y is inverted, we invert the *calibrated* value
-        accY = (accY * 0.7) + (-adjY * 0.3); 
+        // Bias removal + IIR low-pass in fixed point (Y flipped for the panel),
+        // on the fused gravity vector rather than the raw accelerometer
+        const int16_t raw[SensorFilter::kAxes] = {
+            orientation.gravity(SensorFilter::X),
+            orientation.gravity(SensorFilter::Y),
+            orientation.gravity(SensorFilter::Z)
+        };
+        sensorFilter.update(raw);
+        accX = sensorFilter.lsb(SensorFilter::X);
+        accY = sensorFilter.lsb(SensorFilter::Y);
+        idleGate.checkTilt(accX, accY);
+
+        // Face-down or unused for long enough: hibernate (does not return)
+        if (recorder.state() == SensorRecorder::State::Idle &&
+            sleepManager.shouldSleep(accX, accY, currentMode->holdsAwake(), commsHoldsAwake())) {
+            xSemaphoreTake(dispMutex, portMAX_DELAY);
+            imu.suspend();
+            const bool slept = sleepManager.hibernate(modeIndex, currentMode,
+                                                      sensorFilter.bias(SensorFilter::X),
+                                                      sensorFilter.bias(SensorFilter::Y));
+            if (!slept) imu.resume();
+            xSemaphoreGive(dispMutex);
+        }
 
-        // B. Instant Mode Switching
-        if (modeChangeRequest) {
+        // C. Input, then apply queued commands (mode switches, app data)
+        ButtonEvent buttonEvent;
+        while (btn.poll(buttonEvent)) {
+            dispatchButton(buttonEvent);
+        }
+        Gesture gesture;
+        while (gestures.poll(gesture)) {
+            dispatchGesture(gesture);
+        }
+        while (classifier.poll(gesture)) {
+            dispatchGesture(gesture);
+        }
+        drainMailbox(inputMailbox);
+        drainMailbox(commsMailbox);
+
+        // Explicit recalibration (button combo or protocol command): ~1 s, then
+        // restart the mode so it redraws over the calibration screen
+        if (recalibrateRequested) {
+            recalibrateRequested = false;
+            calibrateAccelerometer();
             xSemaphoreTake(dispMutex, portMAX_DELAY);
-            int normalized = requestedModeIndex % MODE_COUNT;
-            if (normalized < 0) normalized += MODE_COUNT;
-            modeIndex = normalized;
-            currentMode = allModes[modeIndex];
-            currentMode->setup();
-            activeModeIndex = modeIndex;
-            modeChangeRequest = false;
+            switchMode(modeIndex);
             xSemaphoreGive(dispMutex);
         }
 
-        btn.tick(); 
+#ifdef STACK_STRESS
+        // Walk every mode (app mode included) and report stack peaks each lap
+        static unsigned long lastStressSwitch = millis();
+        if (millis() - lastStressSwitch > STACK_STRESS_DWELL_MS) {
+            lastStressSwitch = millis();
+            postEngineCommand(inputMailbox, EngineCommandType::StepMode, 1);
+            if (modeIndex == MODE_COUNT - 1) printTaskStackReport();
+        }
+#endif
 
-        // C. Run Logic
-        if (xSemaphoreTake(dispMutex, 5) == pdTRUE) { 
+        // D. Run Logic (timed against the mode's frame budget)
+        if (idleGate.shouldRunFrame(currentMode->idlePolicy()) &&
+            frameBudget.shouldRun(modeIndex) && xSemaphoreTake(dispMutex, 5) == pdTRUE) { 
+            const int64_t frameStart = esp_timer_get_time();
             currentMode->loop();
+            const uint32_t frameUs = (uint32_t)(esp_timer_get_time() - frameStart);
+            presentFrame();
             xSemaphoreGive(dispMutex);
+            frameBudget.record(modeIndex, currentMode, frameUs);
+            sleepManager.framePresented();
+            idleGate.framePresented(presentedRows, MATRIX_WIDTH, currentMode->idlePolicy(), transition.active());
         }
 
-        // D. Non-blocking Delay
-        vTaskDelay(1); 
+        // E. Non-blocking Delay (idle iterations already blocked in A)
+        if (!idleGate.idle()) vTaskDelay(1); 
     }
 }
 
+// Built in setup(), before the tasks start, so the comms task can list
+// them (GET_MODES) and the stats sources can read them from the first push
+static void createModes() {
+    allModes[0] = new ModeMarble();
+    allModes[1] = new ModeSparkle();
+    allModes[2] = new ModeFluid();
+    allModes[3] = new ModeHeart();
+    allModes[4] = new ModeLife();
+    allModes[5] = new ModePong();
+    allModes[6] = new ModeSnake();
+    allModes[7] = new ModeTetris();
+    allModes[8] = new ModeScroll();
+    allModes[9] = new ModeMatrix();
+    allModes[10] = new ModePomodoro();
+    allModes[11] = new BleCanvasMode();
+    allModes[12] = new ModePlasma();
+    allModes[13] = new ModeLavaLamp();
+    allModes[14] = new ModeClouds();
+    allModes[15] = universeMode = new ModeLifeUniverse();
+    allModes[16] = new ModeWater();
+    allModes[17] = new ModeCube();
+    allModes[18] = new ModeStarfield();
+    allModes[19] = new ModeFireworks();
+    allModes[20] = new ModeRain();
+    allModes[21] = new ModeBreakout();
+    allModes[22] = new ModeMaze();
+    allModes[23] = new ModeLander();
+    allModes[24] = new ModeInvaders();
+}
+
 void taskCommsWorker(void * parameter) {
     setupComms();
     while(true) {
@@ -176,48 +615,116 @@ void nextMode() {
 
 
     int next = activeModeIndex + 1;
-    if (next > (VISIBLE_MODES-1)) {
+    if (next == APP_CONTROLLED_MODE_ID) next++;  // Only the app opens the canvas
+    if (next >= MODE_COUNT) {
         next = 0; // Wrap back to Marble
     }
 
-    requestedModeIndex = next;
-    modeChangeRequest = true;
+    postEngineCommand(inputMailbox, EngineCommandType::SetMode, next);
 }
 void resetMode() {
     if (isSpecialMode) return; // skip if in special mode
 
-    requestedModeIndex = 0;
-    modeChangeRequest = true;
+    postEngineCommand(inputMailbox, EngineCommandType::SetMode, 0);
 }
 
 void toggleSpecialMode() {
+    int target;
     if (!isSpecialMode) {
         savedModeIndex = modeIndex;       // 1. Remember current game
-        requestedModeIndex = SPECIAL_MODE_ID; // 2. Target the specific mode
+        target = SPECIAL_MODE_ID;         // 2. Target the specific mode
         isSpecialMode = true;             // 3. Set flag
     } else {
-        requestedModeIndex = savedModeIndex; // 1. Restore old game
+        target = savedModeIndex;          // 1. Restore old game
         isSpecialMode = false;            // 2. Clear flag
     }
-    modeChangeRequest = true; // Trigger the switch in the main loop
+    postEngineCommand(inputMailbox, EngineCommandType::SetMode, target); // Switch on the next frame
 }
 
 void setup() {
     Serial.begin(115200); 
     monitor.setPort(8080);
-    monitor.begin();
-
-
-    dispMutex = xSemaphoreCreateMutex();
-    btn.attachClick(nextMode);
-    btn.attachDoubleClick(resetMode);
-    btn.attachLongPressStart(toggleSpecialMode);
-
+    monitor.addStatsSource("frame", []() { return frameBudget.toJson(); });
+    monitor.addStatsSource("button", []() { return btn.toJson(); });
+    monitor.addStatsSource("imu", []() { return imu.toJson(); });
+    monitor.addStatsSource("idle", []() { return idleGate.toJson(); });
+    monitor.addStatsSource("power", []() { return power.toJson(); });
+    monitor.addStatsSource("calib", []() { return calibration.toJson(); });
+    monitor.addStatsSource("drift", []() {
+        String json = "{\"windows\":" + String(drift.windows());
+        json += ",\"nudges\":" + String(drift.nudges());
+        json += ",\"capped\":" + String(drift.capped());
+        json += ",\"total_lsb\":[" + String(drift.total(0)) + "," + String(drift.total(1)) + "]}";
+        return json;
+    });
+    monitor.addStatsSource("sleep", []() { return sleepManager.toJson(); });
+    monitor.addStatsSource("switch", []() {
+        return "{\"last_setup_us\":" + String(lastSwitchUs) + ",\"max_setup_us\":" + String(maxSwitchUs) + "}";
+    });
+    monitor.addStatsSource("gesture", []() {
+        String json = "{\"tilt\":" + String(gestures.count(GestureType::Tilt));
+        json += ",\"hold\":" + String(gestures.count(GestureType::TiltHold));
+        json += ",\"shake\":" + String(gestures.count(GestureType::Shake));
+        json += ",\"tap\":" + String(gestures.count(GestureType::Tap));
+        json += ",\"face_down\":" + String(gestures.count(GestureType::FaceDown));
+        json += ",\"dropped\":" + String(gestures.dropped()) + "}";
+        return json;
+    });
+    monitor.addStatsSource("mode", []() {
+        Mode* mode = currentMode;  // Modes are never freed; a stale pointer still reads fine
+        if (mode == nullptr) return String("{}");
+        const String extra = mode->statsJson();
+        return "{\"name\":\"" + String(mode->getName()) + "\"" + (extra.length() ? "," + extra : String()) + "}";
+    });
+    monitor.addStatsSource("trace", []() { return recorder.toJson(); });
+    ResourceMonitor::BlobEndpoint trace;
+    trace.read = [](const uint8_t*& data, size_t& length) { return recorder.readTrace(data, length); };
+    trace.release = []() { recorder.releaseTrace(); };
+    trace.begin = [](size_t total) { return recorder.beginUpload(total); };
+    trace.write = [](size_t index, const uint8_t* data, size_t length) { return recorder.writeUpload(index, data, length); };
+    trace.end = []() { return recorder.endUpload(); };
+    monitor.addBlobEndpoint("/trace", trace);
+    monitor.addStatsSource("net", []() { return classifier.toJson(); });
+    monitor.addStatsSource("life", []() { return universeMode != nullptr ? universeMode->universeJson() : String("{}"); });
+    monitor.addStatsSource("orient", []() {
+        String json = "{\"roll_cdeg\":" + String(OrientationFilter::toCentiDegrees(orientation.roll()));
+        json += ",\"pitch_cdeg\":" + String(OrientationFilter::toCentiDegrees(orientation.pitch()));
+        json += ",\"accel_trusted\":" + String(orientation.accelTrusted() ? 1 : 0);
+        json += ",\"gyro_bias\":[" + String(orientation.gyroBias(0)) + "," + String(orientation.gyroBias(1))
+              + "," + String(orientation.gyroBias(2)) + "]";
+        json += ",\"cycles\":" + String(fusionCyclesX8 / 8.0f, 1) + "}";
+        return json;
+    });
+
+    power.begin();
+    sleepManager.begin();
+    sensorFilter.setSign(SensorFilter::Y, -1);  // Board Y runs opposite to panel Y
+    dispMutex = xSemaphoreCreateMutexStatic(&dispMutexBuffer);
+    registerStaticBuffer("Comms mailbox", sizeof(commsMailbox),
+                         []() { return (uint32_t)(commsMailbox.peak() * sizeof(EngineCommand)); });
+    registerStaticBuffer("Input mailbox", sizeof(inputMailbox),
+                         []() { return (uint32_t)(inputMailbox.peak() * sizeof(EngineCommand)); });
+    engineEvents = idleGate.begin();
+    btn.begin(btn_pin, true);
+    btn.setWakeEvent(engineEvents, ENGINE_WAKE_BUTTON);
+    btn.setEdgeObserver([](bool pressed, uint32_t tUs) { recorder.recordEdge(pressed, tUs); });
+    setCommsActivityObserver([]() { sleepManager.noteActivity(); });
+    createModes();
+    setCommsModeNames([](int index) { return allModes[index]->getName(); }, MODE_COUNT);
+
+    // IMU above comms on core 0: short bursts, must not miss the FIFO window
+    imu.begin(3, 0);
+    // Learned-gesture inference between the two on core 0 (short, bursty)
+    classifier.begin(2, 0);
     // Priority 2 for Game Engine
-    xTaskCreatePinnedToCore(taskGameEngine, "Game", 8192, NULL, 2, NULL, 1);
-    xTaskCreatePinnedToCore(taskCommsWorker, "Comms", 6144, NULL, 1, NULL, 0);
+    createStaticTask(taskGameEngine, "Game", gameTaskStack, GAME_TASK_STACK, &gameTaskTcb, NULL, 2, 1);
+    createStaticTask(taskCommsWorker, "Comms", commsTaskStack, COMMS_TASK_STACK, &commsTaskTcb, NULL, 1, 0);
 
     setupDisplayDriver();
+
+    // WiFi AP bring-up is slow; start it after the game task so a motion wake
+    // reaches its first frame without waiting for the network
+    monitor.begin();
 }
 
 void loop() { vTaskDelete(NULL); }
\ No newline at end of file
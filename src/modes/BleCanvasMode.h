@@ -15,5 +15,8 @@ public:
     void loop() override {
         // Do nothing, just display whatever the BLE puts in the buffer
     }
+    // Only comms writes change the frame, so the engine can sleep until one arrives
+    IdlePolicy idlePolicy() override { return IdlePolicy::UntilEvent; }
     const char* getName() override { return "App Controlled"; }
+    PowerClass powerClass() override { return PowerClass::Low; }
 };
\ No newline at end of file
@@ -1,11 +1,87 @@
 // src/modes/Mode.h
 #pragma once
 #include <Adafruit_GFX.h>
+#include "engine/GestureRecognizer.h"
+
+// What the engine does when a mode's loop() blows its frame budget
+enum class OverloadPolicy : uint8_t {
+    Warn,        // Only count the overrun
+    SkipRender,  // Skip the next loop() call so input/sensors catch up
+    HalveRate,   // Run loop() every other frame until the mode settles
+};
+
+// Classified button gestures, dispatched to the active mode first
+enum class ButtonEvent : uint8_t {
+    Press,        // Debounced down edge (mode-only, no global action)
+    Click,
+    DoubleClick,
+    LongPress,
+    DoubleLongPress,  // Click, then press and hold (the recalibrate combo)
+};
+
+// When the game task may stop running the mode and block until something happens
+enum class IdlePolicy : uint8_t {
+    Never,       // Always run at full rate
+    WhenStatic,  // Idle once the presented frame stops changing; loop() still ticks at IDLE_TICK_MS
+    UntilEvent,  // Frame only changes on input/comms; loop() is not called while idle
+};
+
+// CPU clock / sleep profile the engine applies while the mode is active
+enum class PowerClass : uint8_t {
+    Performance,  // Max CPU clock, no automatic light sleep
+    Low,          // 80 MHz, automatic light sleep between frames where available
+};
+
+// Largest blob a mode may keep in RTC memory across deep sleep
+static constexpr size_t kModeStateBytes = 48;
 
 class Mode {
 public:
     virtual void setup() = 0;
     virtual void loop() = 0; // Returns true if it wants to stay active
     virtual const char* getName() = 0;
+
+    // Called when the engine switches away (or restarts the mode, before
+    // setup() runs again): hand back heap that setup() took
+    virtual void teardown() {}
+
+    // Per-frame cost budget in microseconds (0 = FRAME_BUDGET_US)
+    virtual uint32_t frameBudgetUs() { return 0; }
+    virtual OverloadPolicy overloadPolicy() { return OverloadPolicy::SkipRender; }
+
+    // Idling is opt-in: only modes whose frame changes on events or a slow clock should idle
+    virtual IdlePolicy idlePolicy() { return IdlePolicy::Never; }
+    virtual PowerClass powerClass() { return PowerClass::Performance; }
+
+    // While true, the inactivity timeout never puts the device to sleep (face-down still does)
+    virtual bool holdsAwake() { return false; }
+
+    // True for modes that exist to show tilt (spirit level, marble): the
+    // engine then never moves the calibrated zero on its own while they run
+    virtual bool measuresTilt() { return false; }
+
+    // Compact state kept in RTC memory across deep sleep; return bytes written (<= capacity)
+    virtual size_t saveState(uint8_t* out, size_t capacity) { return 0; }
+    // Called right after setup() when the mode is resumed from deep sleep
+    virtual void restoreState(const uint8_t* data, size_t length) {}
+
+    // Return true to consume the click (suppresses the global next-mode action)
+    virtual bool handleButton() { return false; }
+
+    // Return true to consume the event; unconsumed events fall through to global actions
+    virtual bool onButton(ButtonEvent event) {
+        return event == ButtonEvent::Click ? handleButton() : false;
+    }
+
+    // Tilt / shake / tap events from the engine's recognizer, delivered between
+    // frames (update state here, draw in loop()). Return true if it changed
+    // the picture, so an idle engine wakes to render it.
+    virtual bool onGesture(const Gesture& gesture) { return false; }
+
+    // Extra fields for the web monitor's "mode" stats source, as JSON members
+    // without braces ("\"frame_us\":41.2,..."), or empty. Called from the
+    // monitor's task: racy reads of counters are fine, nothing may change.
+    virtual String statsJson() { return String(); }
+
     virtual ~Mode() {} // Virtual destructor
 };
\ No newline at end of file
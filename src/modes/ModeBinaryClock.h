@@ -16,6 +16,9 @@ class ModeBinaryClock : public Mode {
 
 public:
     const char* getName() override { return "Binary Clock"; }
+    PowerClass powerClass() override { return PowerClass::Low; }
+    // Changes once a second
+    IdlePolicy idlePolicy() override { return IdlePolicy::WhenStatic; }
 
     void setup() override {
         // configTime(0, 0, "pool.ntp.org", "time.nist.gov");
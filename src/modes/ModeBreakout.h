@@ -1,117 +1,98 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/Physics2D.h"
+#include "engine/CollisionLayers.h"
 
 // Breakout Constants
 #define PADDLE_W 3
 #define BRICKS_ROWS 3
 
+// Breakout: tilt steers the paddle on the bottom row, the button launches
+// the ball. Bricks are the physics wall layer (rows[y] bit x), so the
+// ball bounces off exactly the brick it reaches, and it can't slip
+// between bricks or through the paddle however fast it goes.
 class ModeBreakout : public Mode {
-    float ballX, ballY;
-    float velX, velY;
-    float paddleX;
-    bool bricks[BRICKS_ROWS][MATRIX_WIDTH];
+    PhysicsWorld world{ MATRIX_WIDTH, MATRIX_HEIGHT };
+    PhysicsBody ball;
+    PhysicsBox paddle;
+    enum Layer { Bricks, kLayerCount };
+    CollisionLayers<kLayerCount> layers{ MATRIX_WIDTH, MATRIX_HEIGHT };  // Only the top BRICKS_ROWS rows are ever set
+    FixedStep clock{ PHYSICS_STEP_US, PHYSICS_MAX_CATCH_UP };
     bool gameRunning = false;
     int score = 0;
 
 public:
+    static constexpr int32_t kMaxSpeed = 128;  // 0.5 px per step (Q8)
+
     const char* getName() override { return "Breakout"; }
 
     void setup() override {
-        gameRunning = false;
+        world.setWalls(layers.rows(Bricks));
+        world.setOpenEdges(PhysicsWorld::Bottom);
+        world.setBoxes(&paddle, 1);
         resetGame();
+        clock.reset((uint32_t)esp_timer_get_time());
     }
 
     bool handleButton() override {
         if (!gameRunning) {
-            gameRunning = true; // Launch ball
-            velY = -0.3; // Launch upwards
-            velX = (random(0, 20) - 10) / 20.0;
+            gameRunning = true;  // Launch upwards at 0.25 px per step, a little to either side
+            ball.vy = -64;
+            ball.vx = random(-32, 33);
             return true;
         }
-        return false; // If running, button does nothing (let mode switch happen? Or pause?)
-        // Actually, let's keep it simple: button launches. If running, button switches mode.
+        return false;  // Running: the click switches mode as usual
     }
 
+    int bricksLeft() const { return layers.count(Bricks); }
+
     void resetGame() {
-        // Reset Ball
-        ballX = MATRIX_WIDTH / 2.0;
-        ballY = MATRIX_HEIGHT - 2;
-        velX = 0;
-        velY = 0;
+        ball = PhysicsBody();
+        ball.x = (MATRIX_WIDTH / 2) * 256;
+        ball.y = (MATRIX_HEIGHT - 2) * 256;
+        ball.w = ball.h = 256;
+        ball.maxSpeed = kMaxSpeed;
         gameRunning = false;
-        paddleX = (MATRIX_WIDTH - PADDLE_W) / 2.0;
+        paddle = { (MATRIX_WIDTH - PADDLE_W) * 128, (MATRIX_HEIGHT - 1) * 256, PADDLE_W * 256, 256 };
 
-        // Reset Bricks
-        for (int r = 0; r < BRICKS_ROWS; r++) {
-            for (int c = 0; c < MATRIX_WIDTH; c++) {
-                bricks[r][c] = true;
-            }
-        }
+        layers.clear(Bricks);
+        for (int r = 0; r < BRICKS_ROWS; r++) layers.rows(Bricks)[r] = layers.fullRow();
     }
 
     void loop() override {
-        clearDisplay();
-
-        // 1. Paddle Movement (MPU)
-        // MPU Tilt: accX controls paddle
-        float tilt = accX / 5000.0; // Adjust sensitivity
-        paddleX += tilt;
-        
-        // Clamp Paddle
-        if (paddleX < 0) paddleX = 0;
-        if (paddleX > MATRIX_WIDTH - PADDLE_W) paddleX = MATRIX_WIDTH - PADDLE_W;
-
-        // 2. Ball Physics
-        if (gameRunning) {
-            ballX += velX;
-            ballY += velY;
-
-            // Wall Collisions
-            if (ballX <= 0 || ballX >= MATRIX_WIDTH - 1) velX *= -1;
-            if (ballY <= 0) velY *= -1; // Top wall bounce
-
-            // Paddle Collision
-            if (ballY >= MATRIX_HEIGHT - 2 &&
-                ballX >= paddleX && ballX <= paddleX + PADDLE_W) {
-                velY *= -1;
-                // Add some English based on where it hit the paddle
-                velX += (ballX - (paddleX + PADDLE_W/2.0)) * 0.1;
+        const int steps = clock.advance((uint32_t)esp_timer_get_time());
+        if (steps == 0) return;
+
+        for (int i = 0; i < steps; i++) {
+            // Paddle: 0.5 px per step at 1 g of lean
+            paddle.x = constrain(paddle.x + tiltX(128), 0, (MATRIX_WIDTH - PADDLE_W) * 256);
+
+            if (!gameRunning) continue;
+
+            PhysicsHit hits[4];
+            const int n = world.step(ball, 0, 0, hits, 4);
+            for (int h = 0; h < n && h < 4; h++) {
+                if (hits[h].box == 0 && hits[h].axis == 1) {
+                    // English: 0.1 px per step for each pixel off the paddle's centre
+                    ball.vx += ((ball.x + 128 - (paddle.x + PADDLE_W * 128)) * 26) >> 8;
+                } else if (hits[h].box < 0 && hits[h].cellY >= 0 && hits[h].cellY < BRICKS_ROWS &&
+                           hits[h].cellX >= 0 && hits[h].cellX < MATRIX_WIDTH) {
+                    layers.set(Bricks, hits[h].cellX, hits[h].cellY, false);
+                    score++;
+                }
             }
 
-            // Bottom Boundary (Game Over)
-            if (ballY >= MATRIX_HEIGHT) {
-                gameRunning = false;
-                // Maybe flash screen?
-                resetGame();
-            }
-
-            // Brick Collision
-            int checkX = (int)ballX;
-            int checkY = (int)ballY;
-            if (checkY < BRICKS_ROWS && checkY >= 0) {
-               if (bricks[checkY][checkX]) {
-                   bricks[checkY][checkX] = false;
-                   velY *= -1;
-                   score++;
-               }
-            }
-        }
-
-        // 3. Draw
-        // Bricks
-        for (int r = 0; r < BRICKS_ROWS; r++) {
-            for (int c = 0; c < MATRIX_WIDTH; c++) {
-                if (bricks[r][c]) canvas.drawPixel(c, r, 1);
-            }
-        }
-
-        // Paddle
-        for (int i = 0; i < PADDLE_W; i++) {
-            canvas.drawPixel((int)paddleX + i, MATRIX_HEIGHT - 1, 1);
+            // Out of the bottom: game over; wall cleared: a new one
+            if (ball.y >= MATRIX_HEIGHT * 256 || bricksLeft() == 0) resetGame();
         }
 
-        // Ball
-        canvas.drawPixel((int)ballX, (int)ballY, 1);
+        uint16_t rows[MATRIX_HEIGHT] = {};
+        layers.draw(Bricks, rows);
+        rows[MATRIX_HEIGHT - 1] |= (uint16_t)(((0xFFFFu << (16 - PADDLE_W)) & 0xFFFFu) >> (paddle.x >> 8));
+        if (ball.y >= 0 && ball.y < MATRIX_HEIGHT * 256) rows[ball.y >> 8] |= (uint16_t)(0x8000u >> ((ball.x >> 8) & 15));
+        rowsToCanvas(rows);
     }
 };
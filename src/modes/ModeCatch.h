@@ -6,7 +6,7 @@
 // Gets faster over time.
 
 class ModeCatch : public Mode {
-    float cursorX, cursorY;
+    int32_t cursorX, cursorY;  // Q8 pixels
     int targetX, targetY;
     int score = 0;
     unsigned long startTime;
@@ -16,8 +16,8 @@ public:
     const char* getName() override { return "Catch The Dot"; }
 
     void setup() override {
-        cursorX = MATRIX_WIDTH / 2.0;
-        cursorY = MATRIX_HEIGHT / 2.0;
+        cursorX = MATRIX_WIDTH * 128;
+        cursorY = MATRIX_HEIGHT * 128;
         score = 0;
         spawnTarget();
         startTime = millis();
@@ -46,25 +46,13 @@ public:
             return;
         }
 
-        // 1. Move Cursor
-        // Add sensitivity
-        // Assuming accX is +/- 16000 or similar
-        float dx = (accX / 2000.0);
-        float dy = -(accY / 2000.0); // Inver Y usually
-        
-        cursorX += dx;
-        cursorY += dy;
-
-        // Clamp
-        if (cursorX < 0) cursorX = 0;
-        if (cursorX >= MATRIX_WIDTH) cursorX = MATRIX_WIDTH - 0.1;
-        if (cursorY < 0) cursorY = 0;
-        if (cursorY >= MATRIX_HEIGHT) cursorY = MATRIX_HEIGHT - 0.1;
+        // 1. Move Cursor: 8.2 px per frame at 1 g of lean (Q8), Y inverted
+        cursorX = constrain(cursorX + tiltX(2097), 0, MATRIX_WIDTH * 256 - 1);
+        cursorY = constrain(cursorY - tiltY(2097), 0, MATRIX_HEIGHT * 256 - 1);
 
-        // 2. Check Capture (Distance < 1.0)
-        // Simple distance check
-        float dist = sqrt(pow(cursorX - targetX, 2) + pow(cursorY - targetY, 2));
-        if (dist < 1.5) {
+        // 2. Check Capture (distance < 1.5 px, compared squared in Q16)
+        const int32_t dx = cursorX - targetX * 256, dy = cursorY - targetY * 256;
+        if (dx * dx + dy * dy < 384 * 384) {
             score++;
             // New Target
             targetX = random(1, MATRIX_WIDTH-1);
@@ -76,8 +64,8 @@ public:
         canvas.drawPixel(targetX, targetY, 1);
         
         // 4. Draw Cursor (Cross)
-        int cx = (int)cursorX;
-        int cy = (int)cursorY;
+        int cx = cursorX >> 8;
+        int cy = cursorY >> 8;
         canvas.drawPixel(cx, cy, 1);
         if(cx > 0) canvas.drawPixel(cx-1, cy, 1);
         if(cx < MATRIX_WIDTH-1) canvas.drawPixel(cx+1, cy, 1);
@@ -0,0 +1,26 @@
+#pragma once
+#include "NoiseMode.h"
+
+// Clouds: three octaves of simplex noise drifting sideways, temporally
+// dithered by default so the thin edges shimmer rather than speckle
+class ModeClouds : public NoiseMode {
+    static constexpr int32_t kPixel = 56;  // Noise units (Q8 cells) per pixel for the widest octave
+    static constexpr int32_t kDrift = 3;   // Per frame
+
+protected:
+    void render() override {
+        const int32_t drift = (int32_t)frame * kDrift;
+        for (int y = 0; y < MATRIX_HEIGHT; y++) {
+            for (int x = 0; x < MATRIX_WIDTH; x++) {
+                // Thin the cover out a little (the bias) and firm up the edges
+                const int32_t v = noise::fbm(x * kPixel + drift, y * kPixel + drift / 4, 3);
+                levels[y * MATRIX_WIDTH + x] = noise::toLevel(v * 2 - 48);
+            }
+        }
+    }
+
+public:
+    ModeClouds() : NoiseMode(noise::Dither::Temporal) {}
+
+    const char* getName() override { return "Clouds"; }
+};
@@ -1,106 +1,110 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
-#include <math.h>
-
-// 3D Wireframe Cube
+#include "Config.h"
+#include "engine/FixedMath.h"
+#include "engine/Meshes.h"
+#include "engine/Wireframe.h"
+
+// 3D wireframe solids (engine/Wireframe.h): one fixed-point rotation
+// matrix per frame, perspective projection, clipped lines written straight
+// into the canvas buffer. Tap cycles cube, octahedron, tetrahedron and
+// icosahedron; double tap hands the rotation to the board's roll and pitch
+// (with a slow spin about the view axis) and back to the tumble.
 class ModeCube : public Mode {
-    float angleX = 0;
-    float angleY = 0;
-    float angleZ = 0;
-
-    struct Point3D { float x, y, z; };
-    
-    // Cube Vertices (Center at 0,0,0)
-    Point3D vertices[8] = {
-        {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
-        {-1, -1, 1},  {1, -1, 1},  {1, 1, 1},  {-1, 1, 1}
-    };
+    uint16_t angleX = 0;  // Binary angles
+    uint16_t angleY = 0;
+    uint16_t angleZ = 0;
+    unsigned long lastFrame = 0;
+    int meshIndex = 0;
+    bool imuView = false;
+
+    Wireframe wireframe;
+    uint32_t frameUsX8 = 0;  // EWMA of one frame, scaled by 8
+    uint32_t frames = 0;     // Since the wireframe stats were reset
+    uint32_t drawUs = 0;     // Draw time over those frames
+
+    static constexpr int32_t kStepX = fixmath::angleFromRadians(0.04);  // Per frame
+    static constexpr int32_t kStepY = fixmath::angleFromRadians(0.06);
+    static constexpr int32_t kStepZ = fixmath::angleFromRadians(0.02);
+
+    void logFrame(uint32_t us) {
+        frameUsX8 = frameUsX8 - (frameUsX8 >> 3) + us;
+        drawUs += us;
+        if (++frames >= 1024) resetStats();  // Keep the averages recent
+    }
 
-    // Edges connecting vertices
-    int edges[12][2] = {
-        {0,1}, {1,2}, {2,3}, {3,0}, // Back Face
-        {4,5}, {5,6}, {6,7}, {7,4}, // Front Face
-        {0,4}, {1,5}, {2,6}, {3,7}  // Connecting Lines
-    };
+    void resetStats() {
+        wireframe.resetStats();
+        frames = 0;
+        drawUs = 0;
+    }
 
 public:
     const char* getName() override { return "3D Cube"; }
 
+    // Mesh, frame time, per-frame vertex / edge counts, and throughput:
+    // vertices transformed and edges drawn per millisecond of draw time
+    String statsJson() override {
+        const Wireframe::Stats stats = wireframe.stats();
+        const uint32_t n = frames ? frames : 1;
+        const uint32_t us = drawUs ? drawUs : 1;
+        String json = "\"mesh\":\"" + String(kMeshes[meshIndex].name) + "\"";
+        json += ",\"frame_us\":" + String(frameUsX8 / 8.0f, 1);
+        json += ",\"vertices\":" + String(stats.vertices / n);
+        json += ",\"edges\":" + String(stats.edges / n);
+        json += ",\"culled\":" + String(stats.culled / n);
+        json += ",\"vertices_per_ms\":" + String((uint32_t)((uint64_t)stats.vertices * 1000 / us));
+        json += ",\"edges_per_ms\":" + String((uint32_t)((uint64_t)stats.edges * 1000 / us));
+        return json;
+    }
+
     void setup() override {
         angleX = 0;
         angleY = 0;
         angleZ = 0;
+        wireframe.setViewport(MATRIX_WIDTH, MATRIX_HEIGHT);
+        wireframe.setCamera(WIRE_DISTANCE_Q8, WIRE_FOCAL);
+        resetStats();
+        lastFrame = millis();
     }
 
-    void loop() override {
-        clearDisplay();
-        
-        // Auto rotate
-        angleX += 0.04;
-        angleY += 0.06;
-        angleZ += 0.02;
-
-        float scale;
-        // Pulse size slightly
-        scale = 3.5 + sin(millis()/1000.0) * 0.5;
-
-        Point3D projected[8]; 
-        
-        // Precompute sin/cos for speed if needed, but float is fast enough on ESP32
-        float cX = cos(angleX); float sX = sin(angleX);
-        float cY = cos(angleY); float sY = sin(angleY);
-        float cZ = cos(angleZ); float sZ = sin(angleZ);
-
-        for (int i = 0; i < 8; i++) {
-            Point3D v = vertices[i];
-
-            // 1. Rotate X
-            float y1 = v.y * cX - v.z * sX;
-            float z1 = v.y * sX + v.z * cX;
-            v.y = y1; v.z = z1;
-
-            // 2. Rotate Y
-            float x2 = v.x * cY + v.z * sY;
-            float z2 = -v.x * sY + v.z * cY;
-            v.x = x2; v.z = z2;
-
-            // 3. Rotate Z
-            float x3 = v.x * cZ - v.y * sZ;
-            float y3 = v.x * sZ + v.y * cZ;
-            v.x = x3; v.y = y3;
-
-            // 4. Project (Orthographic)
-            projected[i].x = v.x;
-            projected[i].y = v.y;
+    bool onGesture(const Gesture& gesture) override {
+        switch (gesture.type) {
+            case GestureType::Tap:
+                meshIndex = (meshIndex + 1) % kMeshCount;
+                resetStats();
+                return false;
+            case GestureType::DoubleTap:
+                imuView = !imuView;
+                return false;
+            default:
+                return false;
         }
+    }
 
-        // 5. Draw Edges
-        int centerX = MATRIX_WIDTH / 2;
-        int centerY = MATRIX_HEIGHT / 2;
+    void loop() override {
+        if (millis() - lastFrame < 30) return;
+        lastFrame = millis();
+
+        angleZ += kStepZ;
+        if (imuView) {
+            // Lean the solid with the board: roll turns it about y, pitch about x
+            angleX = (uint16_t)tiltPitch();
+            angleY = (uint16_t)-tiltRoll();
+        } else {
+            angleX += kStepX;
+            angleY += kStepY;
+        }
 
-        for (int i = 0; i < 12; i++) {
-            // Edges connect vertices by index
-            // e.g. edge 0 connects vertex 0 and 1...
-            // Wait, my edge defs use indices into vertices array. That's fine.
-            int idx1 = -1, idx2 = -1;
-            
-            // Re-define edges properly just in case
-            // Back face: 0-1, 1-2, 2-3, 3-0
-            if(i<4) { idx1=i; idx2=(i+1)%4; }
-            // Front face: 4-5, 5-6, 6-7, 7-4
-            else if(i<8) { idx1=4+(i-4); idx2=4+((i-4)+1)%4; }
-            // Connecting: 0-4, 1-5, 2-6, 3-7
-            else { idx1=i-8; idx2=i-4; }
-            
-            int x1 = (int)(projected[idx1].x * scale) + centerX;
-            int y1 = (int)(projected[idx1].y * scale) + centerY;
-            int x2 = (int)(projected[idx2].x * scale) + centerX;
-            int y2 = (int)(projected[idx2].y * scale) + centerY;
+        // Pulse size slightly: 1.0 +- 1/8, one radian per second
+        const uint16_t pulse = (uint16_t)(((uint64_t)millis() * fixmath::angleFromRadians(1.0)) / 1000);
+        const int32_t scale = fixmath::kOne8 + (fixmath::sin8(pulse) >> 3);
 
-            canvas.drawLine(x1, y1, x2, y2, 1);
-        }
-        
-        delay(30);
+        const int64_t t0 = esp_timer_get_time();
+        clearDisplay();
+        wireframe.draw(kMeshes[meshIndex], Wireframe::rotation(angleX, angleY, angleZ), scale, canvas.getBuffer());
+        logFrame((uint32_t)(esp_timer_get_time() - t0));
     }
 };
@@ -10,6 +10,7 @@ class ModeDice : public Mode {
     int roll = 1;
     unsigned long shakingStart = 0;
     unsigned long resultTime = 0;
+    bool shaking = false;
 
 public:
     const char* getName() override { return "Dice"; }
@@ -17,26 +18,38 @@ public:
     void setup() override {
         state = 0;
         roll = 1;
+        shaking = false;
+    }
+
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type == GestureType::Shake) {
+            shaking = true;
+            if (state == 0) {
+                state = 1;
+                shakingStart = millis();
+                return true;
+            }
+        } else if (gesture.type == GestureType::ShakeEnd) {
+            shaking = false;
+        } else if (gesture.type == GestureType::DoubleTap && state == 0) {
+            // Double tap rolls without shaking
+            state = 1;
+            shakingStart = millis();
+            return true;
+        }
+        return false;
     }
 
     void loop() override {
-        // Detect Shake
-        float totalAcc = abs(accX) + abs(accY); // Simple magnitude
-        
         if (state == 0) {
             // Waiting
             canvas.setTextSize(1);
             canvas.setCursor(0, 4);
             if ((millis()/500)%2) canvas.print("SHAKE");
-            
-            if (totalAcc > 4000) {
-                state = 1;
-                shakingStart = millis();
-            }
         } 
         else if (state == 1) {
             // Rolling
-            if (millis() - shakingStart > 1500 && totalAcc < 1000) {
+            if (millis() - shakingStart > 1500 && !shaking) {
                 // Done shaking
                 state = 2;
                 resultTime = millis();
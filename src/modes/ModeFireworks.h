@@ -1,101 +1,59 @@
 #pragma once
-#include "Mode.h"
-#include "Globals.h"
-
-struct Firework {
-    float x, y;
-    float vx, vy;
-    bool exploded;
-    int life;
-};
-
-#define MAX_PARTICLES 40
-
-class ModeFireworks : public Mode {
-    Firework particles[MAX_PARTICLES];
-
-public:
-    const char* getName() override { return "Fireworks"; }
-
-    void setup() override {
-        for (int i = 0; i < MAX_PARTICLES; i++) particles[i].life = 0;
+#include "ParticleMode.h"
+#include "engine/FixedMath.h"
+
+// Fireworks: rockets climb under light gravity and burst at their apex (or
+// a random height) into 8-14 sparks that fall and fade
+class ModeFireworks : public ParticleMode {
+    ParticleSystem<4> rockets;
+    ParticleSystem<48> sparks;
+    ParticleSystem<48>::Emitter burst;
+
+    void explode(int rocket) {
+        burst.x = rockets.x(rocket);
+        burst.y = rockets.y(rocket);
+        rockets.kill(rocket);
+        sparks.burst(burst, random(8, 15));
     }
 
-    void loop() override {
-        clearDisplay();
+protected:
+    void reset() override {
+        rockets.clear();
+        sparks.clear();
+        rockets.setGravity(0, fixmath::constant8(0.1));
+        rockets.setBounds(MATRIX_WIDTH, MATRIX_HEIGHT, 2);
+        sparks.setGravity(0, fixmath::constant8(0.2));
+        sparks.setBounds(MATRIX_WIDTH, MATRIX_HEIGHT, 4);  // Sparks thrown off the top may fall back
+        sparks.seed((uint32_t)random(1, 0x7FFFFFFF));
+
+        // Any direction at 0.5-1.5 px per frame, 10-25 frames of life
+        burst.angleRange = 65535;
+        burst.speedMin = fixmath::constant8(0.5);
+        burst.speedMax = fixmath::constant8(1.5);
+        burst.lifeMin = 10;
+        burst.lifeMax = 25;
+    }
 
-        // 1. Create new firework occasionally
+    int frame(uint16_t rows[MATRIX_HEIGHT]) override {
+        // Launch a rocket now and then
         if (random(0, 30) == 0) {
-            // Find slot for rocket
-            for (int i = 0; i < MAX_PARTICLES; i++) {
-                if (particles[i].life <= 0) {
-                    particles[i].x = random(2, MATRIX_WIDTH - 2);
-                    particles[i].y = MATRIX_HEIGHT - 1;
-                    particles[i].vy = -random(30, 45) / 10.0; // Shoot up
-                    particles[i].vx = random(-10, 10) / 20.0;
-                    particles[i].exploded = false;
-                    particles[i].life = 50; // Use life for tracking rocket phase
-                    break;
-                }
-            }
+            rockets.spawn(random(2, MATRIX_WIDTH - 2) * fixmath::kOne8, (MATRIX_HEIGHT - 1) * fixmath::kOne8,
+                          random(-10, 10) * fixmath::kOne8 / 20, -random(30, 45) * fixmath::kOne8 / 10);
         }
 
-        // 2. Physics
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (particles[i].life > 0) {
-                // Rocket Phase
-                if (!particles[i].exploded) {
-                    particles[i].x += particles[i].vx;
-                    particles[i].y += particles[i].vy;
-                    particles[i].vy += 0.1; // Gravity (slower for rocket)
+        int updated = rockets.step() + sparks.step();
 
-                    // Apex reached? Explode
-                    if (particles[i].vy >= 0 || particles[i].y < random(2, 6)) {
-                        explode(i);
-                    }
-                } 
-                // Particle Phase
-                else {
-                    particles[i].x += particles[i].vx;
-                    particles[i].y += particles[i].vy;
-                    particles[i].vy += 0.2; // Gravity
-                    particles[i].life--;
-                }
-
-                // Draw
-                int px = (int)particles[i].x;
-                int py = (int)particles[i].y;
-                if (px >= 0 && px < MATRIX_WIDTH && py >= 0 && py < MATRIX_HEIGHT) {
-                    canvas.drawPixel(px, py, 1);
-                }
-            }
+        // Apex reached (or high enough)? Explode
+        for (int k = rockets.count() - 1; k >= 0; k--) {
+            const int i = rockets.slot(k);
+            if (rockets.vy(i) >= 0 || rockets.y(i) < random(2, 6) * fixmath::kOne8) explode(i);
         }
-        
-        delay(30);
-    }
-
-    void explode(int parentIndex) {
-        float x = particles[parentIndex].x;
-        float y = particles[parentIndex].y;
-
-        // Kill parent
-        particles[parentIndex].life = 0;
 
-        // Spawn children
-        int count = random(8, 15);
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (count <= 0) break;
-            if (particles[i].life <= 0) {
-                particles[i].x = x;
-                particles[i].y = y;
-                float angle = random(0, 360) * PI / 180.0;
-                float speed = random(5, 15) / 10.0;
-                particles[i].vx = cos(angle) * speed;
-                particles[i].vy = sin(angle) * speed;
-                particles[i].exploded = true; // Is a particle
-                particles[i].life = random(10, 25);
-                count--;
-            }
-        }
+        rockets.raster(rows, MATRIX_WIDTH, MATRIX_HEIGHT);
+        sparks.raster(rows, MATRIX_WIDTH, MATRIX_HEIGHT);
+        return updated;
     }
+
+public:
+    const char* getName() override { return "Fireworks"; }
 };
@@ -1,102 +1,114 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/SandGrid.h"
+#include "engine/FixedMath.h"
 
+// Sand that falls wherever the board is tipped. Grid rows are panel rows
+// (x), cells along a row are panel y, so the panel is 10 row words and a
+// step is a few dozen mask operations. Gravity follows the lean in any
+// direction, not just the four edges; below SAND_DEADZONE_LSB of lean the
+// pile stays put. Shake scatters the grains again. Water is its own mode
+// (ModeWater.h).
 class ModeFluid : public Mode {
-    unsigned long lastUpdate = 0;
-public:
-    const char* getName() override { return "360 Sand"; }
-    
-    void setup() override { 
-        clearDisplay(); 
-        lastUpdate = millis();
-        // Seed some sand
-        for(int i=0; i<30; i++) setPixel(random(10), random(16), 1);
+    SandGrid sand{ MATRIX_HEIGHT, MATRIX_WIDTH };
+    unsigned long lastStep = 0;
+    uint32_t stepUsX8 = 0;  // EWMA of one step, scaled by 8
+
+    void scatter() {
+        sand.clear();
+        sand.seed((uint32_t)random(1, 0x7FFFFFFF));
+        for (int placed = 0; placed < SAND_GRAINS;) {
+            const int x = random(MATRIX_HEIGHT), y = random(MATRIX_WIDTH);
+            if (sand.get(x, y)) continue;
+            sand.set(x, y, true);
+            placed++;
+        }
     }
 
-    void loop() override {
-        // Add sand continuously
-        if (random(100) > 90) setPixel(5, 8, 1); 
+    void draw() {
+        const uint32_t* rows = sand.rows();
+        clearDisplay();
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            for (int y = 0; y < MATRIX_HEIGHT; y++) if ((rows[x] >> y) & 1) setPixel(x, y, 1);
+        }
+    }
+
+    void logStep(uint32_t us) {
+        stepUsX8 = stepUsX8 - (stepUsX8 >> 3) + us;
+    }
 
-        if (millis() - lastUpdate < 30) return;
-        lastUpdate = millis();
+    void stepSand() {
+        const unsigned long now = millis();
+        if (now - lastStep < SAND_STEP_MS) return;
 
-        // 1. Calculate Gravity Vector from MPU
-        int dx = 0, dy = 0;
-        
-        // MPU Orientation Mapping (Adjust signs based on your specific mounting)
-        // Assuming accX is Up/Down tilt, accY is Left/Right tilt
-        if (abs(accX) > abs(accY)) {
-            // Vertical Dominance
-            if (accX > 0) dx = 1;  else dx = -1; // X axis controls 'Down' on matrix width?
-            // Actually, usually X is long axis. Let's map standard ESP32:
-            // Let's assume accY is Vertical on the matrix (0-15) and accX is Horizontal (0-9)
-            // If that's wrong, swap the logic below.
-        } 
-        
-        // Robust Direction Logic:
-        // accY large positive -> Gravity Down (+Y)
-        // accY large negative -> Gravity Up (-Y)
-        // accX large positive -> Gravity Right (+X)
-        // accX large negative -> Gravity Left (-X)
-        
-        if (abs(accY) > abs(accX)) {
-             if (accY > 0) dy = 1; else dy = -1; // Vertical Gravity
+        // Fixed rate; after a stall, catch up a few steps rather than all of them
+        int due = (int)((now - lastStep) / SAND_STEP_MS);
+        if (due > SAND_MAX_CATCH_UP) {
+            due = SAND_MAX_CATCH_UP;
+            lastStep = now;
         } else {
-             if (accX > 0) dx = 1; else dx = -1; // Horizontal Gravity
+            lastStep += due * SAND_STEP_MS;
         }
 
-        // 2. Scan Direction (Must scan OPPOSITE to gravity to prevent teleporting)
-        int startX = (dx == 1) ? 9 : 0;
-        int endX   = (dx == 1) ? -1 : 10;
-        int stepX  = (dx == 1) ? -1 : 1;
+        // Grid x is panel y and grid y is panel x
+        const int32_t gx = tiltY(16384), gy = tiltX(16384);
+        if (abs(gx) + abs(gy) < SAND_DEADZONE_LSB) return;
+        const uint16_t angle = (uint16_t)fixmath::atan2(gy, gx);
 
-        int startY = (dy == 1) ? 15 : 0;
-        int endY   = (dy == 1) ? -1 : 16;
-        int stepY  = (dy == 1) ? -1 : 1;
+        const int64_t t0 = esp_timer_get_time();
+        int moved = 0;
+        for (int i = 0; i < due; i++) moved += sand.step(angle);
+        logStep((uint32_t)(esp_timer_get_time() - t0) / due);
+        if (moved) draw();
+    }
 
-        // 3. Physics Simulation
-        for (int y = startY; y != endY; y += stepY) {
-            for (int x = startX; x != endX; x += stepX) {
-                
-                if (getPixel(x, y)) { // If there is sand here
-                    
-                    int belowX = x + dx;
-                    int belowY = y + dy;
+public:
+    const char* getName() override { return "360 Sand"; }
 
-                    // A. Check directly below (in gravity direction)
-                    bool canMoveDown = (belowX >= 0 && belowX < 10 && belowY >= 0 && belowY < 16);
-                    if (canMoveDown && !getPixel(belowX, belowY)) {
-                        setPixel(x, y, 0);
-                        setPixel(belowX, belowY, 1);
-                        continue;
-                    }
+    String statsJson() override { return "\"step_us\":" + String(stepUsX8 / 8.0f, 1); }
 
-                    // B. Check diagonals (Slides)
-                    // If gravity is Vertical (dy!=0), check X sides
-                    if (dy != 0) {
-                        int rX = x + 1; int lX = x - 1;
-                        // Try Right Diagonal
-                        if (rX < 10 && !getPixel(rX, belowY) && canMoveDown) {
-                             setPixel(x, y, 0); setPixel(rX, belowY, 1);
-                        }
-                        // Try Left Diagonal
-                        else if (lX >= 0 && !getPixel(lX, belowY) && canMoveDown) {
-                             setPixel(x, y, 0); setPixel(lX, belowY, 1);
-                        }
-                    }
-                    // If gravity is Horizontal (dx!=0), check Y sides
-                    else if (dx != 0) {
-                        int rY = y + 1; int lY = y - 1;
-                         if (rY < 16 && !getPixel(belowX, rY) && canMoveDown) {
-                             setPixel(x, y, 0); setPixel(belowX, rY, 1);
-                        }
-                        else if (lY >= 0 && !getPixel(belowX, lY) && canMoveDown) {
-                             setPixel(x, y, 0); setPixel(belowX, lY, 1);
-                        }
-                    }
-                }
-            }
+    // Grains as panel row words
+    size_t saveState(uint8_t* out, size_t capacity) override {
+        const size_t length = MATRIX_WIDTH * sizeof(uint16_t);
+        if (capacity < length) return 0;
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            const uint16_t row = (uint16_t)sand.rows()[x];
+            memcpy(out + x * sizeof(row), &row, sizeof(row));
         }
+        return length;
+    }
+
+    void restoreState(const uint8_t* data, size_t length) override {
+        if (length != MATRIX_WIDTH * sizeof(uint16_t)) return;
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            uint16_t row;
+            memcpy(&row, data + x * sizeof(row), sizeof(row));
+            sand.rows()[x] = row;
+        }
+        draw();
+    }
+
+    void setup() override {
+        scatter();
+        draw();
+        lastStep = millis();
+    }
+
+    bool onGesture(const Gesture& gesture) override {
+        switch (gesture.type) {
+            case GestureType::Shake:
+                scatter();
+                draw();
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void loop() override {
+        stepSand();
     }
-};
\ No newline at end of file
+};
@@ -8,8 +8,8 @@ public:
     void setup() override {}
     void loop() override {
         clearDisplay();
-        int hx = 4 + (accX / 3000); 
-        int hy = 7 + (accY / 3000);
+        int hx = 4 + tiltX(5);  // ~3000 LSB per pixel
+        int hy = 7 + tiltY(5);
         setPixel(hx, hy, 1); 
         setPixel(hx, hy-1, 1); setPixel(hx, hy+1, 1);
         setPixel(hx-1, hy-1, 1); setPixel(hx-1, hy+1, 1);
@@ -1,27 +1,29 @@
 #pragma once
 #include "Mode.h"
 #include "Globals.h"
+#include "engine/CollisionLayers.h"
 
 // Invader Constants
 #define PLAYER_Y MATRIX_HEIGHT - 1
 #define ALIEN_ROWS 2
-#define ALIEN_COLS 6
-#define BULLET_SPEED 0.5
+#define ALIEN_COLS 5
+#define BULLET_SPEED 128     // Q8 pixels per frame (0.5)
+#define PLAYER_SPEED 1398    // Q8 pixels per frame at 1 g of lean (was accX / 3000)
 
+// Q8 pixels
 struct Bullet {
-    float x, y;
-    bool active;
-};
-
-struct Alien {
-    int x, y;
+    int32_t x, y;
     bool active;
 };
 
+// The alien formation and the player's shot are collision layers: a hit
+// is one AND per row, and the formation's edges, march and reach are a
+// few word operations instead of scans over every alien.
 class ModeInvaders : public Mode {
-    float playerX;
+    enum Layer { Aliens, Shots, kLayerCount };
+    int32_t playerX;  // Q8 pixels
     Bullet playerBullet;
-    Alien aliens[ALIEN_ROWS][ALIEN_COLS];
+    CollisionLayers<kLayerCount> layers{ MATRIX_WIDTH, MATRIX_HEIGHT };
     bool gameRunning = false;
     int direction = 1;
     unsigned long lastMove = 0;
@@ -42,7 +44,7 @@ public:
             // Shoot
             if (!playerBullet.active) {
                 playerBullet.x = playerX;
-                playerBullet.y = PLAYER_Y - 1;
+                playerBullet.y = (PLAYER_Y - 1) * 256;
                 playerBullet.active = true;
             }
         }
@@ -50,18 +52,18 @@ public:
     }
 
     void resetGame() {
-        playerX = MATRIX_WIDTH / 2.0;
+        playerX = MATRIX_WIDTH * 128;
         playerBullet.active = false;
         gameRunning = false;
         direction = 1;
         moveInterval = 500;
+        newWave();
+    }
 
+    void newWave() {
+        layers.clear();
         for (int r = 0; r < ALIEN_ROWS; r++) {
-            for (int c = 0; c < ALIEN_COLS; c++) {
-                aliens[r][c].x = c * 2 + 1; // Spaced out
-                aliens[r][c].y = r * 2 + 1;
-                aliens[r][c].active = true;
-            }
+            for (int c = 0; c < ALIEN_COLS; c++) layers.set(Aliens, c * 2 + 1, r * 2 + 1);  // Spaced out
         }
     }
 
@@ -76,83 +78,52 @@ public:
         }
 
         // 1. Player Movement (MPU)
-        float tilt = accX / 3000.0; 
-        playerX += tilt;
-        if (playerX < 0) playerX = 0;
-        if (playerX >= MATRIX_WIDTH) playerX = MATRIX_WIDTH - 1;
+        playerX = constrain(playerX + tiltX(PLAYER_SPEED), 0, (MATRIX_WIDTH - 1) * 256);
 
         // 2. Bullet Physics
         if (playerBullet.active) {
             playerBullet.y -= BULLET_SPEED;
             if (playerBullet.y < 0) playerBullet.active = false;
 
-            // Collision with Aliens
-            for (int r = 0; r < ALIEN_ROWS; r++) {
-                for (int c = 0; c < ALIEN_COLS; c++) {
-                    if (aliens[r][c].active) {
-                        if (abs(playerBullet.x - aliens[r][c].x) < 1.0 && 
-                            abs(playerBullet.y - aliens[r][c].y) < 1.0) {
-                            aliens[r][c].active = false;
-                            playerBullet.active = false;
-                            // Increase speed
-                            moveInterval -= 10;
-                            if (moveInterval < 50) moveInterval = 50;
-                        }
-                    }
-                }
+            // Collision with Aliens: the shot's cell against the formation
+            layers.clear(Shots);
+            if (playerBullet.active) layers.set(Shots, playerBullet.x >> 8, playerBullet.y >> 8);
+            if (layers.clearOverlap(Aliens, Shots)) {
+                playerBullet.active = false;
+                // Increase speed
+                moveInterval -= 10;
+                if (moveInterval < 50) moveInterval = 50;
+                if (layers.count(Aliens) == 0) newWave();
             }
         }
 
         // 3. Alien Movement
         if (millis() - lastMove > moveInterval) {
             lastMove = millis();
-            bool edgeHit = false;
-
-            // Check edges
-            for (int r = 0; r < ALIEN_ROWS; r++) {
-                for (int c = 0; c < ALIEN_COLS; c++) {
-                    if (!aliens[r][c].active) continue;
-                    
-                    if (direction == 1 && aliens[r][c].x >= MATRIX_WIDTH - 1) edgeHit = true;
-                    if (direction == -1 && aliens[r][c].x <= 0) edgeHit = true;
-                }
-            }
+            // Check edges: the columns any alien is in
+            const uint16_t columns = layers.columns(Aliens);
+            const bool edgeHit = direction == 1 ? (columns >> (MATRIX_WIDTH - 1)) & 1 : columns & 1;
 
             if (edgeHit) {
                 direction *= -1;
                 // Move down
-                for (int r = 0; r < ALIEN_ROWS; r++) {
-                    for (int c = 0; c < ALIEN_COLS; c++) {
-                        aliens[r][c].y++;
-                        if (aliens[r][c].y >= PLAYER_Y) {
-                            gameRunning = false; // Game Over
-                        }
-                    }
+                layers.shift(Aliens, 0, 1);
+                if (layers.lowestRow(Aliens) >= PLAYER_Y) {
+                    gameRunning = false; // Game Over
                 }
             } else {
                 // Move sideways
-                for (int r = 0; r < ALIEN_ROWS; r++) {
-                    for (int c = 0; c < ALIEN_COLS; c++) {
-                        aliens[r][c].x += direction;
-                    }
-                }
+                layers.shift(Aliens, direction, 0);
             }
         }
 
-        // 4. Draw
-        // Player
-        canvas.drawPixel((int)playerX, PLAYER_Y, 1);
-        
-        // Bullet
-        if (playerBullet.active) canvas.drawPixel((int)playerBullet.x, (int)playerBullet.y, 1);
-
-        // Aliens
-        for (int r = 0; r < ALIEN_ROWS; r++) {
-            for (int c = 0; c < ALIEN_COLS; c++) {
-                if (aliens[r][c].active) {
-                    canvas.drawPixel(aliens[r][c].x, aliens[r][c].y, 1);
-                }
-            }
-        }
+        // 4. Draw: player, bullet and aliens as row words
+        uint16_t rows[MATRIX_HEIGHT] = {};
+        rows[PLAYER_Y] = (uint16_t)(0x8000u >> (playerX >> 8));
+        layers.clear(Shots);
+        if (playerBullet.active) layers.set(Shots, playerBullet.x >> 8, playerBullet.y >> 8);
+        layers.draw(Shots, rows);
+        layers.draw(Aliens, rows);
+        rowsToCanvas(rows);
     }
 };
@@ -1,15 +1,22 @@
 #ifndef MODE_LANDER_H
 #define MODE_LANDER_H
 
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/Physics2D.h"
 
+// Moon lander: tilt steers, each click is a burst of thrust; touch down
+// gently on the flat pad. Physics on engine/Physics2D.h (fixed 60 Hz
+// steps) with the terrain as the wall layer, so a fast descent meets the
+// ground instead of sinking through it.
 class ModeLander : public Mode {
 private:
-    float posX, posY;
-    float velX, velY;
-    float gravity;
-    float thrust;
+    PhysicsWorld world{ MATRIX_WIDTH, MATRIX_HEIGHT };
+    PhysicsBody lander;
+    uint16_t ground[MATRIX_HEIGHT];
+    FixedStep clock{ PHYSICS_STEP_US, PHYSICS_MAX_CATCH_UP };
     bool landed;
     bool crashed;
     bool surveying; // Preview mode before launch
@@ -19,8 +26,13 @@ private:
     int padStart; // Index where pad starts
     int padWidth; // How wide the pad is
     
-    // Fuel
-    float fuel;
+    // Fuel (percent)
+    int fuel;
+
+    static constexpr int32_t kGravity = 4;     // 0.016 px per step per step (Q8)
+    static constexpr int32_t kThrust = -43;    // Click: 0.17 px per step upward
+    static constexpr int32_t kSoftY = 114;     // Touchdown slower than 0.45 px per step down ...
+    static constexpr int32_t kSoftX = 71;      // ... and 0.28 px per step sideways
 
     void generateTerrain() {
         // Randomize terrain
@@ -36,20 +48,25 @@ private:
         for(int i=0; i<padWidth; i++) {
             terrain[padStart + i] = padHeight;
         }
+
+        for (int y = 0; y < MATRIX_HEIGHT; y++) {
+            ground[y] = 0;
+            for (int x = 0; x < 10; x++) {
+                if (y >= MATRIX_HEIGHT - terrain[x]) ground[y] |= 1u << x;
+            }
+        }
     }
 
     void reset() {
         generateTerrain();
-        posX = 5.0;
-        posY = 0.0;
-        velX = 0.0;
-        velY = 0.0;
-        gravity = 0.05; // Pulls down
-        thrust = -0.15; // Pushes up (Stronger against gravity)
+        lander = PhysicsBody();
+        lander.x = 5 * 256;
+        lander.y = 0;
+        lander.restitution = 128;  // Off the side edges; the ground ends the flight
         landed = false;
         crashed = false;
         surveying = true;
-        fuel = 100.0;
+        fuel = 100;
     }
 
 public:
@@ -59,6 +76,9 @@ public:
 
     void setup() override {
         reset();
+        world.setWalls(ground);
+        world.setOpenEdges(PhysicsWorld::Top);
+        clock.reset((uint32_t)esp_timer_get_time());
     }
 
     bool handleButton() override {
@@ -72,7 +92,7 @@ public:
             return true;
         } else {
             // In game: Click = Thrust burst
-            velY += thrust * 2.0; 
+            lander.vy += kThrust;
             fuel -= 5;
             return true; // We handled the button
         }
@@ -80,6 +100,9 @@ public:
     }
 
     void loop() override {
+        const int steps = clock.advance((uint32_t)esp_timer_get_time());
+        if (steps == 0) return;
+
         canvas.fillScreen(0);
 
         // 1. Draw Terrain
@@ -117,73 +140,39 @@ public:
         if (crashed) {
             // Explosion visual
             int r = (millis() / 100) % 5;
-            canvas.drawCircle((int)posX, (int)posY, r, 1);
+            canvas.drawCircle(lander.x >> 8, lander.y >> 8, r, 1);
             return;
         }
 
-        // 3. Physics
-        
-        // Gravity
-        velY += gravity;
-
-        // Steering (Tilt X)
-        // accX: -16000 to +16000 approx for 1G.
-        // Calibrated accX is centered around 0.
-        // Tilt left (negative X?) -> velX decreases.
-        float tilt = accX / 4000.0; // Scaled
-        velX += (tilt * -0.05); // Invert if needed based on orientation
-        
-        // Drag
-        velX *= 0.95;
-        
-        // Apply Physics
-        posX += velX;
-        posY += velY;
-
-        // 4. Collision Detection
-        
-        // Screen bounds
-        if (posX < 0) { posX = 0; velX = -velX * 0.5; }
-        if (posX > 9) { posX = 9; velX = -velX * 0.5; }
-        
-        // Ground Collision
-        int boxX = (int)posX;
-        int boxY = (int)posY;
-        
-        if (boxX >= 0 && boxX < 10) {
-            int groundHeight = terrain[boxX];
-            int groundY = 16 - groundHeight;
-            
-            if (posY >= groundY - 1) { // Hit ground
-                // Check if on pad
-                // Check center of lander vs pad range
-                bool onPad = (boxX >= padStart && boxX < padStart + padWidth);
-                
-                // Check speed
-                bool softLanding = (velY < 0.8) && (abs(velX) < 0.5);
-                
-                if (onPad && softLanding) {
-                    landed = true;
-                } else {
-                    crashed = true;
-                }
-                
-                // Stop movement
-                velX = 0;
-                velY = 0;
-                posY = groundY - 1;
+        // 3. Physics: gravity, tilt steering, drag across (x only)
+        const int32_t steer = tiltX(-16);  // 1 g of lean: 0.06 px per step per step
+        for (int i = 0; i < steps && !landed && !crashed; i++) {
+            lander.vx = (lander.vx * 249) / 256;  // 0.97 per step
+
+            PhysicsHit hits[4];
+            const int n = world.step(lander, steer, kGravity, hits, 4);
+
+            // 4. Touchdown: any terrain hit ends the flight; only a gentle one on the pad lands
+            for (int h = 0; h < n && h < 4; h++) {
+                const PhysicsHit& hit = hits[h];
+                if (hit.cellX < 0 || hit.cellX >= 10) continue;  // Side edge
+                const bool onPad = hit.axis == 1 && hit.cellX >= padStart && hit.cellX < padStart + padWidth;
+                const bool softLanding = hit.speed < kSoftY && abs(lander.vx) < kSoftX;
+                if (onPad && softLanding) landed = true;
+                else crashed = true;
+                lander.vx = 0;
+                lander.vy = 0;
+                break;
             }
         }
-        
+
         // Draw Lander
-        canvas.drawPixel((int)posX, (int)posY, 1);
+        canvas.drawPixel(lander.x >> 8, lander.y >> 8, 1);
         
         // Draw Exhaust particle
-        if (velY < 0) { // Moving up/thrusting visual
-             canvas.drawPixel((int)posX, (int)posY + 1, (millis()%2) ? 1:0);
+        if (lander.vy < 0) { // Moving up/thrusting visual
+             canvas.drawPixel(lander.x >> 8, (lander.y >> 8) + 1, (millis()%2) ? 1:0);
         }
-        
-        delay(30); // Slow down game loop
     }
 };
 
@@ -0,0 +1,29 @@
+#pragma once
+#include "NoiseMode.h"
+
+// Lava lamp: simplex noise scrolling upward, its columns swayed by slow
+// value noise, with the contrast pushed up so it reads as blobs with soft
+// (Bayer dithered) rims
+class ModeLavaLamp : public NoiseMode {
+    static constexpr int32_t kPixel = 80;  // Noise units (Q8 cells) per pixel: ~0.3 cells
+    static constexpr int32_t kRise = 5;    // Per frame: a cell every ~1.5 s
+    static constexpr int32_t kSway = 2;
+
+protected:
+    void render() override {
+        const int32_t rise = (int32_t)frame * kRise;
+        for (int y = 0; y < MATRIX_HEIGHT; y++) {
+            // Each row leans a little, so the blobs wobble as they climb
+            const int32_t sway = noise::value(y * 48, (int32_t)frame * kSway) / 2;
+            for (int x = 0; x < MATRIX_WIDTH; x++) {
+                const int32_t v = noise::simplex(x * kPixel + sway, y * kPixel + rise);
+                levels[y * MATRIX_WIDTH + x] = noise::toLevel(v * 3);
+            }
+        }
+    }
+
+public:
+    ModeLavaLamp() : NoiseMode(noise::Dither::Bayer) {}
+
+    const char* getName() override { return "Lava Lamp"; }
+};
@@ -1,51 +1,133 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/LifeGrid.h"
+
+// Life-like automata on the panel: 10 rows (panel x) of 16 cells (panel y),
+// so a grid row is exactly a panel row word. Tap cycles the rule, double
+// tap toggles wrap-around edges, shake reseeds. A fresh board is seeded as
+// soon as the current one dies, freezes or settles into an oscillator.
+// The unbounded HashLife universe is its own mode (ModeLifeUniverse.h).
 class ModeLife : public Mode {
-    uint16_t nextGen[10];
-    unsigned long lastUpdate = 0; 
-    unsigned long lastReset = 0;
+    struct RulePreset { const char* name; const char* rule; };
+    static constexpr int kRuleCount = 4;
+
+    LifeGrid grid{ MATRIX_HEIGHT, MATRIX_WIDTH };
+    uint8_t ruleIndex = 0;
+    unsigned long lastUpdate = 0;
+    uint32_t stepUsX8 = 0;  // EWMA of one generation, scaled by 8
+    int lastPeriod = 0;     // How the last board ended (0: hit kMaxGenerations)
+    uint32_t lastGenerations = 0;
+
+    // Longer cycles than the hash history sees, or endless chaos (Seeds)
+    static constexpr uint32_t kMaxGenerations = 150;
+
+    static const RulePreset& preset(int index) {
+        static const RulePreset kRules[kRuleCount] = {
+            { "Life", "B3/S23" },
+            { "HighLife", "B36/S23" },
+            { "Seeds", "B2/S" },
+            { "Day & Night", "B3678/S34678" },
+        };
+        return kRules[index];
+    }
+
+    void applyRule() {
+        LifeRule rule;
+        if (LifeRule::parse(preset(ruleIndex).rule, rule)) grid.setRule(rule);
+    }
+
+    void reseed() {
+        grid.randomize((uint32_t)random(1, 0x7FFFFFFF), 25);
+    }
+
+    void draw() {
+        clearDisplay();
+        const uint32_t* rows = grid.rows();
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            for (int y = 0; y < MATRIX_HEIGHT; y++) if ((rows[x] >> y) & 1) setPixel(x, y, 1);
+        }
+    }
+
 public:
     const char* getName() override { return "Game of Life"; }
-    void setup() override { 
-        clearDisplay();
-        for(int i=0; i<40; i++) setPixel(random(10), random(16), 1);
+
+    String statsJson() override {
+        String json = "\"rule\":\"" + String(preset(ruleIndex).rule) + "\"";
+        json += ",\"step_us\":" + String(stepUsX8 / 8.0f, 1);
+        json += ",\"last_period\":" + String(lastPeriod);
+        json += ",\"last_generations\":" + String(lastGenerations);
+        return json;
+    }
+
+    // Board as panel row words, then rule and edge mode
+    size_t saveState(uint8_t* out, size_t capacity) override {
+        const size_t length = MATRIX_WIDTH * sizeof(uint16_t) + 2;
+        if (capacity < length) return 0;
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            const uint16_t row = (uint16_t)grid.rows()[x];
+            memcpy(out + x * sizeof(row), &row, sizeof(row));
+        }
+        out[length - 2] = ruleIndex;
+        out[length - 1] = grid.torus() ? 1 : 0;
+        return length;
+    }
+
+    void restoreState(const uint8_t* data, size_t length) override {
+        if (length != MATRIX_WIDTH * sizeof(uint16_t) + 2 || data[length - 2] >= kRuleCount) return;
+        ruleIndex = data[length - 2];
+        applyRule();
+        grid.setTorus(data[length - 1] != 0);
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            uint16_t row;
+            memcpy(&row, data + x * sizeof(row), sizeof(row));
+            grid.rows()[x] = row;
+        }
+        grid.resetHistory();
+        draw();
+    }
+
+    void setup() override {
+        applyRule();
+        reseed();
+        draw();
         lastUpdate = millis();
-        lastReset = millis();
     }
-    
+
+    bool onGesture(const Gesture& gesture) override {
+        switch (gesture.type) {
+            case GestureType::Tap:
+                ruleIndex = (ruleIndex + 1) % kRuleCount;
+                applyRule();
+                return false;
+            case GestureType::DoubleTap:
+                grid.setTorus(!grid.torus());
+                return false;
+            case GestureType::Shake:
+                reseed();
+                draw();
+                return true;
+            default:
+                return false;
+        }
+    }
+
     void loop() override {
         // LOCK SPEED: Update every 800ms (Almost 1 second)
         if (millis() - lastUpdate < 800) return;
         lastUpdate = millis();
-        
-        bool changed = false;
-        memset(nextGen, 0, sizeof(nextGen)); 
-
-        for (int r=0; r<10; r++) {
-            for (int c=0; c<16; c++) {
-                int neighbors = 0;
-                for (int i=-1; i<=1; i++) {
-                    for (int j=-1; j<=1; j++) {
-                        if (i==0 && j==0) continue;
-                        if (getPixel(r+i, c+j)) neighbors++;
-                    }
-                }
-                bool alive = getPixel(r,c);
-                if (alive && (neighbors == 2 || neighbors == 3)) { nextGen[r] |= (1<<c); }
-                else if (!alive && neighbors == 3) { nextGen[r] |= (1<<c); changed = true; }
-                if (alive) changed = true;
-            }
-        }
-        
-        clearDisplay();
-        for(int r=0; r<10; r++) {
-            for(int c=0; c<16; c++) if((nextGen[r] >> c) & 1) setPixel(r,c,1);
-        }
-        
-        if (!changed || (millis() - lastReset > 15000)) { // Reset every 15s
-            setup();
-            lastReset = millis();
+
+        const int64_t t0 = esp_timer_get_time();
+        grid.step();
+        stepUsX8 = stepUsX8 - (stepUsX8 >> 3) + (uint32_t)(esp_timer_get_time() - t0);
+
+        if (grid.period() != 0 || grid.generation() >= kMaxGenerations) {
+            lastPeriod = grid.period();
+            lastGenerations = grid.generation();
+            reseed();
         }
+        draw();
     }
-};
\ No newline at end of file
+};
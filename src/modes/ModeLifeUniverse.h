@@ -0,0 +1,183 @@
+#pragma once
+#include <esp_timer.h>
+#include "Mode.h"
+#include "Globals.h"
+#include "Config.h"
+#include "engine/HashLife.h"
+#include "engine/LifePatterns.h"
+
+// A classic Life pattern in a 2^30-cell-wide HashLife universe, seen through
+// a panel-sized window that tilt pans. Universe x runs along panel y,
+// universe y along panel x. Tap doubles the generations per step (wrapping
+// back to one), double tap re-centres, shake loads the next pattern.
+// The node pool (HASHLIFE_NODES, ~88 KB) is taken in setup() and handed
+// back to the heap in teardown(), so it only exists while the mode is on.
+class ModeLifeUniverse : public Mode {
+    HashLife universe;
+    bool open = false;
+    uint8_t patternIndex = 0;
+    int32_t viewX = 0, viewY = 0;  // Window centre, Q8 cells
+    unsigned long lastUpdate = 0;
+    unsigned long lastPan = 0;
+
+    // Copied out after every step for the stats page (which runs on another task)
+    struct UniverseStats {
+        uint32_t population, used, capacity, bytes;
+        uint32_t hitPermille, collections, evictions, overflows, stepDrops;
+        uint32_t lastUs, usX8, maxUs;
+        uint64_t generation;
+        uint8_t stepLog2;
+    };
+    volatile bool statsOpen = false;
+    UniverseStats stats = {};
+
+    // Patterns are B3/S23, whatever rule the board mode is on
+    void loadPattern() {
+        universe.clear();
+        universe.setStepLog2(0);
+        universe.loadRle(kLifePatterns[patternIndex].rle, 0, 0);
+        viewX = 8 << 8;
+        viewY = 4 << 8;
+        stats = UniverseStats();
+        updateStats();
+    }
+
+    void stepUniverse() {
+        const int64_t t0 = esp_timer_get_time();
+        if (!universe.step()) {
+            Serial.printf("[Life] %s outgrew %u nodes at generation %llu\n", kLifePatterns[patternIndex].name,
+                          (unsigned)universe.capacity(), (unsigned long long)universe.generation());
+            patternIndex = (patternIndex + 1) % kLifePatternCount;
+            loadPattern();
+            return;
+        }
+        stats.lastUs = (uint32_t)(esp_timer_get_time() - t0);
+        stats.usX8 = stats.usX8 - (stats.usX8 >> 3) + stats.lastUs;
+        if (stats.lastUs > stats.maxUs) stats.maxUs = stats.lastUs;
+        updateStats();
+    }
+
+    void updateStats() {
+        const HashLife::Stats& s = universe.stats();
+        stats.population = universe.population();
+        stats.used = universe.used();
+        stats.capacity = universe.capacity();
+        stats.bytes = universe.bytes();
+        stats.hitPermille = s.results ? (uint32_t)((uint64_t)s.resultHits * 1000 / s.results) : 0;
+        stats.collections = s.collections;
+        stats.evictions = s.evictions;
+        stats.overflows = s.overflows;
+        stats.stepDrops = s.stepDrops;
+        stats.generation = universe.generation();
+        stats.stepLog2 = (uint8_t)universe.stepLog2();
+        statsOpen = true;
+    }
+
+    // Leaning pans the window across the universe
+    void pan() {
+        const unsigned long now = millis();
+        const int32_t dt = (int32_t)(now - lastPan);
+        lastPan = now;
+        viewX += tiltY(HASHLIFE_PAN_CELLS * 256) * dt / 1000;
+        viewY += tiltX(HASHLIFE_PAN_CELLS * 256) * dt / 1000;
+    }
+
+    void draw() {
+        clearDisplay();
+        if (!open) return;
+        uint32_t rows[MATRIX_WIDTH];
+        universe.window((viewX >> 8) - MATRIX_HEIGHT / 2, (viewY >> 8) - MATRIX_WIDTH / 2,
+                        MATRIX_HEIGHT, MATRIX_WIDTH, rows);
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            for (int y = 0; y < MATRIX_HEIGHT; y++) if ((rows[x] >> y) & 1) setPixel(x, y, 1);
+        }
+    }
+
+public:
+    const char* getName() override { return "Life Universe"; }
+
+    // Steps of a few thousand nodes take milliseconds
+    uint32_t frameBudgetUs() override { return HASHLIFE_BUDGET_US; }
+
+    // Pattern index only; the universe itself restarts from the pattern
+    size_t saveState(uint8_t* out, size_t capacity) override {
+        if (capacity < 1) return 0;
+        out[0] = patternIndex;
+        return 1;
+    }
+
+    void restoreState(const uint8_t* data, size_t length) override {
+        if (length != 1 || data[0] >= kLifePatternCount || !open) return;
+        patternIndex = data[0];
+        loadPattern();
+        draw();
+    }
+
+    void setup() override {
+        open = universe.begin(HASHLIFE_NODES);
+        if (open) {
+            loadPattern();
+        } else {
+            Serial.printf("[Life] no heap for %u universe nodes (%u bytes)\n", (unsigned)HASHLIFE_NODES,
+                          (unsigned)HashLife::bytesFor(HASHLIFE_NODES));
+        }
+        lastUpdate = lastPan = millis();
+        draw();
+    }
+
+    void teardown() override {
+        statsOpen = false;
+        open = false;
+        universe.release();
+    }
+
+    bool onGesture(const Gesture& gesture) override {
+        if (!open) return false;
+        switch (gesture.type) {
+            case GestureType::Tap:
+                universe.setStepLog2(universe.stepLog2() >= HASHLIFE_MAX_STEP_LOG2 ? 0 : universe.stepLog2() + 1);
+                updateStats();
+                return false;
+            case GestureType::DoubleTap:
+                viewX = 8 << 8;
+                viewY = 4 << 8;
+                return true;
+            case GestureType::Shake:
+                patternIndex = (patternIndex + 1) % kLifePatternCount;
+                loadPattern();
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void loop() override {
+        if (!open) return;
+        pan();
+        if (millis() - lastUpdate >= HASHLIFE_STEP_MS) {
+            lastUpdate = millis();
+            stepUniverse();
+        }
+        draw();
+    }
+
+    // The last step's numbers (racy reads are fine for a status page)
+    String universeJson() const {
+        if (!statsOpen) return "{\"open\":0}";
+        String json = "{\"open\":1,\"pattern\":\"" + String(kLifePatterns[patternIndex].name) + "\"";
+        json += ",\"generation\":" + String((double)stats.generation, 0);
+        json += ",\"step_log2\":" + String(stats.stepLog2);
+        json += ",\"population\":" + String(stats.population);
+        json += ",\"nodes\":" + String(stats.used) + ",\"capacity\":" + String(stats.capacity);
+        json += ",\"bytes\":" + String(stats.bytes);
+        json += ",\"hit_rate\":" + String(stats.hitPermille / 10.0f, 1);
+        json += ",\"collections\":" + String(stats.collections);
+        json += ",\"evictions\":" + String(stats.evictions);
+        json += ",\"overflows\":" + String(stats.overflows);
+        json += ",\"step_drops\":" + String(stats.stepDrops);
+        json += ",\"last_us\":" + String(stats.lastUs);
+        json += ",\"avg_us\":" + String(stats.usX8 / 8);
+        json += ",\"max_us\":" + String(stats.maxUs) + "}";
+        return json;
+    }
+};
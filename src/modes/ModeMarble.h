@@ -1,44 +1,43 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/Physics2D.h"
 
+// A marble rolled around by tilting the board, bouncing softly off the
+// panel edges (engine/Physics2D.h, fixed 60 Hz steps)
 class ModeMarble : public Mode {
-    float ballX, ballY, velX, velY;
-    unsigned long lastUpdate = 0;
+    PhysicsWorld world{ MATRIX_WIDTH, MATRIX_HEIGHT };
+    PhysicsBody ball;
+    FixedStep clock{ PHYSICS_STEP_US, PHYSICS_MAX_CATCH_UP };
+
 public:
+    static constexpr int32_t kMaxSpeed = 205;  // 0.8 px per step (Q8)
+
     const char* getName() override { return "Gyro Marble"; }
-    
-    void setup() override { 
-        ballX = 4.5; ballY = 7.5; velX = 0; velY = 0; 
-        lastUpdate = millis();
+    bool measuresTilt() override { return true; }
+
+    void setup() override {
+        ball = PhysicsBody();
+        ball.x = 4 * 256 + 128;
+        ball.y = 7 * 256 + 128;
+        ball.w = ball.h = 256;
+        ball.damping = 236;     // 0.92: rolls to a stop quickly
+        ball.restitution = 128; // Half the speed back off an edge
+        ball.maxSpeed = kMaxSpeed;
+        clock.reset((uint32_t)esp_timer_get_time());
     }
-    
-    void loop() override {
-        // LOCK SPEED: Run physics only every 16ms (approx 60 FPS)
-        if (millis() - lastUpdate < 16) return;
-        lastUpdate = millis();
 
-        clearDisplay();
-        
-        // Physics (Tweak these numbers to adjust feel)
-        // 0.00005 = Lower sensitivity
-        // 0.92 = More friction (stops faster)
-        velX = (velX + (accX * 0.00005)) * 0.92;
-        velY = (velY + (accY * 0.00005)) * 0.92;
-        
-        // Speed Limit (Prevents teleporting)
-        if (velX > 0.8) velX = 0.8; if (velX < -0.8) velX = -0.8;
-        if (velY > 0.8) velY = 0.8; if (velY < -0.8) velY = -0.8;
+    void loop() override {
+        const int steps = clock.advance((uint32_t)esp_timer_get_time());
+        if (steps == 0) return;
 
-        ballX += velX; 
-        ballY += velY;
+        // 1 g of lean accelerates by 0.82 px per step per step
+        const int32_t ax = tiltX(210), ay = tiltY(210);
+        for (int i = 0; i < steps; i++) world.step(ball, ax, ay);
 
-        // Bounce Logic
-        if(ballX < 0) { ballX=0; velX *= -0.5; } 
-        if(ballX > 9) { ballX=9; velX *= -0.5; }
-        if(ballY < 0) { ballY=0; velY *= -0.5; } 
-        if(ballY > 15){ ballY=15; velY *= -0.5; }
-        
-        setPixel((int)ballX, (int)ballY, 1);
+        clearDisplay();
+        setPixel(ball.x >> 8, ball.y >> 8, 1);
     }
-};
\ No newline at end of file
+};
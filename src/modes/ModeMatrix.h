@@ -6,10 +6,9 @@ enum MatrixDir { RAIN_DOWN, RAIN_UP, RAIN_RIGHT, RAIN_LEFT };
 
 class ModeMatrix : public Mode {
     unsigned long lastUpdate = 0;    // Physics timer
-    unsigned long tiltStartTime = 0; // Direction hold timer
+    bool clearPending = false;       // Direction changed since the last frame
     
     MatrixDir currentDir = RAIN_DOWN;
-    MatrixDir pendingDir = RAIN_DOWN;
 
 public:
     const char* getName() override { return "Water Matrix 4-Way"; }
@@ -17,11 +16,14 @@ public:
     void setup() override { 
         clearDisplay(); 
         lastUpdate = millis();
-        tiltStartTime = millis();
+        clearPending = false;
     }
     
     void loop() override {
-        handleInput();
+        if (clearPending) {
+            clearDisplay(); // Clear screen on change
+            clearPending = false;
+        }
 
         // Speed Control (Run every 60ms)
         if (millis() - lastUpdate < 60) return;
@@ -36,34 +38,33 @@ public:
         }
     }
 
-private:
     // --- 1. INPUT LOGIC (Same as Scroll) ---
-    void handleInput() {
-        MatrixDir detectedDir = currentDir;
-
-        // Detect Tilt (Threshold 3000)
-        // Adjust signs if your sensor is mounted differently
-        if (accX > 3000)      detectedDir = RAIN_LEFT;  // Tilt Left
-        else if (accX < -3000) detectedDir = RAIN_RIGHT; // Tilt Right
-        else if (accY < -3000) detectedDir = RAIN_UP;    // Tilt Forward
-        else if (accY > 3000)  detectedDir = RAIN_DOWN;  // Tilt Back
-
-        if (detectedDir != currentDir) {
-            if (detectedDir == pendingDir) {
-                if (millis() - tiltStartTime > 2000) {
-                    currentDir = detectedDir;
-                    clearDisplay(); // Clear screen on change
-                }
-            } else {
-                pendingDir = detectedDir;
-                tiltStartTime = millis();
+    // TiltHold fires once a direction has been held for GESTURE_HOLD_MS; a flick acts at once
+    bool onGesture(const Gesture& gesture) override {
+        MatrixDir detectedDir;
+        if (gesture.type == GestureType::Flick) {
+            // A flick throws the rain the way the board moved
+            detectedDir = gesture.dir == TiltDir::Left ? RAIN_LEFT : RAIN_RIGHT;
+        } else if (gesture.type == GestureType::TiltHold) {
+            // Adjust signs if your sensor is mounted differently
+            switch (gesture.dir) {
+                case TiltDir::Right: detectedDir = RAIN_LEFT; break;  // Tilt Left
+                case TiltDir::Left:  detectedDir = RAIN_RIGHT; break; // Tilt Right
+                case TiltDir::Up:    detectedDir = RAIN_UP; break;    // Tilt Forward
+                case TiltDir::Down:  detectedDir = RAIN_DOWN; break;  // Tilt Back
+                default: return false;
             }
         } else {
-            pendingDir = currentDir;
-            tiltStartTime = millis(); 
+            return false;
         }
+        if (detectedDir == currentDir) return false;
+
+        currentDir = detectedDir;
+        clearPending = true;
+        return true;
     }
 
+private:
     // --- 2. PHYSICS HELPERS ---
 
     void updateDown() {
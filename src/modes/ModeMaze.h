@@ -1,6 +1,9 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/Physics2D.h"
 
 // Simple Maze (10x16)
 // We'll generate a maze or use a few fixed levels.
@@ -25,25 +28,51 @@ const uint8_t PROGMEM level1[16][10] = {
     {1,1,1,1,1,1,1,1,1,1}
 };
 
+// Tilt the ball through the maze to the blinking exit. Walls are the
+// physics wall layer (engine/Physics2D.h): the ball stops dead against
+// them and slides along them, and can't skip through a corner or a
+// one-pixel wall at any speed.
 class ModeMaze : public Mode {
-    float ballX, ballY, velX, velY;
+    PhysicsWorld world{ MATRIX_WIDTH, MATRIX_HEIGHT };
+    PhysicsBody ball;
+    uint16_t walls[MATRIX_HEIGHT];
+    FixedStep clock{ PHYSICS_STEP_US, PHYSICS_MAX_CATCH_UP };
     int currentLevel = 0;
     bool finished = false;
 
+    static uint8_t cellAt(int x, int y) { return pgm_read_byte(&(level1[y][x])); }
+
 public:
+    static constexpr int32_t kMaxSpeed = 192;  // 0.75 px per step (Q8)
+
     const char* getName() override { return "Maze"; }
 
     void setup() override {
+        for (int y = 0; y < MATRIX_HEIGHT; y++) {
+            walls[y] = 0;
+            for (int x = 0; x < MATRIX_WIDTH; x++) {
+                if (cellAt(x, y) == 1) walls[y] |= 1u << x;
+            }
+        }
+        world.setWalls(walls);
         resetLevel();
+        clock.reset((uint32_t)esp_timer_get_time());
     }
-    
+
     void resetLevel() {
-        ballX = 1.5; ballY = 1.5;
-        velX = 0; velY = 0;
+        ball = PhysicsBody();
+        ball.x = 256 + 128;  // A point in the middle of cell (1, 1)
+        ball.y = 256 + 128;
+        ball.damping = 205;  // 0.8
+        ball.restitution = 0;
+        ball.maxSpeed = kMaxSpeed;
         finished = false;
     }
 
     void loop() override {
+        const int steps = clock.advance((uint32_t)esp_timer_get_time());
+        if (steps == 0) return;
+
         clearDisplay();
 
         if (finished) {
@@ -53,56 +82,22 @@ public:
             canvas.drawPixel(4, 6, 1);
             canvas.drawPixel(5, 5, 1);
             canvas.drawPixel(6, 4, 1);
-            
+
             if (millis() % 2000 < 500) resetLevel();
             return;
         }
 
-        // 1. Physics (Tilt)
-        float accelX = accX / 1000.0;
-        float accelY = accY / 1000.0;
-
-        velX += accelX;
-        velY += accelY;
-        velX *= 0.8; // Damp
-        velY *= 0.8;
-
-        float nextX = ballX + velX;
-        float nextY = ballY + velY;
-
-        // 2. Collision
-        // Check 4 corners of the ball (which is 1x1 pixel?)
-        // Let's treat ball as a point for simplicity on low res
-        int checkX = (int)nextX;
-        int checkY = (int)nextY;
-
-        if (checkX >= 0 && checkX < MATRIX_WIDTH && checkY >= 0 && checkY < MATRIX_HEIGHT) {
-             uint8_t cell = pgm_read_byte(&(level1[checkY][checkX]));
-             if (cell == 1) {
-                 // Wall
-                 velX = 0; velY = 0;
-             } else if (cell == 2) {
-                 // Exit
-                 finished = true;
-             } else {
-                 ballX = nextX;
-                 ballY = nextY;
-             }
-        } else {
-            // Screen Edges
-            if (nextX < 0 || nextX >= MATRIX_WIDTH) velX = 0;
-            if (nextY < 0 || nextY >= MATRIX_HEIGHT) velY = 0;
-            // Clamp
-            if (ballX < 0) ballX = 0;
-            if (ballX >= MATRIX_WIDTH) ballX = MATRIX_WIDTH - 0.1;
-            if (ballY < 0) ballY = 0;
-            if (ballY >= MATRIX_HEIGHT) ballY = MATRIX_HEIGHT - 0.1;
+        // 1 g of lean: 0.25 px per step per step
+        const int32_t ax = tiltX(64), ay = tiltY(64);
+        for (int i = 0; i < steps && !finished; i++) {
+            world.step(ball, ax, ay);
+            if (cellAt(ball.x >> 8, ball.y >> 8) == 2) finished = true;
         }
 
         // Draw Maze
         for (int y = 0; y < 16; y++) {
             for (int x = 0; x < 10; x++) {
-                uint8_t cell = pgm_read_byte(&(level1[y][x]));
+                uint8_t cell = cellAt(x, y);
                 if (cell == 1) canvas.drawPixel(x, y, 1);
                 else if (cell == 2) { // Blink Exit
                     if ((millis()/200)%2) canvas.drawPixel(x, y, 1);
@@ -111,6 +106,6 @@ public:
         }
 
         // Draw Ball
-        canvas.drawPixel((int)ballX, (int)ballY, 1);
+        canvas.drawPixel(ball.x >> 8, ball.y >> 8, 1);
     }
 };
@@ -1,40 +1,43 @@
 #pragma once
-#include "Mode.h"
-#include "Globals.h"
+#include "NoiseMode.h"
+#include "engine/FixedMath.h"
 
-// Simple Plasma effect
-class ModePlasma : public Mode {
-    float time = 0;
+// Classic plasma: four table sines summed per pixel (the ring wave's phase
+// per pixel is worked out once, with an integer square root), Bayer
+// dithered by default so the bands shade off instead of cutting out
+class ModePlasma : public NoiseMode {
+    uint16_t ring[MATRIX_HEIGHT][MATRIX_WIDTH];
+
+    static constexpr int32_t kHalfRadian = fixmath::angleFromRadians(0.5);  // Per pixel along x, y, x + y
+    static constexpr int32_t kRing = fixmath::angleFromRadians(0.2);        // Per pixel away from the corner
+    static constexpr int32_t kTimeStep = fixmath::angleFromRadians(0.1);    // Per frame
+
+protected:
+    void render() override {
+        const uint16_t time = (uint16_t)(frame * kTimeStep);
+        for (int y = 0; y < MATRIX_HEIGHT; y++) {
+            for (int x = 0; x < MATRIX_WIDTH; x++) {
+                levels[y * MATRIX_WIDTH + x] = noise::plasma((uint16_t)(x * kHalfRadian + time),
+                                                             (uint16_t)(y * kHalfRadian + time),
+                                                             (uint16_t)((x + y) * kHalfRadian + time),
+                                                             (uint16_t)(ring[y][x] + time));
+            }
+        }
+    }
 
 public:
+    ModePlasma() : NoiseMode(noise::Dither::Bayer) {}
+
     const char* getName() override { return "Plasma"; }
 
     void setup() override {
-        time = 0;
-    }
-
-    void loop() override {
-        clearDisplay();
-        
+        NoiseMode::setup();
         for (int y = 0; y < MATRIX_HEIGHT; y++) {
             for (int x = 0; x < MATRIX_WIDTH; x++) {
-                // Calculate plasma value
-                float v1 = sin(x * 0.5 + time);
-                float v2 = sin(y * 0.5 + time);
-                float v3 = sin((x + y) * 0.5 + time);
-                float v4 = sin(sqrt((x * x) + (y * y)) * 0.2 + time);
-                
-                float v = (v1 + v2 + v3 + v4);
-                
-                // For monochrome, we threshold
-                // v ranges roughly -4 to 4
-                if (v > 1.0) {
-                    canvas.drawPixel(x, y, 1);
-                }
+                // Distance from the corner in Q8 pixels
+                const int32_t distance = (int32_t)fixmath::isqrt((uint32_t)(x * x + y * y) << 16);
+                ring[y][x] = (uint16_t)((distance * kRing) >> 8);
             }
         }
-        
-        time += 0.1;
-        delay(30);
     }
 };
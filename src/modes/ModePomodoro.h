@@ -17,14 +17,63 @@
 
 class ModePomodoro : public Mode {
     Ticker timer; 
+    Ticker toneStop;
     volatile unsigned long totalSeconds = 0; 
     
     int currentCycle = 0;
     bool isBreak = false;
     int lastProcessedMinute = -1; 
+    bool running = true;   // Timer counting (false while paused or after the last cycle)
+    bool finished = false; // All TOTAL_CYCLES done; a tap starts a new session
 
 public:
     const char* getName() override { return "Pomodoro Pro"; }
+    // Melodies block on purpose; shedding frames wouldn't shorten them
+    OverloadPolicy overloadPolicy() override { return OverloadPolicy::Warn; }
+    PowerClass powerClass() override { return PowerClass::Low; }
+    // The face only moves with the timer; the idle tick is plenty to follow it
+    IdlePolicy idlePolicy() override { return IdlePolicy::WhenStatic; }
+    // A running session must not time out; face-down still pauses it in deep sleep.
+    // Paused or finished, the device may sleep as usual.
+    bool holdsAwake() override { return running; }
+
+    size_t saveState(uint8_t* out, size_t capacity) override {
+        if (capacity < 7) return 0;
+        const uint32_t secs = totalSeconds;
+        memcpy(out, &secs, 4);
+        out[4] = static_cast<uint8_t>(currentCycle);
+        out[5] = isBreak ? 1 : 0;
+        out[6] = (running ? 1 : 0) | (finished ? 2 : 0);
+        return 7;
+    }
+
+    void restoreState(const uint8_t* data, size_t length) override {
+        if (length != 7) return;
+        uint32_t secs;
+        memcpy(&secs, data, 4);
+        noInterrupts();
+        totalSeconds = secs;
+        interrupts();
+        currentCycle = data[4] < TOTAL_CYCLES ? data[4] : 0;
+        isBreak = data[5] != 0;
+        lastProcessedMinute = -1;
+        finished = (data[6] & 2) != 0;
+        if (!(data[6] & 1)) pause();
+    }
+
+    // Tap pauses and resumes the session, or starts a new one once it is over
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type != GestureType::Tap) return false;
+        if (finished) {
+            setup();
+        } else if (running) {
+            pause();
+        } else {
+            running = true;
+            timer.attach(1.0, onTimerTick, this);
+        }
+        return true;
+    }
 
     static void onTimerTick(ModePomodoro* instance) {
         instance->totalSeconds++;
@@ -42,23 +91,32 @@ public:
         currentCycle = 0;
         isBreak = false;
         lastProcessedMinute = -1;
+        running = true;
+        finished = false;
         
         clearDisplay(); // Ensure you have this function or use canvas.fillScreen(0)
         
         // Start Timer
         timer.attach(1.0, onTimerTick, this);
         
-        // Ready Beep (Using safe function)
-        playTone(2000, 100);
+        // Ready Beep (non-blocking so the mode switch isn't stalled)
+        startTone(2000, 100);
     }
     
     ~ModePomodoro() {
         timer.detach();
+        toneStop.detach();
         // Force Silence on Exit so it doesn't get stuck on
         ledcWrite(BUZZER_CHANNEL, 0);
     }
 
     void loop() override {
+        if (finished) {
+            // Session over: every cycle lit until a tap starts the next one
+            for (int i = 0; i < TOTAL_CYCLES * PIXELS_PER_CYCLE; i++) setPixelLinear(i, 1);
+            return;
+        }
+
         // --- 1. CALCULATE TIME ---
         unsigned long currentSecs = totalSeconds;
         int currentMinute = currentSecs / 60;
@@ -91,6 +149,9 @@ public:
                     if (currentCycle >= TOTAL_CYCLES) {
                         playVictoryMelody();
                         currentCycle = 0;
+                        finished = true;
+                        pause();
+                        return;
                     } else {
                         playBackToWorkMelody();
                     }
@@ -112,6 +173,11 @@ public:
     }
 
 private:
+    void pause() {
+        timer.detach();
+        running = false;
+    }
+
     // Helper to reset counters atomically
     void resetCounters() {
         noInterrupts();
@@ -190,6 +256,17 @@ private:
 
     // --- SAFE SOUND FUNCTIONS (Replaces tone()) ---
     
+    static void stopTone() {
+        ledcWrite(BUZZER_CHANNEL, 0);
+    }
+
+    // Fire-and-forget beep; a Ticker silences it after durationMs
+    void startTone(int freq, int durationMs) {
+        ledcWriteTone(BUZZER_CHANNEL, freq);
+        ledcWrite(BUZZER_CHANNEL, 128);
+        toneStop.once_ms(durationMs, stopTone);
+    }
+
     void playTone(int freq, int durationMs) {
         // 1. Set Frequency
         ledcWriteTone(BUZZER_CHANNEL, freq);
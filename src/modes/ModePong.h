@@ -1,56 +1,77 @@
 #pragma once
+#include <esp_timer.h>
 #include "Mode.h"
 #include "Globals.h"
+#include "Config.h"
+#include "engine/Physics2D.h"
+
+// Pong against the computer, played down the long side of the panel: the
+// computer's paddle is on the top row, yours on the bottom, steered by
+// tilt. Game x runs along the panel's 16 rows and game y across its 10
+// columns. The ball speeds up 5% per return, up to kMaxSpeed.
 class ModePong : public Mode {
-    float bx, by, bvx, bvy, aiPos, playPos;
-    unsigned long lastUpdate = 0;
+    static constexpr int kLength = MATRIX_HEIGHT;  // Game x
+    static constexpr int kWidth = MATRIX_WIDTH;    // Game y
+    static constexpr int32_t kPaddle = 3 * 256;
+
+    PhysicsWorld world{ kLength, kWidth };
+    PhysicsBody ball;
+    PhysicsBox paddles[2];  // 0: computer (x = 0), 1: player (x = 15)
+    FixedStep clock{ PHYSICS_STEP_US, PHYSICS_MAX_CATCH_UP };
+
+    void serve() {
+        ball = PhysicsBody();
+        ball.x = 7 * 256 + 128;
+        ball.y = 4 * 256 + 128;
+        ball.w = ball.h = 256;
+        ball.vx = 36;  // 0.14 and 0.08 px per step
+        ball.vy = 21;
+        ball.maxSpeed = kMaxSpeed;
+    }
+
 public:
+    static constexpr int32_t kMaxSpeed = 256;  // 1 px per step (Q8)
+
     const char* getName() override { return "Pong"; }
-    
+
     void setup() override {
-        bx = 7.5; by = 4.5; bvx = 0.25; bvy = 0.15; // Slower start speed
-        aiPos = 3; playPos = 3;
-        lastUpdate = millis();
+        serve();
+        for (int i = 0; i < 2; i++) paddles[i] = { i ? (kLength - 1) * 256 : 0, 3 * 256, 256, kPaddle };
+        world.setOpenEdges(PhysicsWorld::Left | PhysicsWorld::Right);
+        world.setBoxes(paddles, 2);
+        clock.reset((uint32_t)esp_timer_get_time());
     }
-    
+
     void loop() override {
-        // LOCK SPEED: Update game every 30ms (33 FPS)
-        if (millis() - lastUpdate < 30) return;
-        lastUpdate = millis();
+        const int steps = clock.advance((uint32_t)esp_timer_get_time());
+        if (steps == 0) return;
 
-        clearDisplay();
-        bx += bvx; by += bvy;
-        
-        // Player Control (Tilt Y) - Smoother movement
-        int targetY = map(constrain((int)accX, -4000, 4000), -4000, 4000, 0, 7);
-        playPos = (playPos * 0.7) + (targetY * 0.3); 
-        
-        // AI Control (Slightly imperfect to make it beatable)
-        if (by > aiPos + 1.5) aiPos += 0.2;
-        else if (by < aiPos + 1.5) aiPos -= 0.2;
-        aiPos = constrain(aiPos, 0, 7);
-        
-        // Walls
-        if (by < 0 || by > 9) bvy *= -1;
-
-        // Paddles Logic
-        if (bx < 1) { 
-            if (by >= aiPos - 1 && by <= aiPos + 4) { bx = 1; bvx = abs(bvx) * 1.05; } 
-            else if (bx < -2) { setup(); } // Reset if missed
-        }
-        if (bx > 14) { 
-            if (by >= playPos - 1 && by <= playPos + 4) { bx = 14; bvx = -abs(bvx) * 1.05; } 
-            else if (bx > 17) { setup(); } // Reset if missed
+        // Player: tilt picks a spot, the paddle eases toward it
+        const int32_t target = (tiltX(7 * 256 * 4) + 7 * 256) / 2;  // +-1/4 g covers the width
+        for (int i = 0; i < steps; i++) {
+            PhysicsBox& player = paddles[1];
+            player.y += ((constrain(target, 0, (kWidth - 3) * 256) - player.y) * 46) >> 8;
+
+            // Computer: chases the ball at 0.11 px per step (beatable)
+            PhysicsBox& ai = paddles[0];
+            if (ball.y > ai.y + kPaddle / 2) ai.y += 28;
+            else if (ball.y < ai.y + kPaddle / 2) ai.y -= 28;
+            ai.y = constrain(ai.y, 0, (kWidth - 3) * 256);
+
+            PhysicsHit hits[4];
+            const int n = world.step(ball, 0, 0, hits, 4);
+            for (int h = 0; h < n && h < 4; h++) {
+                if (hits[h].box >= 0) ball.vx = (ball.vx * 269) / 256;  // Returned: 5% faster
+            }
+
+            // Missed: serve again once it is well past the paddle
+            if (ball.x < -2 * 256 || ball.x > (kLength + 1) * 256) serve();
         }
 
-        // Draw Paddles
-        //for (int i = 0; i < 3; i++) setPixel((int)aiPos + i, 0, 1);
-        //for (int i = 0; i < 3; i++) setPixel((int)playPos + i, 15, 1);
-        auto drawPaddle = [&](int x, int y) { for(int i=0;i<3;i++) setPixel(x+i,y,1); };
-        drawPaddle((int)aiPos, 0);
-        drawPaddle((int)playPos, 15);
-        
-        // Draw Ball
-        setPixel((int)constrain(by, 0, 9), (int)constrain(bx, 0, 15), 1); 
+        clearDisplay();
+        for (int p = 0; p < 2; p++) {
+            for (int i = 0; i < 3; i++) setPixel((paddles[p].y >> 8) + i, p ? kLength - 1 : 0, 1);
+        }
+        setPixel(constrain(ball.y >> 8, 0, kWidth - 1), constrain(ball.x >> 8, 0, kLength - 1), 1);
     }
-};
\ No newline at end of file
+};
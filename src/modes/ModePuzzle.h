@@ -62,7 +62,7 @@ public:
         canvas.fillScreen(0);
         
         // Handle Tilt
-        float thresh = 4000;
+        const int32_t thresh = 4000;  // LSB, about 0.25 g
         if (millis() - lastMove > 300) {
             // Check tilt
             if (accX > thresh) { moveEmpty(-1, 0); lastMove = millis(); }
@@ -99,4 +99,3 @@ public:
         delay(50);
     }
 };
-};
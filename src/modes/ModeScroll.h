@@ -9,34 +9,28 @@ class ModeScroll : public Mode {
     // State Variables
     int offset;
     unsigned long lastUpdate = 0;       // For scroll speed
-    unsigned long tiltStartTime = 0;    // For 2-second hold timer
+    unsigned long flashUntil = 0;       // Blank flash after a direction change
     
     ScrollDir currentDir = SCROLL_LEFT; // Default Direction
-    ScrollDir pendingDir = SCROLL_LEFT; // Direction currently being held
 
     int msgLen;
     int totalLengthPixels;
-    String cachedMessage;
+    const char* message = "";
+    uint32_t textRevision = 0;
 
 public:
     const char* getName() override { return "4-Way Scroller"; }
     
     void setup() override { 
-        cachedMessage = appScrollText;
-        if (cachedMessage.length() == 0) {
-            cachedMessage = "circuito_suman";
-        }
+        loadMessage();
 
-        if (appScrollDirectionOverride) {
-            currentDir = static_cast<ScrollDir>(constrain(appScrollDirection, 0, 3));
-            pendingDir = currentDir;
+        if (appScroll.directionOverride) {
+            currentDir = static_cast<ScrollDir>(constrain(appScroll.direction, 0, 3));
         }
 
-        msgLen = cachedMessage.length();
-        totalLengthPixels = msgLen * 6; // 6 pixels per char (5 width + 1 space)
         resetOffset();
         lastUpdate = millis();
-        tiltStartTime = millis();
+        flashUntil = 0;
     }
 
     void resetOffset() {
@@ -49,75 +43,60 @@ public:
     }
     
     void loop() override {
-        if (cachedMessage != appScrollText) {
-            cachedMessage = appScrollText;
-            if (cachedMessage.length() == 0) {
-                cachedMessage = "circuito_suman";
-            }
-            msgLen = cachedMessage.length();
-            totalLengthPixels = msgLen * 6;
+        if (textRevision != appScroll.revision) {
+            loadMessage();
             resetOffset();
         }
 
-        if (appScrollDirectionOverride) {
-            const ScrollDir forcedDir = static_cast<ScrollDir>(constrain(appScrollDirection, 0, 3));
+        if (appScroll.directionOverride) {
+            const ScrollDir forcedDir = static_cast<ScrollDir>(constrain(appScroll.direction, 0, 3));
             if (forcedDir != currentDir) {
                 currentDir = forcedDir;
-                pendingDir = currentDir;
                 resetOffset();
             }
         }
 
-        handleInput();
-        
         // Speed Control (Runs every 80ms)
         if (millis() - lastUpdate < 80) return;
         lastUpdate = millis();
 
+        // visual feedback for a direction change
+        if ((long)(flashUntil - millis()) > 0) {
+            clearDisplay();
+            return;
+        }
+
         updatePosition();
         render();
     }
 
-private:
-    // --- 1. INPUT LOGIC (2-Second Hold) ---
-    void handleInput() {
-        if (appScrollDirectionOverride) {
-            pendingDir = currentDir;
-            tiltStartTime = millis();
-            return;
+    // Input: TiltHold fires once a direction has been held for GESTURE_HOLD_MS
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type != GestureType::TiltHold || appScroll.directionOverride) return false;
+
+        ScrollDir detectedDir;
+        switch (gesture.dir) {
+            case TiltDir::Up:    detectedDir = SCROLL_LEFT; break;
+            case TiltDir::Down:  detectedDir = SCROLL_RIGHT; break;
+            case TiltDir::Left:  detectedDir = SCROLL_UP; break;
+            case TiltDir::Right: detectedDir = SCROLL_DOWN; break;
+            default: return false;
         }
+        if (detectedDir == currentDir) return false;
 
-        ScrollDir detectedDir = currentDir; // Default to no change
-
-        // Detect Tilt (Threshold ~3000)
-        if (accY < -3000) detectedDir = SCROLL_LEFT;
-        else if (accY > 3000) detectedDir = SCROLL_RIGHT;
-        else if (accX < -3000) detectedDir = SCROLL_UP;
-        else if (accX > 3000) detectedDir = SCROLL_DOWN;
-
-        // Timer Logic
-        if (detectedDir != currentDir) {
-            if (detectedDir == pendingDir) {
-                // User is holding the new direction
-                if (millis() - tiltStartTime > 2000) {
-                    // 2 Seconds passed! Switch direction.
-                    currentDir = detectedDir;
-                    resetOffset();
-                    
-                    // visual feedback (optional flash)
-                    clearDisplay();
-                    delay(200); 
-                }
-            } else {
-                // New direction detected, start timer
-                pendingDir = detectedDir;
-                tiltStartTime = millis();
-            }
-        } else {
-            // User went back to neutral or current direction
-            pendingDir = currentDir;
-            tiltStartTime = millis(); 
-        }
+        currentDir = detectedDir;
+        resetOffset();
+        flashUntil = millis() + 200;
+        return true;
+    }
+
+private:
+    // appScroll is only written by the engine between frames, so we can point at it
+    void loadMessage() {
+        textRevision = appScroll.revision;
+        message = appScroll.text[0] ? appScroll.text : "circuito_suman";
+        msgLen = strlen(message);
+        totalLengthPixels = msgLen * 6; // 6 pixels per char (5 width + 1 space)
     }
 
     // --- 2. POSITION UPDATE LOGIC ---
@@ -139,8 +118,9 @@ private:
         clearDisplay();
 
         for (int charIdx = 0; charIdx < msgLen; charIdx++) {
-            char c = cachedMessage[charIdx];
+            char c = message[charIdx];
             int fontIdx = c - 32; // Map ASCII to font array
+            if (fontIdx < 0 || fontIdx > 94) fontIdx = 0; // Non-ASCII (UTF-8) bytes render as space
 
             // Calculate 'Virtual' position in the text string
             int textPos = (charIdx * 6) - offset;
@@ -10,11 +10,19 @@ public:
         len=4; sx[0]=5; sy[0]=8; dir=0; foodX=3; foodY=3;
         lastMove=millis();
     }
+    // Steer on every tilt change (not on the move timer, so it feels responsive)
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type != GestureType::Tilt) return false;
+        switch (gesture.dir) {
+            case TiltDir::Right: dir=0; break;
+            case TiltDir::Left:  dir=1; break;
+            case TiltDir::Down:  dir=2; break;
+            case TiltDir::Up:    dir=3; break;
+            default: break;  // Back to level: keep going
+        }
+        return false;  // Drawn on the next move tick
+    }
     void loop() override {
-        // Read Input CONSTANTLY (No timer here, so it feels responsive)
-        if(accX > 3500) dir=0; else if(accX < -3500) dir=1; 
-        else if(accY > 3500) dir=2; else if(accY < -3500) dir=3; 
-
         // Update Game Logic on Timer
         if (millis() - lastMove > 150) {
             lastMove = millis();
@@ -1,19 +1,31 @@
 #pragma once
-#include "Mode.h"
-#include "Globals.h"
+#include "ParticleMode.h"
+#include "engine/FixedMath.h"
 
-class ModeSparkle : public Mode {
-    unsigned long lastUpdate = 0;
-public:
-    const char* getName() override { return "Sparkle"; }
-    void setup() override { clearDisplay(); }
-    void loop() override {
-        if (millis() - lastUpdate < 30) return; // 30ms speed
-        lastUpdate = millis();
+// Sparkle: a pixel lights up every frame somewhere at random and stays lit
+// for one to four seconds, so about 40% of the panel glitters at once
+class ModeSparkle : public ParticleMode {
+    ParticleSystem<160> sparks;
+    ParticleSystem<160>::Emitter panel;
+
+protected:
+    void reset() override {
+        sparks.clear();
+        sparks.seed((uint32_t)random(1, 0x7FFFFFFF));
+        panel.spreadX = MATRIX_WIDTH * fixmath::kOne8;
+        panel.spreadY = MATRIX_HEIGHT * fixmath::kOne8;
+        panel.lifeMin = 33;   // Frames (30 ms each)
+        panel.lifeMax = 133;
+        panel.rateQ8 = 256;
+    }
 
-        int r = random(10);
-        int c = random(16);
-        if(getPixel(r,c)) setPixel(r,c,0);
-        else setPixel(r,c,1);
+    int frame(uint16_t rows[MATRIX_HEIGHT]) override {
+        sparks.stream(panel);
+        const int updated = sparks.step();
+        sparks.raster(rows, MATRIX_WIDTH, MATRIX_HEIGHT);
+        return updated;
     }
-};
\ No newline at end of file
+
+public:
+    const char* getName() override { return "Sparkle"; }
+};
@@ -5,6 +5,7 @@
 class ModeSpiritLevel : public Mode {
 public:
     const char* getName() override { return "Spirit Level"; }
+    bool measuresTilt() override { return true; }
 
     void setup() override {}
 
@@ -19,8 +20,8 @@ public:
         // accX, accY are tilted.
         // If tilted right (positive X), bubble goes left.
         // Sensitivity factor
-        float x = (MATRIX_WIDTH/2.0) - (accX / 500.0);
-        float y = (MATRIX_HEIGHT/2.0) + (accY / 500.0); // Y might need invert check
+        int x = MATRIX_WIDTH/2 - tiltX(33);  // ~500 LSB per pixel
+        int y = MATRIX_HEIGHT/2 + tiltY(33); // Y might need invert check
 
         // Clamp to screen
         if (x < 1) x = 1; if (x > MATRIX_WIDTH - 2) x = MATRIX_WIDTH - 2;
@@ -28,10 +29,10 @@ public:
 
         // Draw Bubble (2x2 or 3x3)
         // Just a bright pixel or cross
-        canvas.drawPixel((int)x, (int)y, 1);
-        canvas.drawPixel((int)x+1, (int)y, 1);
-        canvas.drawPixel((int)x, (int)y+1, 1);
-        canvas.drawPixel((int)x+1, (int)y+1, 1); // 2x2 block
+        canvas.drawPixel(x, y, 1);
+        canvas.drawPixel(x+1, y, 1);
+        canvas.drawPixel(x, y+1, 1);
+        canvas.drawPixel(x+1, y+1, 1); // 2x2 block
 
         delay(20);
     }
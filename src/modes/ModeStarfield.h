@@ -1,51 +1,46 @@
 #pragma once
-#include "Mode.h"
-#include "Globals.h"
-
-struct Star {
-    float x, y, z;
-};
-
-#define STARS_COUNT 20
-
-class ModeStarfield : public Mode {
-    Star stars[STARS_COUNT];
-
-public:
-    const char* getName() override { return "Starfield"; }
-
-    void setup() override {
-        for (int i = 0; i < STARS_COUNT; i++) {
-            resetStar(i);
+#include "ParticleMode.h"
+#include "engine/FixedMath.h"
+
+// Starfield: stars stream out from the middle, speeding up as they go
+// (each frame scales their velocity by ~6%, which is how a steady flight
+// toward them looks in perspective), and are replaced as they leave
+class ModeStarfield : public ParticleMode {
+    static constexpr int kStars = 20;
+    ParticleSystem<kStars> stars;
+    ParticleSystem<kStars>::Emitter core;
+
+protected:
+    void reset() override {
+        stars.clear();
+        stars.seed((uint32_t)random(1, 0x7FFFFFFF));
+        stars.setDrag(272);
+        stars.setBounds(MATRIX_WIDTH, MATRIX_HEIGHT);
+
+        // Near the middle, outward in any direction at 0.03-0.15 px per frame
+        core.x = (MATRIX_WIDTH / 2 - 2) * fixmath::kOne8;
+        core.y = (MATRIX_HEIGHT / 2 - 3) * fixmath::kOne8;
+        core.spreadX = 4 * fixmath::kOne8;
+        core.spreadY = 6 * fixmath::kOne8;
+        core.angleRange = 65535;
+        core.speedMin = fixmath::constant8(0.03);
+        core.speedMax = fixmath::constant8(0.15);
+
+        // Start mid-flight, spread over the screen
+        stars.burst(core, kStars);
+        for (int frame = 0; frame < 40; frame++) {
+            stars.step();
+            if (frame % 2) stars.burst(core, kStars - stars.count());
         }
     }
-    
-    void resetStar(int i) {
-        stars[i].x = random(-50, 50);
-        stars[i].y = random(-50, 50);
-        stars[i].z = random(10, 30); // Start far
-    }
 
-    void loop() override {
-        clearDisplay();
-
-        for (int i = 0; i < STARS_COUNT; i++) {
-            // Move closer
-            stars[i].z -= 0.5;
-
-            if (stars[i].z <= 1) resetStar(i);
-
-            // Project 3D to 2D
-            int sx = (stars[i].x / stars[i].z) + (MATRIX_WIDTH / 2);
-            int sy = (stars[i].y / stars[i].z) + (MATRIX_HEIGHT / 2);
-
-            if (sx >= 0 && sx < MATRIX_WIDTH && sy >= 0 && sy < MATRIX_HEIGHT) {
-                canvas.drawPixel(sx, sy, 1);
-            } else {
-                 if (stars[i].z < 10) resetStar(i); // Off screen? Reset
-            }
-        }
-        
-        delay(30);
+    int frame(uint16_t rows[MATRIX_HEIGHT]) override {
+        const int updated = stars.step();
+        stars.burst(core, kStars - stars.count());
+        stars.raster(rows, MATRIX_WIDTH, MATRIX_HEIGHT);
+        return updated;
     }
+
+public:
+    const char* getName() override { return "Starfield"; }
 };
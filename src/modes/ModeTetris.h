@@ -1,6 +1,7 @@
 #pragma once
 #include "Mode.h"
 #include "Globals.h"
+#include "engine/CollisionLayers.h"
 
 // Standard Tetromino Shapes
 const uint16_t SHAPES[7][4] = {
@@ -13,20 +14,38 @@ const uint16_t SHAPES[7][4] = {
     {0xC600, 0x2640, 0x0C60, 0x4C80}  // Z
 };
 
+// The pile and the falling piece are collision layers: a move is legal if
+// the piece's four row words stay inside and miss the pile, and full rows
+// are found and removed a word at a time.
 class ModeTetris : public Mode {
-    uint16_t board[16]; // Stores the static pile (bitmask)
+    enum Layer { Pile, Piece, kLayerCount };
+    CollisionLayers<kLayerCount> layers{ MATRIX_WIDTH, MATRIX_HEIGHT };
     int px, py, pRot, pType;
-    unsigned long lastFall, lastMove, lastRot;
+    unsigned long lastFall, lastMove;
+    int moveDir = 0;          // -1 / 0 / 1 while tilted left / level / right
+    bool rotatePending = false;
     bool gameOver;
 
 public:
     const char* getName() override { return "Tetris Gyro"; }
 
     void setup() override {
-        memset(board, 0, sizeof(board));
+        layers.clear();
         spawn();
         gameOver = false;
         lastFall = millis();
+        rotatePending = false;
+    }
+
+    // Tilt left/right slides the piece; a tap (or tipping the top edge down) rotates it
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type == GestureType::Tilt) {
+            moveDir = gesture.dir == TiltDir::Left ? -1 : (gesture.dir == TiltDir::Right ? 1 : 0);
+            if (gesture.dir == TiltDir::Up) rotatePending = true;
+        } else if (gesture.type == GestureType::Tap) {
+            rotatePending = true;
+        }
+        return false;  // Tetris never idles; the next frame draws it
     }
 
     void spawn() {
@@ -35,62 +54,44 @@ public:
         px = 3; py = -3; // Start high
     }
 
-    bool check(int x, int y, int rot) {
-        uint16_t bitShape = SHAPES[pType][rot];
+    // SHAPES nibbles (leftmost cell in the top bit) as four layer rows (bit c = column c)
+    static void pieceRows(int type, int rot, uint16_t out[4]) {
         for (int r = 0; r < 4; r++) {
-            for (int c = 0; c < 4; c++) {
-                if (bitShape & (0x8000 >> (r * 4 + c))) { // Test bit
-                    int wx = x + c;
-                    int wy = y + r;
-                    if (wx < 0 || wx > 9 || wy > 15) return true; // Walls/Floor
-                    if (wy >= 0 && (board[wy] & (1 << wx))) return true; // Collision with pile
-                }
-            }
+            out[r] = (uint16_t)(CollisionLayers<kLayerCount>::reverse((SHAPES[type][rot] >> (12 - 4 * r)) & 0xF) >> 12);
         }
-        return false;
+    }
+
+    // True if the piece would leave the well or hit the pile there
+    bool check(int x, int y, int rot) {
+        uint16_t piece[4];
+        pieceRows(pType, rot, piece);
+        return !layers.inside(x, y, piece, 4) || layers.hits(Pile, x, y, piece, 4);
     }
 
     void lock() {
-        uint16_t bitShape = SHAPES[pType][pRot];
-        for (int r = 0; r < 4; r++) {
-            for (int c = 0; c < 4; c++) {
-                if (bitShape & (0x8000 >> (r * 4 + c))) {
-                    int wy = py + r;
-                    int wx = px + c;
-                    if (wy >= 0 && wy < 16) board[wy] |= (1 << wx);
-                }
-            }
-        }
-        
-        // Line Clear
-        for (int y = 0; y < 16; y++) {
-            if (board[y] == 0x3FF) { // 1111111111 (Binary for 10 ones)
-                // Shift down
-                for (int k = y; k > 0; k--) board[k] = board[k-1];
-                board[0] = 0;
-            }
-        }
+        uint16_t piece[4];
+        pieceRows(pType, pRot, piece);
+        layers.stamp(Pile, px, py, piece, 4);
+        layers.removeRows(Pile, layers.fullRows(Pile));
+
         spawn();
-        if (check(px, py, pRot)) { gameOver = true; memset(board, 0, sizeof(board)); }
+        if (check(px, py, pRot)) { gameOver = true; layers.clear(); }
     }
 
     void loop() override {
         if (gameOver) { setup(); return; }
 
-        // INPUT: Move (Tilt Y)
+        // INPUT: Move (repeats while tilted)
         if (millis() - lastMove > 100) {
-            int dir = 0;
-            if (accX < -3000) dir = -1;
-            if (accX > 3000) dir = 1;
-            if (dir != 0 && !check(px + dir, py, pRot)) px += dir;
+            if (moveDir != 0 && !check(px + moveDir, py, pRot)) px += moveDir;
             lastMove = millis();
         }
 
-        // INPUT: Rotate (Tilt X Backwards)
-        if (millis() - lastRot > 400 && accX > 4000) {
+        // INPUT: Rotate (one step per gesture)
+        if (rotatePending) {
             int nRot = (pRot + 1) % 4;
             if (!check(px, py, nRot)) pRot = nRot;
-            lastRot = millis();
+            rotatePending = false;
         }
 
         // GRAVITY
@@ -100,22 +101,14 @@ public:
             lastFall = millis();
         }
 
-        // RENDER
-        clearDisplay();
-        // Draw Board
-        for (int y = 0; y < 16; y++) {
-            for (int x = 0; x < 10; x++) {
-                if (board[y] & (1 << x)) setPixel(x, y, 1);
-            }
-        }
-        // Draw Piece
-        uint16_t bitShape = SHAPES[pType][pRot];
-        for (int r = 0; r < 4; r++) {
-            for (int c = 0; c < 4; c++) {
-                if (bitShape & (0x8000 >> (r * 4 + c))) {
-                    setPixel(px + c, py + r, 1);
-                }
-            }
-        }
+        // RENDER: pile and piece straight into row words
+        uint16_t piece[4];
+        pieceRows(pType, pRot, piece);
+        layers.clear(Piece);
+        layers.stamp(Piece, px, py, piece, 4);
+        uint16_t rows[MATRIX_HEIGHT] = {};
+        layers.draw(Pile, rows);
+        layers.draw(Piece, rows);
+        rowsToCanvas(rows);
     }
 };
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+#include <esp_timer.h>
+#include "Mode.h"
+#include "Globals.h"
+#include "Config.h"
+#include "engine/ShallowWater.h"
+
+// Water in a glass: a heightfield (engine/ShallowWater.h) stepped at a fixed
+// 60 Hz that sloshes when the board tilts and settles on whichever edge is
+// lowest. Volume is exact. Shake splashes it.
+class ModeWater : public Mode {
+    ShallowWater water{ MATRIX_WIDTH, MATRIX_HEIGHT };
+    int64_t dueUs = 0;
+    uint32_t stepUsX8 = 0;  // EWMA of one step, scaled by 8
+
+    void pour() {
+        water.setStiffness(WATER_STIFFNESS_Q8);
+        water.setDamping(WATER_DAMP_SHIFT);
+        water.setGravity(tiltX(ShallowWater::kOneG), tiltY(ShallowWater::kOneG));
+        water.fill(MATRIX_WIDTH * MATRIX_HEIGHT * ShallowWater::kCell / 100 * WATER_FILL_PERCENT);
+        dueUs = esp_timer_get_time();
+    }
+
+    void draw() {
+        uint32_t rows[MATRIX_WIDTH];
+        water.render(rows);
+        clearDisplay();
+        for (int x = 0; x < MATRIX_WIDTH; x++) {
+            for (int y = 0; y < MATRIX_HEIGHT; y++) if ((rows[x] >> y) & 1) setPixel(x, y, 1);
+        }
+    }
+
+    void logStep(uint32_t us) {
+        stepUsX8 = stepUsX8 - (stepUsX8 >> 3) + us;
+    }
+
+public:
+    const char* getName() override { return "Water"; }
+
+    String statsJson() override { return "\"step_us\":" + String(stepUsX8 / 8.0f, 1); }
+
+    // Floor, then column heights (Q8 cells)
+    size_t saveState(uint8_t* out, size_t capacity) override {
+        const size_t length = 1 + water.columns() * sizeof(uint16_t);
+        if (capacity < length) return 0;
+        out[0] = water.floor();
+        for (int i = 0; i < water.columns(); i++) {
+            const uint16_t level = (uint16_t)(water.levels()[i] >> 8);
+            memcpy(out + 1 + i * sizeof(level), &level, sizeof(level));
+        }
+        return length;
+    }
+
+    void restoreState(const uint8_t* data, size_t length) override {
+        if (length < 1 || data[0] > ShallowWater::NegY) return;
+        const ShallowWater::Floor floor = (ShallowWater::Floor)data[0];
+        const int columns = floor <= ShallowWater::NegX ? MATRIX_HEIGHT : MATRIX_WIDTH;
+        if (length != 1 + columns * sizeof(uint16_t)) return;
+        int32_t levels[ShallowWater::kMaxCells];
+        for (int i = 0; i < columns; i++) {
+            uint16_t level;
+            memcpy(&level, data + 1 + i * sizeof(level), sizeof(level));
+            levels[i] = (int32_t)level << 8;
+        }
+        water.load(floor, levels);
+        draw();
+    }
+
+    void setup() override {
+        pour();
+        draw();
+    }
+
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type != GestureType::Shake) return false;
+        water.splash((uint32_t)random(1, 0x7FFFFFFF), WATER_SPLASH_Q16);
+        draw();
+        return true;
+    }
+
+    void loop() override {
+        const int64_t now = esp_timer_get_time();
+        if (now < dueUs) return;
+        dueUs += WATER_STEP_US;
+        if (now - dueUs > WATER_STEP_US * 2) dueUs = now + WATER_STEP_US;  // Stalled: drop the backlog
+
+        water.setGravity(tiltX(ShallowWater::kOneG), tiltY(ShallowWater::kOneG));
+        const int32_t change = water.step();
+        logStep((uint32_t)(esp_timer_get_time() - now));
+        if (change) draw();
+    }
+};
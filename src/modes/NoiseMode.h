@@ -0,0 +1,52 @@
+#pragma once
+#include <esp_timer.h>
+#include "Mode.h"
+#include "Globals.h"
+#include "engine/Noise.h"
+
+// Shared frame loop for the plasma and noise modes (engine/Noise.h): the
+// subclass fills one 0..255 level per pixel, which is dithered straight
+// into the canvas buffer. Tap cycles threshold, Bayer and temporal
+// dithering.
+class NoiseMode : public Mode {
+    unsigned long lastFrame = 0;
+    uint32_t frameUsX8 = 0;  // EWMA of one frame, scaled by 8
+    noise::Dither dither;
+
+protected:
+    uint8_t levels[MATRIX_HEIGHT * MATRIX_WIDTH];
+    uint32_t frame = 0;  // Frames since setup (30 ms each)
+
+    explicit NoiseMode(noise::Dither initial) : dither(initial) {}
+
+    // Fill levels[y * MATRIX_WIDTH + x] for this frame
+    virtual void render() = 0;
+
+public:
+    void setup() override {
+        frame = 0;
+        lastFrame = millis();
+    }
+
+    bool onGesture(const Gesture& gesture) override {
+        if (gesture.type != GestureType::Tap) return false;
+        dither = (noise::Dither)(((int)dither + 1) % 3);
+        return false;
+    }
+
+    void loop() override {
+        if (millis() - lastFrame < 30) return;
+        lastFrame = millis();
+
+        const int64_t t0 = esp_timer_get_time();
+        render();
+        noise::dither(levels, MATRIX_WIDTH, MATRIX_HEIGHT, dither, (uint8_t)frame, canvas.getBuffer());
+        frameUsX8 = frameUsX8 - (frameUsX8 >> 3) + (uint32_t)(esp_timer_get_time() - t0);
+        frame++;
+    }
+
+    String statsJson() override {
+        static const char* const kDither[3] = { "threshold", "bayer", "temporal" };
+        return "\"frame_us\":" + String(frameUsX8 / 8.0f, 1) + ",\"dither\":\"" + kDither[(int)dither] + "\"";
+    }
+};
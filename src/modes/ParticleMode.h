@@ -0,0 +1,49 @@
+#pragma once
+#include <esp_timer.h>
+#include "Mode.h"
+#include "Globals.h"
+#include "engine/Particles.h"
+
+// Shared frame loop for the particle modes (engine/Particles.h): the
+// subclass spawns, steps and rasterizes its systems into row words, which
+// go to the canvas in one pass. Frame time and particle updates per ms
+// go to the "mode" stats source.
+class ParticleMode : public Mode {
+    const uint16_t frameMs;
+    unsigned long lastFrame = 0;
+    uint32_t frameUsX8 = 0;  // EWMAs of one frame, scaled by 8
+    uint32_t updatesX8 = 0;
+
+protected:
+    explicit ParticleMode(uint16_t frameMs = 30) : frameMs(frameMs) {}
+
+    // Back to the opening state
+    virtual void reset() = 0;
+    // One frame: spawn, step and raster into rows (cleared); returns particle updates
+    virtual int frame(uint16_t rows[MATRIX_HEIGHT]) = 0;
+
+public:
+    void setup() override {
+        reset();
+        frameUsX8 = updatesX8 = 0;
+        lastFrame = millis();
+    }
+
+    void loop() override {
+        if (millis() - lastFrame < frameMs) return;
+        lastFrame = millis();
+
+        const int64_t t0 = esp_timer_get_time();
+        uint16_t rows[MATRIX_HEIGHT] = {};
+        const uint32_t updates = (uint32_t)frame(rows);
+        rowsToCanvas(rows);
+        frameUsX8 = frameUsX8 - (frameUsX8 >> 3) + (uint32_t)(esp_timer_get_time() - t0);
+        updatesX8 = updatesX8 - (updatesX8 >> 3) + updates;
+    }
+
+    String statsJson() override {
+        const uint32_t us = frameUsX8, n = updatesX8;
+        return "\"frame_us\":" + String(us / 8.0f, 1) + ",\"updates\":" + String(n / 8.0f, 1) +
+               ",\"updates_per_ms\":" + String(us ? (uint32_t)((uint64_t)n * 1000 / us) : 0);
+    }
+};
@@ -0,0 +1,271 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "engine/CollisionLayers.h"
+
+// Host tests for the grid games' collision layers (pio test -e native)
+
+enum Layer { A, B, kLayerCount };
+typedef CollisionLayers<kLayerCount> Layers;
+
+static uint32_t rng = 2463534242u;
+static uint32_t next() { return fixmath::xorshift32(rng); }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_cells_and_counts(void) {
+    Layers layers(10, 16);
+    TEST_ASSERT_EQUAL_HEX16(0x3FF, layers.fullRow());
+    TEST_ASSERT_EQUAL_INT(-1, layers.lowestRow(A));
+    layers.set(A, 0, 2);
+    layers.set(A, 9, 7);
+    layers.set(A, 10, 7);  // Off the field: ignored
+    layers.set(A, 3, -1);
+    TEST_ASSERT_TRUE(layers.get(A, 9, 7));
+    TEST_ASSERT_FALSE(layers.get(B, 9, 7));
+    TEST_ASSERT_EQUAL_INT(2, layers.count(A));
+    TEST_ASSERT_EQUAL_INT(7, layers.lowestRow(A));
+    TEST_ASSERT_EQUAL_HEX16(0x201, layers.columns(A));
+    layers.set(A, 9, 7, false);
+    TEST_ASSERT_EQUAL_INT(2, layers.lowestRow(A));
+
+    // Display rows put column 0 in the top bit
+    uint16_t rows[16] = {};
+    layers.draw(A, rows);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, rows[2]);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, Layers::reverse(0x8000));
+    TEST_ASSERT_EQUAL_HEX16(0x2C48, Layers::reverse(0x1234));
+}
+
+void test_sprites(void) {
+    Layers layers(10, 16);
+    const uint16_t t[2] = { 0x7, 0x2 };  // A T: three across, one below the middle
+    layers.stamp(A, 8, 14, t, 2);        // Clipped at the right edge
+    TEST_ASSERT_EQUAL_HEX16(0x300, layers.rows(A)[14]);
+    TEST_ASSERT_EQUAL_HEX16(0x200, layers.rows(A)[15]);
+
+    TEST_ASSERT_TRUE(layers.inside(0, 0, t, 2));
+    TEST_ASSERT_TRUE(layers.inside(7, 14, t, 2));
+    TEST_ASSERT_FALSE(layers.inside(8, 0, t, 2));   // Right wall
+    TEST_ASSERT_FALSE(layers.inside(-1, 0, t, 2));  // Left wall
+    TEST_ASSERT_FALSE(layers.inside(0, 15, t, 2));  // Floor
+    TEST_ASSERT_TRUE(layers.inside(0, -2, t, 2));   // Above the top is fine
+
+    TEST_ASSERT_TRUE(layers.hits(A, 7, 13, t, 2));
+    TEST_ASSERT_FALSE(layers.hits(A, 5, 14, t, 2));
+    TEST_ASSERT_FALSE(layers.hits(A, 8, -5, t, 2));
+}
+
+void test_rows_and_layers(void) {
+    Layers layers(10, 16);
+    uint16_t* rows = layers.rows(A);
+    for (int y = 12; y < 16; y++) rows[y] = 0x3FF;
+    rows[13] = 0x1FF;  // Not full
+    rows[11] = 0x00F;
+    TEST_ASSERT_EQUAL_HEX32((1u << 12) | (1u << 14) | (1u << 15), layers.fullRows(A));
+    // Rows 14 and 15 are full together: both go in one call
+    TEST_ASSERT_EQUAL_INT(3, layers.removeRows(A, layers.fullRows(A)));
+    TEST_ASSERT_EQUAL_HEX16(0x1FF, rows[15]);
+    TEST_ASSERT_EQUAL_HEX16(0x00F, rows[14]);
+    TEST_ASSERT_EQUAL_HEX16(0, rows[13]);
+    TEST_ASSERT_EQUAL_INT(13, layers.count(A));
+
+    layers.shift(A, 1, 0);  // The right column falls off
+    TEST_ASSERT_EQUAL_HEX16(0x3FE, rows[15]);
+    layers.shift(A, -2, -1);
+    TEST_ASSERT_EQUAL_HEX16(0x0FF, rows[14]);
+    TEST_ASSERT_EQUAL_HEX16(0x007, rows[13]);
+    TEST_ASSERT_EQUAL_HEX16(0, rows[15]);
+
+    layers.set(B, 1, 13);
+    layers.set(B, 5, 13);
+    TEST_ASSERT_TRUE(layers.overlaps(A, B));
+    TEST_ASSERT_EQUAL_INT(1, layers.clearOverlap(A, B));
+    TEST_ASSERT_FALSE(layers.get(A, 1, 13));
+    TEST_ASSERT_TRUE(layers.get(B, 5, 13));
+    TEST_ASSERT_FALSE(layers.overlaps(A, B));
+}
+
+// ---- Before and after: each game's collision work per frame, the old
+// per-element loops against the layer calls that replaced them ----
+
+static const uint16_t kShapes[7][4] = {
+    {0x0F00, 0x2222, 0x00F0, 0x4444}, {0xCC00, 0xCC00, 0xCC00, 0xCC00}, {0x44C0, 0x8E00, 0xC880, 0xE200},
+    {0x22C0, 0xE800, 0xC440, 0x2E00}, {0x6C00, 0x4620, 0x06C0, 0x8C40}, {0x4E00, 0x4640, 0x0E40, 0x4C40},
+    {0xC600, 0x2640, 0x0C60, 0x4C80},
+};
+
+static bool oldTetrisCheck(const uint16_t* board, int type, int x, int y, int rot) {
+    uint16_t bitShape = kShapes[type][rot];
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) {
+            if (bitShape & (0x8000 >> (r * 4 + c))) {
+                int wx = x + c, wy = y + r;
+                if (wx < 0 || wx > 9 || wy > 15) return true;
+                if (wy >= 0 && (board[wy] & (1 << wx))) return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool newTetrisCheck(const Layers& layers, int type, int x, int y, int rot) {
+    uint16_t piece[4];
+    for (int r = 0; r < 4; r++) piece[r] = (uint16_t)(Layers::reverse((kShapes[type][rot] >> (12 - 4 * r)) & 0xF) >> 12);
+    return !layers.inside(x, y, piece, 4) || layers.hits(A, x, y, piece, 4);
+}
+
+// One Tetris frame: a move and a rotation tried, the board drawn cell by cell / as words
+static double benchTetris(bool layered, uint32_t& sink) {
+    Layers layers(10, 16);
+    uint16_t board[16];
+    for (int y = 0; y < 16; y++) board[y] = y < 8 ? 0 : (uint16_t)(next() & 0x3FF);
+    memcpy(layers.rows(A), board, sizeof(board));
+    const int frames = 200000;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; f++) {
+        const int type = f % 7, x = (int)(f % 9) - 1, y = (int)(f % 12) - 3, rot = f & 3;
+        if (layered) {
+            sink += newTetrisCheck(layers, type, x + 1, y, rot) + newTetrisCheck(layers, type, x, y, (rot + 1) & 3);
+            uint16_t rows[16] = {};
+            layers.draw(A, rows);
+            sink += rows[f & 15] + layers.fullRows(A);
+        } else {
+            sink += oldTetrisCheck(board, type, x + 1, y, rot) + oldTetrisCheck(board, type, x, y, (rot + 1) & 3);
+            uint8_t canvas[32] = {};
+            for (int yy = 0; yy < 16; yy++) {
+                for (int xx = 0; xx < 10; xx++) {
+                    if (board[yy] & (1 << xx)) canvas[yy * 2 + (xx >> 3)] |= (uint8_t)(0x80 >> (xx & 7));
+                }
+            }
+            int full = 0;
+            for (int yy = 0; yy < 16; yy++) full += board[yy] == 0x3FF;
+            sink += canvas[f & 31] + full;
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - t0).count() / frames;
+}
+
+struct OldAlien {
+    int x, y;
+    bool active;
+};
+
+// One Invaders frame: the shot against the formation, an edge check and a
+// march step, the formation drawn
+static double benchInvaders(bool layered, uint32_t& sink) {
+    Layers layers(10, 16);
+    OldAlien aliens[2][5];
+    for (int r = 0; r < 2; r++) {
+        for (int c = 0; c < 5; c++) {
+            aliens[r][c] = { c * 2 + 1, r * 2 + 1, (next() & 3) != 0 };
+            if (aliens[r][c].active) layers.set(A, c * 2 + 1, r * 2 + 1);
+        }
+    }
+    const int frames = 200000;
+    int direction = 1;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; f++) {
+        const float bx = (float)(f % 10), by = (float)(f % 6) + 0.5f;
+        if (layered) {
+            layers.clear(B);
+            layers.set(B, (int)bx, (int)by);
+            sink += (uint32_t)layers.overlaps(A, B);
+            const uint16_t columns = layers.columns(A);
+            const bool edge = direction == 1 ? (columns >> 9) & 1 : columns & 1;
+            if (edge) direction = -direction;
+            layers.shift(A, edge ? 0 : direction, 0);
+            uint16_t rows[16] = {};
+            layers.draw(A, rows);
+            sink += rows[f & 15] + (uint32_t)layers.lowestRow(A);
+        } else {
+            for (int r = 0; r < 2; r++) {
+                for (int c = 0; c < 5; c++) {
+                    if (aliens[r][c].active && fabsf(bx - aliens[r][c].x) < 1.0f && fabsf(by - aliens[r][c].y) < 1.0f) sink++;
+                }
+            }
+            bool edge = false;
+            for (int r = 0; r < 2; r++) {
+                for (int c = 0; c < 5; c++) {
+                    if (!aliens[r][c].active) continue;
+                    if (direction == 1 && aliens[r][c].x >= 9) edge = true;
+                    if (direction == -1 && aliens[r][c].x <= 0) edge = true;
+                }
+            }
+            if (edge) direction = -direction;
+            uint8_t canvas[32] = {};
+            for (int r = 0; r < 2; r++) {
+                for (int c = 0; c < 5; c++) {
+                    if (!edge) aliens[r][c].x += direction;
+                    const OldAlien& a = aliens[r][c];
+                    if (a.active && a.x >= 0 && a.x < 10) canvas[a.y * 2 + (a.x >> 3)] |= (uint8_t)(0x80 >> (a.x & 7));
+                }
+            }
+            sink += canvas[f & 31];
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - t0).count() / frames;
+}
+
+// One Breakout frame: a brick cleared, the bricks counted and drawn
+static double benchBreakout(bool layered, uint32_t& sink) {
+    Layers layers(10, 16);
+    bool bricks[3][10];
+    const int frames = 200000;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; f++) {
+        if (f % 30 == 0) {
+            for (int r = 0; r < 3; r++) {
+                layers.rows(A)[r] = 0x3FF;
+                for (int c = 0; c < 10; c++) bricks[r][c] = true;
+            }
+        }
+        const int x = f % 10, y = f % 3;
+        if (layered) {
+            layers.set(A, x, y, false);
+            uint16_t rows[16] = {};
+            layers.draw(A, rows);
+            sink += rows[y] + (uint32_t)layers.count(A);
+        } else {
+            bricks[y][x] = false;
+            int left = 0;
+            uint8_t canvas[32] = {};
+            for (int r = 0; r < 3; r++) {
+                for (int c = 0; c < 10; c++) {
+                    if (!bricks[r][c]) continue;
+                    left++;
+                    canvas[r * 2 + (c >> 3)] |= (uint8_t)(0x80 >> (c & 7));
+                }
+            }
+            sink += canvas[y * 2] + (uint32_t)left;
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - t0).count() / frames;
+}
+
+void test_benchmark(void) {
+    uint32_t sink = 0;
+    const char* names[3] = { "Tetris", "Invaders", "Breakout" };
+    double (*const benches[3])(bool, uint32_t&) = { benchTetris, benchInvaders, benchBreakout };
+    for (int g = 0; g < 3; g++) {
+        const double before = benches[g](false, sink);
+        const double after = benches[g](true, sink);
+        char msg[128];
+        snprintf(msg, sizeof(msg), "%s collision work per frame: %.0f ns per-element loops, %.0f ns layers (%.1fx)",
+                 names[g], before, after, before / after);
+        TEST_MESSAGE(msg);
+    }
+    TEST_ASSERT_TRUE(sink != 0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_cells_and_counts);
+    RUN_TEST(test_sprites);
+    RUN_TEST(test_rows_and_layers);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
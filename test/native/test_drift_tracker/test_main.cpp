@@ -0,0 +1,69 @@
+#include <unity.h>
+#include "engine/DriftTracker.h"
+
+// Host tests for the bounded calibration drift tracker (pio test -e native)
+
+static const uint32_t kGap = 600000;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Three agreeing windows, ten minutes apart, move the zero one step
+void test_nudges_after_agreeing_windows(void) {
+    DriftTracker drift(48, 4, 160, 3, kGap);
+    TEST_ASSERT_FALSE(drift.addWindow(100, 0, true, 0));
+    TEST_ASSERT_FALSE(drift.addWindow(100, 0, true, kGap));
+    TEST_ASSERT_TRUE(drift.addWindow(100, 0, true, 2 * kGap));
+    TEST_ASSERT_EQUAL_INT32(4, drift.nudge(0));
+    TEST_ASSERT_EQUAL_INT32(0, drift.nudge(1));
+    TEST_ASSERT_EQUAL_INT32(4, drift.total(0));
+    TEST_ASSERT_EQUAL_UINT32(1, drift.nudges());
+}
+
+// Windows closer together than the gap are the same evidence, not more of it
+void test_windows_inside_gap_do_not_vote(void) {
+    DriftTracker drift(48, 4, 160, 3, kGap);
+    for (uint32_t t = 0; t < kGap; t += 5000) TEST_ASSERT_FALSE(drift.addWindow(-100, -100, true, t));
+    TEST_ASSERT_EQUAL_UINT32(1, drift.windows());
+    TEST_ASSERT_EQUAL_INT32(0, drift.total(0));
+}
+
+// Errors inside the dead band, a sign flip, or a window that is not flat all
+// restart the count
+void test_disagreement_resets_votes(void) {
+    DriftTracker drift(48, 4, 160, 3, kGap);
+    uint32_t t = 0;
+    drift.addWindow(100, 0, true, t += kGap);
+    drift.addWindow(100, 0, true, t += kGap);
+    TEST_ASSERT_FALSE(drift.addWindow(-100, 0, true, t += kGap));
+    TEST_ASSERT_FALSE(drift.addWindow(100, 0, true, t += kGap));
+    TEST_ASSERT_FALSE(drift.addWindow(100, 0, true, t += kGap));
+    TEST_ASSERT_FALSE(drift.addWindow(0, 0, false, t += kGap));
+    TEST_ASSERT_FALSE(drift.addWindow(100, 0, true, t += kGap));
+    TEST_ASSERT_FALSE(drift.addWindow(100, 0, true, t += kGap));
+    TEST_ASSERT_FALSE(drift.addWindow(20, 0, true, t += kGap));
+    TEST_ASSERT_EQUAL_INT32(0, drift.total(0));
+}
+
+// A board propped at a steady slope never loses more than the budget
+void test_correction_is_bounded(void) {
+    DriftTracker drift(48, 4, 160, 3, kGap);
+    uint32_t t = 0;
+    for (int i = 0; i < 200; i++) drift.addWindow(250, -250, true, t += kGap);
+    TEST_ASSERT_EQUAL_INT32(160, drift.total(0));
+    TEST_ASSERT_EQUAL_INT32(-160, drift.total(1));
+    TEST_ASSERT_TRUE(drift.capped() > 0);
+
+    drift.anchor();
+    TEST_ASSERT_EQUAL_INT32(0, drift.total(0));
+    TEST_ASSERT_EQUAL_INT32(0, drift.total(1));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_nudges_after_agreeing_windows);
+    RUN_TEST(test_windows_inside_gap_do_not_vote);
+    RUN_TEST(test_disagreement_resets_votes);
+    RUN_TEST(test_correction_is_bounded);
+    return UNITY_END();
+}
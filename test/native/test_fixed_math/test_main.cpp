@@ -0,0 +1,280 @@
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "engine/FixedMath.h"
+
+// Host tests for the fixed-point math library (pio test -e native)
+
+static const double kPi = 3.14159265358979323846;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// The compiler-built table is exact at its entries and close in between
+void test_sin_cos(void) {
+    TEST_ASSERT_EQUAL_INT32(0, fixmath::sin(0));
+    TEST_ASSERT_EQUAL_INT32(fixmath::kOne, fixmath::sin(16384));
+    TEST_ASSERT_EQUAL_INT32(-fixmath::kOne, fixmath::sin(49152));
+    TEST_ASSERT_EQUAL_INT32(fixmath::kOne, fixmath::cos(0));
+    TEST_ASSERT_EQUAL_INT32(-fixmath::kOne, fixmath::cos(32768));
+    TEST_ASSERT_EQUAL_INT16(256, fixmath::sin8(16384));
+
+    int32_t worst = 0;
+    for (uint32_t a = 0; a < 65536; a++) {
+        const double angle = a * 2 * kPi / 65536;
+        const int32_t s = fixmath::sin((uint16_t)a) - (int32_t)lround(sin(angle) * 65536);
+        const int32_t c = fixmath::cos((uint16_t)a) - (int32_t)lround(cos(angle) * 65536);
+        if (abs(s) > worst) worst = abs(s);
+        if (abs(c) > worst) worst = abs(c);
+    }
+    TEST_ASSERT_TRUE(worst <= 8);  // 2^-13
+    char msg[64];
+    snprintf(msg, sizeof(msg), "sin/cos worst error %d / 65536", (int)worst);
+    TEST_MESSAGE(msg);
+}
+
+void test_atan2_and_roots(void) {
+    for (int i = 0; i < 360; i++) {
+        const double angle = i * kPi / 180;
+        const int32_t x = (int32_t)lround(cos(angle) * 10000), y = (int32_t)lround(sin(angle) * 10000);
+        int32_t d = (uint16_t)fixmath::atan2(y, x) - (int32_t)lround(i * 65536.0 / 360) % 65536;
+        if (d > 32768) d -= 65536;
+        if (d < -32768) d += 65536;
+        TEST_ASSERT_INT_WITHIN(48, 0, d);  // ~0.25 deg
+    }
+
+    const uint32_t values[] = { 0, 1, 2, 3, 4, 15, 16, 17, 99, 100, 65535, 65536, 1000001, 0xFFFFFFFFu };
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        const uint32_t r = fixmath::isqrt(values[i]);
+        TEST_ASSERT_TRUE((uint64_t)r * r <= values[i]);
+        TEST_ASSERT_TRUE((uint64_t)(r + 1) * (r + 1) > values[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, fixmath::isqrt64(0xFFFFFFFFFFFFFFFFull));
+    TEST_ASSERT_EQUAL_INT32(fixmath::constant(1.5), fixmath::sqrt(fixmath::constant(2.25)));
+    TEST_ASSERT_EQUAL_INT32(46340, fixmath::sqrt(fixmath::kOne / 2));  // sqrt(0.5) = 0.707107, rounded down
+    TEST_ASSERT_EQUAL_INT32(0, fixmath::sqrt(-5));
+    TEST_ASSERT_EQUAL_UINT32(5, fixmath::hypot(-3, 4));
+    TEST_ASSERT_EQUAL_UINT32(2896309, fixmath::hypot(2048000, -2048000));
+}
+
+void test_arithmetic(void) {
+    using namespace fixmath;
+    TEST_ASSERT_EQUAL_INT32(constant(3.75), mul(constant(1.5), constant(2.5)));
+    TEST_ASSERT_EQUAL_INT32(constant(-0.25), mul(constant(0.5), constant(-0.5)));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, mulSat(fromInt(30000), fromInt(30000)));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, mulSat(fromInt(-30000), fromInt(30000)));
+    TEST_ASSERT_EQUAL_INT32(39321, divide(constant(1.5), constant(2.5)));  // 0.6, truncated
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, divide(fromInt(1), 0));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, divide(fromInt(-1), 0));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, divide(fromInt(30000), constant(0.001)));
+
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, addSat(INT32_MAX - 5, 10));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, subSat(INT32_MIN + 5, 10));
+    TEST_ASSERT_EQUAL_INT32(7, addSat(3, 4));
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, addSat16(30000, 30000));
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, subSat16(-30000, 30000));
+    TEST_ASSERT_EQUAL_INT16(constant8(0.75), mul8(constant8(1.5), constant8(0.5)));
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, mulSat8(constant8(100), constant8(100)));
+
+    TEST_ASSERT_EQUAL_INT32(2, toInt(constant(2.99)));
+    TEST_ASSERT_EQUAL_INT32(-3, toInt(constant(-2.01)));
+    TEST_ASSERT_EQUAL_INT32(3, roundToInt(constant(2.5)));
+    TEST_ASSERT_EQUAL_INT32(-2, roundToInt(constant(-2.4)));
+    TEST_ASSERT_EQUAL_INT16(constant8(1.25), toQ8(constant(1.25)));
+    TEST_ASSERT_EQUAL_INT32(constant(-1.25), fromQ8(constant8(-1.25)));
+    TEST_ASSERT_EQUAL_INT32(constant(1.5), lerp(fromInt(1), fromInt(2), kOne / 2));
+    TEST_ASSERT_EQUAL_INT32(16384, angleFromDegrees(90));
+    TEST_ASSERT_EQUAL_INT32(-5461, angleFromDegrees(-30));
+    TEST_ASSERT_EQUAL_INT32(10430, angleFromRadians(1.0));
+
+    uint32_t state = 1;
+    TEST_ASSERT_EQUAL_UINT32(270369u, xorshift32(state));  // Marsaglia's first output for seed 1
+    TEST_ASSERT_EQUAL_UINT32(270369u, state);
+    for (int i = 0; i < 1000; i++) {
+        const uint32_t v = xorshift32(state);
+        int bits = 0;
+        for (uint32_t m = v; m; m >>= 1) bits += m & 1;
+        TEST_ASSERT_EQUAL_INT(bits, popcount32(v));
+    }
+    TEST_ASSERT_EQUAL_INT(0, popcount32(0));
+    TEST_ASSERT_EQUAL_INT(32, popcount32(0xFFFFFFFFu));
+}
+
+// --- Per-frame math of the ported modes, as it was (libm) and as it is ---
+
+static int plasmaFloat(float time) {
+    int lit = 0;
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 10; x++) {
+            float v = sin(x * 0.5 + time) + sin(y * 0.5 + time) + sin((x + y) * 0.5 + time) +
+                      sin(sqrt((x * x) + (y * y)) * 0.2 + time);
+            lit += v > 1.0;
+        }
+    }
+    return lit;
+}
+
+static uint16_t plasmaRing[16][10];
+
+static void plasmaSetup() {
+    static constexpr int32_t kRing = fixmath::angleFromRadians(0.2);
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 10; x++) {
+            const int32_t distance = (int32_t)fixmath::isqrt((uint32_t)(x * x + y * y) << 16);
+            plasmaRing[y][x] = (uint16_t)((distance * kRing) >> 8);
+        }
+    }
+}
+
+static int plasmaFixed(uint16_t time) {
+    static constexpr int32_t kHalfRadian = fixmath::angleFromRadians(0.5);
+    int lit = 0;
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 10; x++) {
+            const fixmath::q16 v = fixmath::sin((uint16_t)(x * kHalfRadian + time)) +
+                                   fixmath::sin((uint16_t)(y * kHalfRadian + time)) +
+                                   fixmath::sin((uint16_t)((x + y) * kHalfRadian + time)) +
+                                   fixmath::sin((uint16_t)(plasmaRing[y][x] + time));
+            lit += v > fixmath::kOne;
+        }
+    }
+    return lit;
+}
+
+static int cubeFloat(float ax, float ay, float az, float t) {
+    const float scale = 3.5 + sin(t) * 0.5;
+    const float cX = cos(ax), sX = sin(ax), cY = cos(ay), sY = sin(ay), cZ = cos(az), sZ = sin(az);
+    int sum = 0;
+    for (int i = 0; i < 8; i++) {
+        float x = (i & 1) ? 1 : -1, y = (i & 2) ? 1 : -1, z = (i & 4) ? 1 : -1;
+        float y1 = y * cX - z * sX, z1 = y * sX + z * cX;
+        float x2 = x * cY + z1 * sY;
+        float x3 = x2 * cZ - y1 * sZ, y3 = x2 * sZ + y1 * cZ;
+        sum += (int)(x3 * scale) + (int)(y3 * scale);
+    }
+    return sum;
+}
+
+static int cubeFixed(uint16_t ax, uint16_t ay, uint16_t az, uint16_t t) {
+    using namespace fixmath;
+    const q16 scale = constant(3.5) + fixmath::sin(t) / 2;
+    const q16 cX = fixmath::cos(ax), sX = fixmath::sin(ax), cY = fixmath::cos(ay), sY = fixmath::sin(ay);
+    const q16 cZ = fixmath::cos(az), sZ = fixmath::sin(az);
+    int sum = 0;
+    for (int i = 0; i < 8; i++) {
+        q16 x = (i & 1) ? kOne : -kOne, y = (i & 2) ? kOne : -kOne, z = (i & 4) ? kOne : -kOne;
+        q16 y1 = mul(y, cX) - mul(z, sX), z1 = mul(y, sX) + mul(z, cX);
+        q16 x2 = mul(x, cY) + mul(z1, sY);
+        q16 x3 = mul(x2, cZ) - mul(y1, sZ), y3 = mul(x2, sZ) + mul(y1, cZ);
+        sum += roundToInt(mul(x3, scale)) + roundToInt(mul(y3, scale));
+    }
+    return sum;
+}
+
+static float explodeFloat(int degrees, int speed10) {
+    float angle = degrees * kPi / 180.0;
+    float speed = speed10 / 10.0;
+    return cos(angle) * speed + sin(angle) * speed;
+}
+
+static int explodeFixed(int degrees, int speed10) {
+    const uint16_t angle = (uint16_t)(degrees * 65536 / 360);
+    const int32_t speed = speed10 * fixmath::kOne8 / 10;
+    return ((fixmath::cos(angle) * speed) >> 16) + ((fixmath::sin(angle) * speed) >> 16);
+}
+
+static int starsFloat(const int16_t* xy, const float* z) {
+    int sum = 0;
+    for (int i = 0; i < 20; i++) sum += (int)(xy[i] / z[i] + 5) + (int)(xy[i + 20] / z[i] + 8);
+    return sum;
+}
+
+static int starsFixed(const int16_t* xy, const int16_t* z) {
+    int sum = 0;
+    for (int i = 0; i < 20; i++) {
+        sum += ((xy[i] * 65536) / z[i] + 5 * 256) / 256 + ((xy[i + 20] * 65536) / z[i] + 8 * 256) / 256;
+    }
+    return sum;
+}
+
+// The fixed-point frames light the same pixels as the float ones (to within
+// a pixel or two on threshold edges)
+void test_modes_match_float(void) {
+    plasmaSetup();
+    for (int frame = 0; frame < 200; frame++) {
+        const int a = plasmaFloat(frame * 0.1f), b = plasmaFixed((uint16_t)(frame * fixmath::angleFromRadians(0.1)));
+        TEST_ASSERT_INT_WITHIN(3, a, b);
+    }
+    for (int frame = 0; frame < 200; frame++) {
+        const int a = cubeFloat(frame * 0.04f, frame * 0.06f, frame * 0.02f, frame * 0.03f);
+        const int b = cubeFixed((uint16_t)(frame * fixmath::angleFromRadians(0.04)),
+                                (uint16_t)(frame * fixmath::angleFromRadians(0.06)),
+                                (uint16_t)(frame * fixmath::angleFromRadians(0.02)),
+                                (uint16_t)(frame * fixmath::angleFromRadians(0.03)));
+        TEST_ASSERT_INT_WITHIN(8, a, b);
+    }
+    for (int d = 0; d < 360; d += 7) {
+        TEST_ASSERT_INT_WITHIN(3, (int)lround(explodeFloat(d, 14) * 256), explodeFixed(d, 14));
+    }
+}
+
+template <typename F> static double nsPer(int runs, F f) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < runs; i++) f(i);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / runs;
+}
+
+// Informational: the host has a double FPU, so Cube and Starfield come out
+// slower in fixed point here. What matters is the device, where the libm
+// side is soft double; compare with the mode's frame stats there.
+void test_benchmark(void) {
+    volatile int sink = 0;
+    int16_t xy[40], zq[20];
+    float zf[20];
+    for (int i = 0; i < 20; i++) {
+        xy[i] = (int16_t)((i * 37) % 100 - 50);
+        xy[i + 20] = (int16_t)((i * 61) % 100 - 50);
+        zq[i] = (int16_t)((10 + i) * 256 + 128);
+        zf[i] = zq[i] / 256.0f;
+    }
+    struct Row { const char* name; double before, after; };
+    const Row rows[] = {
+        { "Plasma (160 px)",
+          nsPer(5000, [&](int i) { sink += plasmaFloat(i * 0.1f); }),
+          nsPer(5000, [&](int i) { sink += plasmaFixed((uint16_t)(i * 1043)); }) },
+        { "Cube (8 vertices)",
+          nsPer(100000, [&](int i) { sink += cubeFloat(i * 0.04f, i * 0.06f, i * 0.02f, i * 0.03f); }),
+          nsPer(100000, [&](int i) {
+              sink += cubeFixed((uint16_t)(i * 417), (uint16_t)(i * 626), (uint16_t)(i * 209), (uint16_t)(i * 313));
+          }) },
+        { "Fireworks (12 sparks)",
+          nsPer(100000, [&](int i) {
+              for (int k = 0; k < 12; k++) sink += (int)explodeFloat(i + k * 29, 5 + k % 10);
+          }),
+          nsPer(100000, [&](int i) {
+              for (int k = 0; k < 12; k++) sink += explodeFixed((i + k * 29) % 360, 5 + k % 10);
+          }) },
+        { "Starfield (20 stars)",
+          nsPer(100000, [&](int i) { zf[i % 20] += 0.0f; sink += starsFloat(xy, zf); }),
+          nsPer(100000, [&](int i) { zq[i % 20] += 0; sink += starsFixed(xy, zq); }) },
+    };
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        char msg[128];
+        snprintf(msg, sizeof(msg), "%-22s frame math on the host: libm %6.0f ns, fixed %6.0f ns (%.1fx)", rows[i].name,
+                 rows[i].before, rows[i].after, rows[i].before / rows[i].after);
+        TEST_MESSAGE(msg);
+    }
+    (void)sink;
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_sin_cos);
+    RUN_TEST(test_atan2_and_roots);
+    RUN_TEST(test_arithmetic);
+    RUN_TEST(test_modes_match_float);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
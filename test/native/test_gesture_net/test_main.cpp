@@ -0,0 +1,229 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "engine/GestureNet.h"
+#include "engine/GestureModelData.h"
+#include "../../../tools/gesture_model/GestureSynth.h"
+#include "../../../tools/gesture_model/GestureTrainer.h"
+
+// Host harness for the int8 gesture network (pio test -e native): the
+// shipped blob's accuracy on held-out synthetic windows, the kernels
+// against a plain reference and a float network, and throughput.
+
+using namespace gesturenet;
+
+static const char* const kNames[kClasses] = { "idle", "flick left", "flick right", "double tap", "circle" };
+
+static Model model;
+
+void setUp(void) { TEST_ASSERT_TRUE(model.load(kGestureModel, sizeof(kGestureModel))); }
+void tearDown(void) {}
+
+void test_blob_loads(void) {
+    const ModelHeader& h = model.header();
+    TEST_ASSERT_EQUAL_INT(kClasses, h.classes);
+    TEST_ASSERT_EQUAL_INT(kChannels, h.channels);
+    TEST_ASSERT_EQUAL_INT(model.inputs(), model.layer(0).inputs);
+    TEST_ASSERT_TRUE(model.macs() < 12000);
+
+    // Truncated, corrupted or misaligned blobs are refused
+    static uint8_t copy[sizeof(kGestureModel) + 4] __attribute__((aligned(4)));
+    memcpy(copy, kGestureModel, sizeof(kGestureModel));
+    Model other;
+    TEST_ASSERT_TRUE(other.load(copy, sizeof(kGestureModel)));
+    TEST_ASSERT_FALSE(other.load(copy, sizeof(kGestureModel) - 1));
+    TEST_ASSERT_FALSE(other.load(copy + 1, sizeof(kGestureModel)));
+    copy[0] ^= 1;
+    TEST_ASSERT_FALSE(other.load(copy, sizeof(kGestureModel)));
+    TEST_ASSERT_FALSE(other.valid());
+}
+
+// Plain per-element reference for the unrolled two-row kernel
+static void denseNaive(const Layer& layer, const int8_t* in, int8_t* out) {
+    for (int r = 0; r < layer.outputs; r++) {
+        int32_t acc = layer.bias[r];
+        for (int i = 0; i < layer.inputs; i++) acc += layer.weights[r * layer.inputs + i] * in[i];
+        out[r] = requantize(acc, layer.mult[r], layer.shift[r], layer.relu);
+    }
+}
+
+void test_kernel_matches_reference(void) {
+    gesturesynth::Rng rng(11);
+    const int inputs = 36, outputs = 7;  // Odd row count exercises the tail
+    std::vector<int8_t> w(inputs * outputs), in(inputs);
+    std::vector<int32_t> bias(outputs), mult(outputs);
+    std::vector<int8_t> shift(outputs);
+    for (size_t k = 0; k < w.size(); k++) w[k] = (int8_t)(rng.below(255) - 127);
+    for (int r = 0; r < outputs; r++) {
+        bias[r] = rng.below(20001) - 10000;
+        mult[r] = (int32_t)(0x40000000u + rng.below(0x3FFFFFFF));
+        shift[r] = (int8_t)(6 + rng.below(6));
+    }
+    Layer layer = { w.data(), bias.data(), mult.data(), shift.data(), (uint16_t)inputs, (uint16_t)outputs, false };
+    int16_t wide[kMaxInputs];
+    int8_t a[kMaxWidth], b[kMaxWidth];
+    for (int trial = 0; trial < 200; trial++) {
+        for (int i = 0; i < inputs; i++) in[i] = (int8_t)(rng.below(256) - 128);
+        layer.relu = trial & 1;
+        dense(layer, in.data(), a, wide);
+        denseNaive(layer, in.data(), b);
+        TEST_ASSERT_EQUAL_MEMORY(b, a, outputs);
+    }
+}
+
+void test_blob_accuracy(void) {
+    // Same seed and size as tools/gesture_model/train.cpp, which writes this figure into the header
+    const std::vector<gesturesynth::Example> test = gesturesynth::dataset(7, 2000, model.header());
+    int ok = 0, perClass[kClasses] = {}, perClassOk[kClasses] = {};
+    for (size_t k = 0; k < test.size(); k++) {
+        Result r;
+        model.classify(test[k].input, r);
+        ok += (int)r.label == test[k].label;
+        perClass[test[k].label]++;
+        perClassOk[test[k].label] += (int)r.label == test[k].label;
+    }
+    char msg[96];
+    snprintf(msg, sizeof(msg), "int8 blob: %.1f%% of %d held-out windows", 100.0 * ok / test.size(), (int)test.size());
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(ok >= (int)test.size() * 95 / 100);
+    for (int c = 0; c < kClasses; c++) {
+        snprintf(msg, sizeof(msg), "  %-11s %.1f%%", kNames[c], 100.0 * perClassOk[c] / perClass[c]);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_TRUE(perClassOk[c] >= perClass[c] * 85 / 100);
+    }
+}
+
+// A quick float network, quantized the way train.cpp does it: the int8
+// kernels must follow the float reference window for window
+void test_int8_matches_float(void) {
+    const ModelHeader base = gesturetrainer::defaultHeader();
+    const std::vector<gesturesynth::Example> train = gesturesynth::dataset(21, 3000, base);
+    const std::vector<gesturesynth::Example> test = gesturesynth::dataset(22, 1000, base);
+    std::vector<int> widths;
+    widths.push_back(base.frames * base.channels);
+    widths.push_back(24);
+    widths.push_back(16);
+    widths.push_back(kClasses);
+    gesturetrainer::Mlp net(widths, 23);
+    net.train(train, 8, 24);
+    const std::vector<uint8_t> blob = gesturetrainer::quantize(net, base, train);
+    Model q;
+    TEST_ASSERT_TRUE(q.load(blob.data(), blob.size()));
+
+    int floatOk = 0, intOk = 0, agree = 0;
+    for (size_t k = 0; k < test.size(); k++) {
+        Result r;
+        q.classify(test[k].input, r);
+        const int f = net.predict(test[k].input);
+        floatOk += f == test[k].label;
+        intOk += (int)r.label == test[k].label;
+        agree += (int)r.label == f;
+    }
+    char msg[96];
+    snprintf(msg, sizeof(msg), "float %.1f%%, int8 %.1f%%, agreement %.1f%%",
+             100.0 * floatOk / test.size(), 100.0 * intOk / test.size(), 100.0 * agree / test.size());
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(agree >= (int)test.size() * 97 / 100);
+    TEST_ASSERT_TRUE(intOk >= floatOk - (int)test.size() / 50);
+}
+
+// Gestures and look-alikes in one continuous stream, through the same
+// window, gating and trigger the firmware uses
+void test_stream_detection(void) {
+    const ModelHeader& h = model.header();
+    gesturesynth::Rng rng(31);
+    const int gapSamples = 600;  // 1.2 s of hand-held background between events
+    const int events = 60;
+    gesturesynth::Stream s(events * (gapSamples + 500) + gapSamples);
+    s.background(rng, 0.5);
+    std::vector<int> starts, ends, labels;
+    int pos = gapSamples;
+    for (int e = 0; e < events; e++) {
+        const NetClass cls = static_cast<NetClass>(e % kClasses);
+        const int len = gesturesynth::gesture(s, rng, cls, pos);
+        starts.push_back(pos);
+        ends.push_back(pos + len);
+        labels.push_back((int)cls);
+        pos += len + gapSamples;
+    }
+    const std::vector<gesturesynth::Sample> samples = s.samples();
+
+    Window window;
+    window.configure(h, gesturesynth::kSampleHz);
+    Trigger trigger(model.marginLsb(512), h.frames);
+    const int decimate = gesturesynth::kSampleHz / h.frameHz;
+    int8_t input[kMaxInputs];
+    int hits = 0, wrong = 0, inferences = 0;
+    std::vector<bool> found(events, false);
+    for (int i = 0; i < pos; i++) {
+        if (!window.add(samples[i].linear, samples[i].gyro)) continue;
+        if (!window.full() || window.count() % 4 != 0 || !window.active()) continue;
+        window.copy(input);
+        Result r;
+        model.classify(input, r);
+        inferences++;
+        if (!trigger.accept(r, window.count())) continue;
+        // Credit the event whose end is closest before this window's end
+        int match = -1;
+        for (int e = 0; e < events; e++) {
+            if (starts[e] <= i && i - ends[e] < h.frames * decimate) match = e;
+        }
+        if (match >= 0 && labels[match] == (int)r.label && !found[match]) {
+            found[match] = true;
+            hits++;
+        } else {
+            wrong++;
+        }
+    }
+    const int positives = events - events / kClasses;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "stream: %d/%d gestures, %d false, %d inferences", hits, positives, wrong, inferences);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(hits >= positives * 9 / 10);
+    TEST_ASSERT_TRUE(wrong <= 3);
+}
+
+void test_benchmark(void) {
+    const std::vector<gesturesynth::Example> data = gesturesynth::dataset(41, 64, model.header());
+    const int kRuns = 20000;
+    volatile int sink = 0;
+    Result r;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kRuns; i++) {
+        model.classify(data[i & 63].input, r);
+        sink += (int)r.label;
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    // Same shape in float, for scale
+    const ModelHeader base = gesturetrainer::defaultHeader();
+    std::vector<int> widths;
+    widths.push_back(base.frames * base.channels);
+    widths.push_back(24);
+    widths.push_back(16);
+    widths.push_back(kClasses);
+    gesturetrainer::Mlp net(widths, 1);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kRuns / 10; i++) sink += net.predict(data[i & 63].input);
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    const double intNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / kRuns;
+    const double floatNs = std::chrono::duration<double, std::nano>(t3 - t2).count() / (kRuns / 10);
+    char msg[128];
+    snprintf(msg, sizeof(msg), "int8 %.0f ns/inference (%u MACs, %.2f ns/MAC), float %.0f ns",
+             intNs, (unsigned)model.macs(), intNs / model.macs(), floatNs);
+    TEST_MESSAGE(msg);
+    (void)sink;
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_blob_loads);
+    RUN_TEST(test_kernel_matches_reference);
+    RUN_TEST(test_blob_accuracy);
+    RUN_TEST(test_int8_matches_float);
+    RUN_TEST(test_stream_detection);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,167 @@
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include "engine/GestureRecognizer.h"
+
+// Host tests for the gesture recognizer (pio test -e native)
+
+static const uint32_t kPeriodUs = 2000;  // 500 Hz
+
+static uint32_t lcgState = 1;
+static int noise(int amplitude) {
+    lcgState = lcgState * 1664525u + 1013904223u;
+    return (int32_t)(lcgState >> 16) % (2 * amplitude + 1) - amplitude;
+}
+
+struct Feed {
+    GestureRecognizer rec;
+    uint32_t tUs = 0;
+    std::vector<Gesture> events;
+
+    // Device lying at (tiltX, tiltY) with `linear` extra acceleration on X
+    void run(uint32_t ms, int32_t tiltX, int32_t tiltY, int32_t linear = 0, int16_t gravityZ = 16000) {
+        for (uint32_t i = 0; i < ms * 1000 / kPeriodUs; i++) {
+            const int16_t gravity[3] = { (int16_t)tiltX, (int16_t)tiltY, gravityZ };
+            const int16_t accel[3] = { (int16_t)(gravity[0] + linear + noise(150)),
+                                       (int16_t)(gravity[1] + noise(150)),
+                                       (int16_t)(gravity[2] + noise(150)) };
+            rec.update(tUs, tiltX + noise(60), tiltY + noise(60), accel, gravity);
+            tUs += kPeriodUs;
+            Gesture g;
+            while (rec.poll(g)) events.push_back(g);
+        }
+    }
+
+    int count(GestureType type) const {
+        int n = 0;
+        for (size_t i = 0; i < events.size(); i++) n += events[i].type == type;
+        return n;
+    }
+};
+
+void setUp(void) { lcgState = 1; }
+void tearDown(void) {}
+
+void test_tilt_and_hold(void) {
+    Feed f;
+    f.run(200, 0, 0);
+    TEST_ASSERT_EQUAL_INT(0, (int)f.events.size());
+
+    f.run(2500, 5000, 0);
+    TEST_ASSERT_EQUAL_INT(2, (int)f.events.size());
+    TEST_ASSERT_TRUE(f.events[0].type == GestureType::Tilt && f.events[0].dir == TiltDir::Right);
+    TEST_ASSERT_TRUE(f.events[1].type == GestureType::TiltHold && f.events[1].dir == TiltDir::Right);
+
+    f.run(3000, 5000, 0);  // Held longer: no repeat
+    TEST_ASSERT_EQUAL_INT(2, (int)f.events.size());
+
+    f.run(100, 0, 0);
+    TEST_ASSERT_TRUE(f.events.back().type == GestureType::Tilt && f.events.back().dir == TiltDir::None);
+
+    f.run(500, 0, -4000);
+    TEST_ASSERT_TRUE(f.events.back().type == GestureType::Tilt && f.events.back().dir == TiltDir::Up);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::TiltHold));  // 500 ms is not a hold
+}
+
+void test_hysteresis_stops_chatter(void) {
+    Feed f;
+    // Hovering around the enter threshold: one Tilt, no flapping back to level
+    for (int i = 0; i < 50; i++) {
+        f.run(40, 3200, 0);
+        f.run(40, 2600, 0);
+    }
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::Tilt));
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::TiltHold));
+
+    // Sliding diagonally: stays Right until Down is both entered and stronger
+    f.run(100, 3500, 3400);
+    TEST_ASSERT_TRUE(f.rec.tilt() == TiltDir::Right);
+    f.run(100, 3000, 4500);
+    TEST_ASSERT_TRUE(f.rec.tilt() == TiltDir::Down);
+}
+
+void test_shake(void) {
+    Feed f;
+    f.run(300, 0, 0);
+    // 6 Hz shake, +-0.6 g, tilt unaffected (fused gravity)
+    for (int i = 0; i < 500; i++) {
+        const int32_t linear = (int32_t)(9800 * sin(2 * 3.14159265 * 6.0 * i / 500));
+        f.run(2, 0, 0, linear);
+    }
+    TEST_ASSERT_TRUE(f.rec.shaking());
+    f.run(600, 0, 0);
+    TEST_ASSERT_FALSE(f.rec.shaking());
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::Shake));
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::ShakeEnd));
+    TEST_ASSERT_EQUAL_INT(0, f.count(GestureType::Tap));
+    TEST_ASSERT_EQUAL_INT(0, f.count(GestureType::Tilt));
+}
+
+void test_tap(void) {
+    Feed f;
+    f.run(300, 0, 0);
+    f.run(10, 0, 0, 12000);  // 10 ms knock
+    f.run(300, 0, 0);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::Tap));
+    f.run(1000, 0, 0);       // Out of the shake window
+
+    // A double knock and a long push are not taps
+    f.run(10, 0, 0, 12000);
+    f.run(60, 0, 0);
+    f.run(10, 0, 0, 12000);
+    f.run(300, 0, 0);
+    f.run(200, 0, 0, 9000);
+    f.run(300, 0, 0);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::Tap));
+    TEST_ASSERT_EQUAL_INT(0, f.count(GestureType::Shake));
+}
+
+void test_face_down(void) {
+    Feed f;
+    f.run(300, 0, 0, 0, -16000);
+    TEST_ASSERT_EQUAL_INT(0, f.count(GestureType::FaceDown));
+    f.run(300, 0, 0, 0, -16000);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::FaceDown));
+    f.run(300, 0, 0, 0, -10000);  // Between thresholds: still face down
+    TEST_ASSERT_TRUE(f.rec.faceDown());
+    f.run(20, 0, 0, 0, 16000);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::FaceUp));
+}
+
+void test_reset_reports_current_tilt(void) {
+    Feed f;
+    f.run(300, -5000, 0);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::Tilt));
+    f.rec.reset();
+    f.run(10, -5000, 0);
+    TEST_ASSERT_EQUAL_INT(2, f.count(GestureType::Tilt));
+    TEST_ASSERT_TRUE(f.events.back().dir == TiltDir::Left);
+}
+
+void test_reset_ends_shake_silently(void) {
+    Feed f;
+    f.run(300, 0, 0);
+    for (int i = 0; i < 500; i++) {
+        const int32_t linear = (int32_t)(9800 * sin(2 * 3.14159265 * 6.0 * i / 500));
+        f.run(2, 0, 0, linear);
+    }
+    TEST_ASSERT_TRUE(f.rec.shaking());
+    f.rec.reset();
+    TEST_ASSERT_FALSE(f.rec.shaking());
+    f.run(600, 0, 0);
+    TEST_ASSERT_EQUAL_INT(1, f.count(GestureType::Shake));
+    TEST_ASSERT_EQUAL_INT(0, f.count(GestureType::ShakeEnd));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_tilt_and_hold);
+    RUN_TEST(test_hysteresis_stops_chatter);
+    RUN_TEST(test_shake);
+    RUN_TEST(test_tap);
+    RUN_TEST(test_face_down);
+    RUN_TEST(test_reset_reports_current_tilt);
+    RUN_TEST(test_reset_ends_shake_silently);
+    return UNITY_END();
+}
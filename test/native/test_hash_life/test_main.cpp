@@ -0,0 +1,239 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "engine/HashLife.h"
+#include "engine/LifePatterns.h"
+#include "engine/FixedMath.h"
+
+// Host tests for the HashLife universe (pio test -e native)
+
+static const char* pattern(const char* name) {
+    for (int i = 0; i < kLifePatternCount; i++) {
+        if (strcmp(kLifePatterns[i].name, name) == 0) return kLifePatterns[i].rle;
+    }
+    return nullptr;
+}
+
+// Plain cell-by-cell Life on a dead-edged square around the origin
+struct NaiveUniverse {
+    static constexpr int kSize = 256;
+    LifeRule rule;
+    std::vector<uint8_t> cells = std::vector<uint8_t>(kSize * kSize, 0);
+
+    uint8_t& at(int x, int y) { return cells[(y + kSize / 2) * kSize + x + kSize / 2]; }
+    bool get(int x, int y) const {
+        x += kSize / 2;
+        y += kSize / 2;
+        return x >= 0 && x < kSize && y >= 0 && y < kSize && cells[y * kSize + x];
+    }
+
+    void step() {
+        std::vector<uint8_t> next(kSize * kSize, 0);
+        for (int y = -kSize / 2; y < kSize / 2; y++) {
+            for (int x = -kSize / 2; x < kSize / 2; x++) {
+                int n = 0;
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) n += (dx || dy) && get(x + dx, y + dy);
+                }
+                const uint16_t set = get(x, y) ? rule.survive : rule.birth;
+                next[(y + kSize / 2) * kSize + x + kSize / 2] = (set >> n) & 1;
+            }
+        }
+        cells.swap(next);
+    }
+};
+
+// Runs to `target` with the biggest power-of-two steps that fit
+static void advanceTo(HashLife& life, uint64_t target) {
+    while (life.generation() < target) {
+        int k = 0;
+        while (k < HashLife::kMaxStepLog2 && life.generation() + (2ull << k) <= target) k++;
+        life.setStepLog2(k);
+        TEST_ASSERT_TRUE(life.step());
+    }
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)target, (uint32_t)life.generation());
+}
+
+static HashLife life;
+
+void setUp(void) {
+    TEST_ASSERT_TRUE(life.begin(1u << 15));
+    life.setRule(LifeRule());
+    life.setStepLog2(0);
+}
+void tearDown(void) {
+    life.release();
+}
+
+void test_cells_rle_and_window(void) {
+    TEST_ASSERT_TRUE(life.loadRle("x = 3, y = 3, rule = B3/S23\nbo$2bo$3o!", -1, -1));
+    TEST_ASSERT_EQUAL_UINT32(5, life.population());
+    TEST_ASSERT_TRUE(life.cell(0, -1));
+    TEST_ASSERT_FALSE(life.cell(-1, -1));
+
+    uint32_t rows[4];
+    life.window(-2, -2, 5, 4, rows);
+    const uint32_t expect[4] = { 0x00, 0x04, 0x08, 0x0E };
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expect, rows, 4);
+
+    // Far corners of the universe, and beyond
+    TEST_ASSERT_TRUE(life.setCell(-(1 << 29), (1 << 29) - 1, true));
+    TEST_ASSERT_TRUE(life.cell(-(1 << 29), (1 << 29) - 1));
+    TEST_ASSERT_FALSE(life.setCell(1 << 29, 0, true));
+    TEST_ASSERT_EQUAL_UINT32(6, life.population());
+    TEST_ASSERT_TRUE(life.setCell(-(1 << 29), (1 << 29) - 1, false));
+    TEST_ASSERT_EQUAL_UINT32(5, life.population());
+
+    TEST_ASSERT_FALSE(life.loadRle("3q!", 0, 0));
+    LifeRule b0;
+    LifeRule::parse("B03/S23", b0);
+    TEST_ASSERT_FALSE(life.setRule(b0));
+}
+
+// Single generations against the reference, for Life and HighLife
+void test_matches_reference(void) {
+    const char* const rules[] = { "B3/S23", "B36/S23" };
+    for (int r = 0; r < 2; r++) {
+        life.clear();
+        NaiveUniverse ref;
+        LifeRule::parse(rules[r], ref.rule);
+        TEST_ASSERT_TRUE(life.setRule(ref.rule));
+        life.setStepLog2(0);
+        uint32_t s = 77 + r;
+        for (int y = -12; y < 12; y++) {
+            for (int x = -12; x < 12; x++) {
+                if (fixmath::xorshift32(s) % 3 == 0) {
+                    ref.at(x, y) = 1;
+                    life.setCell(x, y, true);
+                }
+            }
+        }
+        for (int gen = 1; gen <= 120; gen++) {
+            life.step();
+            ref.step();
+            if (gen % 10 != 0) continue;
+            for (int y = -100; y < 100; y++) {
+                uint32_t rows[1];
+                for (int x = -100; x < 100; x += 25) {
+                    life.window(x, y, 25, 1, rows);
+                    for (int i = 0; i < 25; i++) TEST_ASSERT_EQUAL(ref.get(x + i, y), (rows[0] >> i) & 1);
+                }
+            }
+        }
+    }
+}
+
+// Known lifetimes, reached with mixed power-of-two steps
+void test_known_patterns(void) {
+    life.loadRle(pattern("Diehard"), 0, 0);
+    advanceTo(life, 129);
+    TEST_ASSERT_TRUE(life.population() > 0);
+    advanceTo(life, 130);
+    TEST_ASSERT_EQUAL_UINT32(0, life.population());
+
+    life.clear();
+    life.loadRle(pattern("R-pentomino"), 0, 0);
+    advanceTo(life, 1103);
+    TEST_ASSERT_EQUAL_UINT32(116, life.population());
+
+    life.clear();
+    life.loadRle(pattern("Acorn"), 0, 0);
+    advanceTo(life, 5206);
+    TEST_ASSERT_EQUAL_UINT32(633, life.population());
+
+    life.clear();
+    life.loadRle(pattern("Infinite growth"), 0, 0);
+    advanceTo(life, 1000);
+    const uint32_t early = life.population();
+    advanceTo(life, 4000);
+    TEST_ASSERT_TRUE(life.population() > early + 200);
+}
+
+// One 2^10 step equals 1024 single steps
+void test_big_step_matches_single_steps(void) {
+    HashLife single;
+    TEST_ASSERT_TRUE(single.begin(1u << 15));
+    life.loadRle(pattern("Gosper gun"), -18, -5);
+    single.loadRle(pattern("Gosper gun"), -18, -5);
+    life.setStepLog2(10);
+    life.step();
+    for (int i = 0; i < 1024; i++) single.step();
+    TEST_ASSERT_EQUAL_UINT32(single.population(), life.population());
+    for (int y = -64; y < 64; y++) {
+        uint32_t a[1], b[1];
+        for (int x = -64; x < 448; x += 32) {
+            life.window(x, y, 32, 1, a);
+            single.window(x, y, 32, 1, b);
+            TEST_ASSERT_EQUAL_HEX32(b[0], a[0]);
+        }
+    }
+}
+
+// A device-sized pool has to collect and evict, but must not change the answer
+void test_small_pool(void) {
+    life.release();
+    TEST_ASSERT_TRUE(life.begin(4096));
+    life.loadRle(pattern("Acorn"), 0, 0);
+    advanceTo(life, 5206);
+    TEST_ASSERT_EQUAL_UINT32(633, life.population());
+    TEST_ASSERT_TRUE(life.stats().collections > 0);
+    TEST_ASSERT_TRUE(life.used() <= life.capacity());
+
+    // Far more than the pool holds in one step: it backs off to smaller steps
+    life.clear();
+    life.resetStats();
+    life.loadRle(pattern("Acorn"), 0, 0);
+    life.setStepLog2(13);
+    TEST_ASSERT_TRUE(life.step());
+    TEST_ASSERT_TRUE(life.stats().overflows > 0);
+    TEST_ASSERT_TRUE(life.stepLog2() < 13);
+    char msg[96];
+    snprintf(msg, sizeof(msg), "4096-node pool: acorn step 2^13 fell back to 2^%d (%u KB)", life.stepLog2(),
+             (unsigned)(life.bytes() / 1024));
+    TEST_MESSAGE(msg);
+}
+
+void test_benchmark(void) {
+    struct Run { const char* name; uint64_t generations; int stepLog2; uint32_t nodes; };
+    const Run runs[] = {
+        { "Acorn", 5206, 0, 4096 },
+        { "Acorn", 1u << 20, 10, 1u << 15 },
+        { "Gosper gun", 1u << 20, 12, 4096 },
+        { "Gosper gun", 1u << 28, 20, 1u << 15 },
+        { "Infinite growth", 1u << 16, 8, 4096 },
+    };
+    for (size_t i = 0; i < sizeof(runs) / sizeof(runs[0]); i++) {
+        const Run& run = runs[i];
+        life.release();
+        TEST_ASSERT_TRUE(life.begin(run.nodes));
+        life.setStepLog2(0);
+        life.loadRle(pattern(run.name), 0, 0);
+        life.setStepLog2(run.stepLog2);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        while (life.generation() < run.generations) TEST_ASSERT_TRUE(life.step());
+        auto t1 = std::chrono::high_resolution_clock::now();
+        const HashLife::Stats& st = life.stats();
+        char msg[200];
+        snprintf(msg, sizeof(msg),
+                 "%-15s %14llu gens, steps 2^%-2d %8.2f ms, pop %10u, result hits %4.1f%%, join hits %4.1f%%, "
+                 "%5u/%5u nodes (%u KB), %u evictions",
+                 run.name, (unsigned long long)run.generations, life.stepLog2(),
+                 std::chrono::duration<double, std::milli>(t1 - t0).count(), (unsigned)life.population(),
+                 100.0 * st.resultHits / (st.results ? st.results : 1), 100.0 * st.joinHits / (st.joins ? st.joins : 1),
+                 (unsigned)life.used(), (unsigned)life.capacity(), (unsigned)(life.bytes() / 1024),
+                 (unsigned)st.evictions);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_cells_rle_and_window);
+    RUN_TEST(test_matches_reference);
+    RUN_TEST(test_known_patterns);
+    RUN_TEST(test_big_step_matches_single_steps);
+    RUN_TEST(test_small_pool);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
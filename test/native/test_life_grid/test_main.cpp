@@ -0,0 +1,215 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "engine/LifeGrid.h"
+
+// Host tests for the bit-parallel Life engine (pio test -e native)
+
+static const char* const kRules[] = { "B3/S23", "B36/S23", "B2/S", "B3678/S34678" };
+
+// Cell-by-cell reference: count the eight neighbours one at a time
+struct NaiveLife {
+    int w, h;
+    bool torus;
+    LifeRule rule;
+    uint32_t rows[LifeGrid::kMaxRows];
+
+    bool cell(int x, int y) const {
+        if (torus) {
+            x = (x + w) % w;
+            y = (y + h) % h;
+        } else if (x < 0 || x >= w || y < 0 || y >= h) {
+            return false;
+        }
+        return (rows[y] >> x) & 1;
+    }
+
+    void step() {
+        uint32_t next[LifeGrid::kMaxRows] = {};
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                int n = 0;
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) n += (dx || dy) && cell(x + dx, y + dy);
+                }
+                const uint16_t set = cell(x, y) ? rule.survive : rule.birth;
+                if ((set >> n) & 1) next[y] |= 1u << x;
+            }
+        }
+        memcpy(rows, next, sizeof(next));
+    }
+};
+
+static void place(LifeGrid& grid, const char* const* pattern, int x0, int y0) {
+    for (int y = 0; pattern[y] != nullptr; y++) {
+        for (int x = 0; pattern[y][x] != '\0'; x++) {
+            if (pattern[y][x] == 'O') grid.rows()[y0 + y] |= 1u << (x0 + x);
+        }
+    }
+    grid.resetHistory();
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_parse_rules(void) {
+    LifeRule r;
+    TEST_ASSERT_TRUE(LifeRule::parse("B36/S23", r));
+    TEST_ASSERT_EQUAL_HEX16((1 << 3) | (1 << 6), r.birth);
+    TEST_ASSERT_EQUAL_HEX16((1 << 2) | (1 << 3), r.survive);
+    TEST_ASSERT_TRUE(LifeRule::parse("b2/s", r));
+    TEST_ASSERT_EQUAL_HEX16(1 << 2, r.birth);
+    TEST_ASSERT_EQUAL_HEX16(0, r.survive);
+    TEST_ASSERT_TRUE(LifeRule::parse("B3678/S34678", r));
+    TEST_ASSERT_EQUAL_HEX16(0x1C8, r.birth);
+
+    const LifeRule before = r;
+    TEST_ASSERT_FALSE(LifeRule::parse("B9/S23", r));
+    TEST_ASSERT_FALSE(LifeRule::parse("S23/B3", r));
+    TEST_ASSERT_FALSE(LifeRule::parse("B3/S23x", r));
+    TEST_ASSERT_FALSE(LifeRule::parse("B3", r));
+    TEST_ASSERT_EQUAL_HEX16(before.birth, r.birth);  // Failed parses leave it alone
+}
+
+// Every rule and edge mode, several board sizes, against the reference
+void test_matches_reference(void) {
+    const int sizes[][2] = { { 16, 10 }, { 32, 32 }, { 7, 5 }, { 3, 2 } };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t k = 0; k < sizeof(kRules) / sizeof(kRules[0]); k++) {
+            for (int torus = 0; torus < 2; torus++) {
+                LifeGrid grid(sizes[s][0], sizes[s][1]);
+                NaiveLife ref;
+                ref.w = sizes[s][0];
+                ref.h = sizes[s][1];
+                ref.torus = torus;
+                TEST_ASSERT_TRUE(LifeRule::parse(kRules[k], ref.rule));
+                grid.setRule(ref.rule);
+                grid.setTorus(torus);
+                grid.randomize(1234 + (uint32_t)k, 35);
+                memcpy(ref.rows, grid.rows(), sizeof(ref.rows));
+                for (int gen = 0; gen < 60; gen++) {
+                    grid.step();
+                    ref.step();
+                    TEST_ASSERT_EQUAL_HEX32_ARRAY(ref.rows, grid.rows(), ref.h);
+                }
+            }
+        }
+    }
+}
+
+void test_changed_only_when_board_changes(void) {
+    static const char* const block[] = { "OO", "OO", nullptr };
+    LifeGrid grid(16, 10);
+    place(grid, block, 4, 4);
+    TEST_ASSERT_FALSE(grid.step());  // Alive but static: the old mode called this "changed"
+    TEST_ASSERT_EQUAL_INT(1, grid.period());
+    TEST_ASSERT_EQUAL_UINT32(4, grid.population());
+
+    grid.clear();
+    TEST_ASSERT_FALSE(grid.step());
+    TEST_ASSERT_EQUAL_INT(1, grid.period());
+}
+
+void test_detects_oscillators(void) {
+    static const char* const blinker[] = { "OOO", nullptr };
+    LifeGrid grid(16, 10);
+    place(grid, blinker, 6, 4);
+    TEST_ASSERT_TRUE(grid.step());
+    TEST_ASSERT_EQUAL_INT(0, grid.period());
+    TEST_ASSERT_TRUE(grid.step());
+    TEST_ASSERT_EQUAL_INT(2, grid.period());
+
+    // A row of ten becomes the period-15 pentadecathlon, the longest the history covers
+    static const char* const penta[] = { "OOOOOOOOOO", nullptr };
+    LifeGrid big(32, 32);
+    place(big, penta, 11, 16);
+    for (int i = 0; i < 40 && big.period() == 0; i++) big.step();
+    TEST_ASSERT_EQUAL_INT(15, big.period());
+    TEST_ASSERT_TRUE(big.generation() <= 20);
+}
+
+void test_glider_edges(void) {
+    static const char* const glider[] = { ".O.", "..O", "OOO", nullptr };
+
+    // Torus: the glider travels forever, never repeating within the history
+    LifeGrid torus(16, 10);
+    place(torus, glider, 0, 0);
+    for (int i = 0; i < 200; i++) {
+        torus.step();
+        TEST_ASSERT_EQUAL_UINT32(5, torus.population());
+    }
+    TEST_ASSERT_EQUAL_INT(0, torus.period());
+
+    // Bounded: it crashes into the corner and settles into a block
+    LifeGrid bounded(16, 10);
+    bounded.setTorus(false);
+    place(bounded, glider, 0, 0);
+    for (int i = 0; i < 100 && bounded.period() == 0; i++) bounded.step();
+    TEST_ASSERT_EQUAL_INT(1, bounded.period());
+    TEST_ASSERT_EQUAL_UINT32(4, bounded.population());
+}
+
+void test_highlife_replicator(void) {
+    // HighLife's replicator copies itself every 12 generations; plain Life does not
+    static const char* const replicator[] = { "..OOO", ".O..O", "O...O", "O..O.", "OOO..", nullptr };
+    LifeRule high, conway;
+    LifeRule::parse("B36/S23", high);
+    LifeRule::parse("B3/S23", conway);
+    LifeGrid a(32, 32), b(32, 32);
+    a.setRule(high);
+    b.setRule(conway);
+    a.setTorus(false);
+    b.setTorus(false);
+    place(a, replicator, 13, 13);
+    place(b, replicator, 13, 13);
+    for (int i = 0; i < 12; i++) {
+        a.step();
+        b.step();
+    }
+    TEST_ASSERT_EQUAL_UINT32(24, a.population());  // Two copies after one period
+    TEST_ASSERT_TRUE(a.hash() != b.hash());
+}
+
+void test_benchmark(void) {
+    LifeGrid grid(16, 10);
+    grid.randomize(99, 30);
+    NaiveLife ref;
+    ref.w = 16;
+    ref.h = 10;
+    ref.torus = true;
+    memcpy(ref.rows, grid.rows(), sizeof(ref.rows));
+
+    const int kGens = 200000;
+    volatile uint32_t sink = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kGens; i++) {
+        if (!grid.step() || grid.period() != 0) grid.randomize(i, 30);
+        sink += grid.rows()[3];
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kGens / 100; i++) {
+        ref.step();
+        sink += ref.rows[3];
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    const double swarNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / kGens;
+    const double naiveNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / (kGens / 100);
+    char msg[96];
+    snprintf(msg, sizeof(msg), "16x10 generation: %.0f ns bit-parallel, %.0f ns cell by cell", swarNs, naiveNs);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(swarNs * 10 < naiveNs);
+    (void)sink;
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_rules);
+    RUN_TEST(test_matches_reference);
+    RUN_TEST(test_changed_only_when_board_changes);
+    RUN_TEST(test_detects_oscillators);
+    RUN_TEST(test_glider_edges);
+    RUN_TEST(test_highlife_replicator);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,198 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "engine/Noise.h"
+
+// Host tests for the noise and dithering library (pio test -e native)
+
+static const int kWidth = 10, kHeight = 16, kStride = 2;
+
+static bool lit(const uint8_t* buffer, int x, int y) { return buffer[y * kStride + x / 8] & (0x80 >> (x & 7)); }
+
+// Pixels a 4x4 Bayer tile lights at a level: thresholds are 8, 24, ... 248
+static int bayerCount(int level) { return level < 8 ? 0 : (level - 8) / 16 + 1; }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Lattice points carry the hashed value; in between it blends smoothly
+void test_value_noise(void) {
+    for (int j = -3; j < 3; j++) {
+        for (int i = -3; i < 3; i++) {
+            TEST_ASSERT_EQUAL_INT(noise::detail::hash(i, j) * 2 - 255, noise::value(i * 256, j * 256));
+        }
+    }
+    int worst = 0;
+    for (int y = -1000; y < 1000; y += 5) {
+        for (int x = -1000; x < 1000; x++) {
+            const int v = noise::value(x, y);
+            TEST_ASSERT_TRUE(v >= -255 && v <= 255);
+            const int step = abs(noise::value(x + 1, y) - v);
+            if (step > worst) worst = step;
+        }
+    }
+    // Smoothstep peaks at 1.5x the linear slope: at most 510 * 1.5 / 256 per Q8 unit
+    TEST_ASSERT_TRUE(worst <= 4);
+}
+
+// Simplex stays within +-1.0, averages near zero, uses its range and has no seams
+void test_simplex_noise(void) {
+    int lo = 0, hi = 0, worst = 0;
+    int64_t sum = 0, count = 0;
+    for (int y = -6000; y < 6000; y += 7) {
+        for (int x = -6000; x < 6000; x += 3) {
+            const int v = noise::simplex(x, y);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+            sum += v;
+            count++;
+            const int step = abs(noise::simplex(x + 1, y) - v);
+            if (step > worst) worst = step;
+        }
+    }
+    TEST_ASSERT_TRUE(lo >= -256 && hi <= 256);
+    TEST_ASSERT_TRUE(lo < -200 && hi > 200);
+    TEST_ASSERT_INT_WITHIN(16, 0, (int)(sum / count));
+    TEST_ASSERT_TRUE(worst <= 24);  // A seam between simplices would jump by far more
+    TEST_ASSERT_EQUAL_INT(noise::simplex(12345, -678), noise::simplex(12345, -678));
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "simplex range %d..%d, mean %d, steepest %d per 1/256 cell", lo, hi,
+             (int)(sum / count), worst);
+    TEST_MESSAGE(msg);
+
+    for (int y = -2000; y < 2000; y += 13) {
+        for (int x = -2000; x < 2000; x += 11) {
+            const int v = noise::fbm(x, y, 3);
+            TEST_ASSERT_TRUE(v >= -256 && v <= 256);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(noise::simplex(300, 700), noise::fbm(300, 700, 1));
+}
+
+void test_plasma_levels(void) {
+    TEST_ASSERT_EQUAL_UINT8(128, noise::plasma(0, 0, 0, 0));
+    TEST_ASSERT_EQUAL_UINT8(255, noise::plasma(16384, 16384, 16384, 16384));
+    TEST_ASSERT_EQUAL_UINT8(0, noise::plasma(49152, 49152, 49152, 49152));
+    TEST_ASSERT_EQUAL_UINT8(0, noise::toLevel(-256));
+    TEST_ASSERT_EQUAL_UINT8(128, noise::toLevel(0));
+    TEST_ASSERT_EQUAL_UINT8(255, noise::toLevel(900));
+}
+
+// Every 4x4 tile of a flat level lights the Bayer share of its pixels, and
+// the temporal pattern gives each pixel that share over 16 frames
+void test_dither(void) {
+    uint8_t levels[kWidth * kHeight];
+    uint8_t buffer[kHeight * kStride];
+    for (int level = 0; level < 256; level++) {
+        memset(levels, level, sizeof(levels));
+
+        noise::dither(levels, kWidth, kHeight, noise::Dither::Threshold, 0, buffer);
+        TEST_ASSERT_EQUAL(level >= 128, lit(buffer, 3, 5));
+
+        noise::dither(levels, kWidth, kHeight, noise::Dither::Bayer, 0, buffer);
+        for (int ty = 0; ty < 16; ty += 4) {
+            for (int tx = 0; tx < 8; tx += 4) {
+                int n = 0;
+                for (int y = ty; y < ty + 4; y++) {
+                    for (int x = tx; x < tx + 4; x++) n += lit(buffer, x, y);
+                }
+                TEST_ASSERT_EQUAL_INT(bayerCount(level), n);
+            }
+        }
+
+        int on[kHeight][kWidth] = {};
+        for (int frame = 0; frame < 16; frame++) {
+            memset(buffer, 0xFF, sizeof(buffer));
+            noise::dither(levels, kWidth, kHeight, noise::Dither::Temporal, (uint8_t)frame, buffer);
+            for (int y = 0; y < kHeight; y++) {
+                TEST_ASSERT_EQUAL_HEX16(0, buffer[y * kStride + 1] & 0x3F);  // Past column 9
+                for (int x = 0; x < kWidth; x++) on[y][x] += lit(buffer, x, y);
+            }
+        }
+        for (int y = 0; y < kHeight; y++) {
+            for (int x = 0; x < kWidth; x++) TEST_ASSERT_EQUAL_INT(bayerCount(level), on[y][x]);
+        }
+    }
+}
+
+// The three modes' frames (levels for 160 pixels, then dithering), as the modes compute them
+static void plasmaFrame(uint32_t frame, uint8_t* levels) {
+    static uint16_t ring[16][10];
+    static bool ready = false;
+    if (!ready) {
+        for (int y = 0; y < kHeight; y++) {
+            for (int x = 0; x < kWidth; x++) {
+                const int32_t distance = (int32_t)fixmath::isqrt((uint32_t)(x * x + y * y) << 16);
+                ring[y][x] = (uint16_t)((distance * fixmath::angleFromRadians(0.2)) >> 8);
+            }
+        }
+        ready = true;
+    }
+    const int32_t half = fixmath::angleFromRadians(0.5);
+    const uint16_t time = (uint16_t)(frame * fixmath::angleFromRadians(0.1));
+    for (int y = 0; y < kHeight; y++) {
+        for (int x = 0; x < kWidth; x++) {
+            levels[y * kWidth + x] = noise::plasma((uint16_t)(x * half + time), (uint16_t)(y * half + time),
+                                                   (uint16_t)((x + y) * half + time), (uint16_t)(ring[y][x] + time));
+        }
+    }
+}
+
+static void lavaFrame(uint32_t frame, uint8_t* levels) {
+    for (int y = 0; y < kHeight; y++) {
+        const int32_t sway = noise::value(y * 48, (int32_t)frame * 2) / 2;
+        for (int x = 0; x < kWidth; x++) {
+            levels[y * kWidth + x] = noise::toLevel(noise::simplex(x * 80 + sway, y * 80 + (int32_t)frame * 5) * 3);
+        }
+    }
+}
+
+static void cloudsFrame(uint32_t frame, uint8_t* levels) {
+    const int32_t drift = (int32_t)frame * 3;
+    for (int y = 0; y < kHeight; y++) {
+        for (int x = 0; x < kWidth; x++) {
+            levels[y * kWidth + x] = noise::toLevel(noise::fbm(x * 56 + drift, y * 56 + drift / 4, 3) * 2 - 48);
+        }
+    }
+}
+
+void test_benchmark(void) {
+    struct Row { const char* name; void (*fill)(uint32_t, uint8_t*); noise::Dither dither; };
+    const Row rows[] = {
+        { "Plasma", plasmaFrame, noise::Dither::Bayer },
+        { "Lava Lamp", lavaFrame, noise::Dither::Bayer },
+        { "Clouds", cloudsFrame, noise::Dither::Temporal },
+    };
+    uint8_t levels[kWidth * kHeight];
+    uint8_t buffer[kHeight * kStride];
+    volatile int sink = 0;
+    const int frames = 20000;
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            rows[i].fill((uint32_t)frame, levels);
+            noise::dither(levels, kWidth, kHeight, rows[i].dither, (uint8_t)frame, buffer);
+            sink += buffer[frame & 31];
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / frames;
+        char msg[96];
+        snprintf(msg, sizeof(msg), "%-10s %6.0f ns per 160-pixel frame on the host", rows[i].name, ns);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_TRUE(ns < 1e6);
+    }
+    (void)sink;
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_value_noise);
+    RUN_TEST(test_simplex_noise);
+    RUN_TEST(test_plasma_levels);
+    RUN_TEST(test_dither);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,287 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "engine/OrientationFilter.h"
+
+// Host tests for the fixed-point gyro/accel fusion (pio test -e native)
+
+static const int kRateHz = 500;
+static const double kPi = 3.14159265358979;
+static const double kLsbPerRad = 131.0 * 180.0 / kPi;
+
+static uint32_t lcgState = 1;
+static int noise(int amplitude) {
+    lcgState = lcgState * 1664525u + 1013904223u;
+    return (int32_t)(lcgState >> 16) % (2 * amplitude + 1) - amplitude;
+}
+
+static int16_t clamp16(double v) {
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return (int16_t)lround(v);
+}
+
+// One IMU sample plus the true gravity direction it was generated from
+struct TraceSample {
+    int16_t ax, ay, az, gx, gy, gz;
+    double truth[3];
+    bool shaking;
+};
+
+// Motion script in body rates (rad/s); shake adds non-gravity acceleration
+struct Segment {
+    double seconds;
+    double wx, wy, wz;
+    double shakeG;
+};
+
+// Synthesizes a sensor trace: exact gravity propagation (Rodrigues), then
+// quantized gyro/accel readings with offset and noise as the MPU6050 gives them.
+static std::vector<TraceSample> makeTrace(const Segment* segs, int count, const double gyroOffset[3]) {
+    std::vector<TraceSample> trace;
+    double g[3] = { 0, 0, 1 };
+    const double dt = 1.0 / kRateHz;
+    for (int s = 0; s < count; s++) {
+        const int n = (int)(segs[s].seconds * kRateHz);
+        for (int i = 0; i < n; i++) {
+            const double w[3] = { segs[s].wx, segs[s].wy, segs[s].wz };
+            // Body sees gravity rotate by -w: g(t+dt) = R(-w dt) g
+            const double wn = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+            if (wn > 0) {
+                const double k[3] = { -w[0] / wn, -w[1] / wn, -w[2] / wn };
+                const double th = wn * dt, c = cos(th), sn = sin(th);
+                const double kxg[3] = { k[1] * g[2] - k[2] * g[1], k[2] * g[0] - k[0] * g[2], k[0] * g[1] - k[1] * g[0] };
+                const double kdg = k[0] * g[0] + k[1] * g[1] + k[2] * g[2];
+                for (int a = 0; a < 3; a++) g[a] = g[a] * c + kxg[a] * sn + k[a] * kdg * (1 - c);
+            }
+            TraceSample t;
+            double lin[3] = { 0, 0, 0 };
+            if (segs[s].shakeG > 0) {
+                const double phase = 2 * kPi * 6.0 * i / kRateHz;  // 6 Hz shake
+                lin[0] = segs[s].shakeG * sin(phase);
+                lin[1] = 0.5 * segs[s].shakeG * cos(phase);
+            }
+            t.ax = clamp16((g[0] + lin[0]) * 16384 + noise(120));
+            t.ay = clamp16((g[1] + lin[1]) * 16384 + noise(120));
+            t.az = clamp16((g[2] + lin[2]) * 16384 + noise(120));
+            t.gx = clamp16(w[0] * kLsbPerRad + gyroOffset[0] + noise(20));
+            t.gy = clamp16(w[1] * kLsbPerRad + gyroOffset[1] + noise(20));
+            t.gz = clamp16(w[2] * kLsbPerRad + gyroOffset[2] + noise(20));
+            for (int a = 0; a < 3; a++) t.truth[a] = g[a];
+            t.shaking = segs[s].shakeG > 0;
+            trace.push_back(t);
+        }
+    }
+    return trace;
+}
+
+// Same complementary filter and accel gating in double, without the integral term
+struct FloatReference {
+    double g[3] = { 0, 0, 1 };
+    double k;
+    int calm = 0;
+    explicit FloatReference(double timeConstantS) : k(1.0 / (kRateHz * timeConstantS)) {}
+    void update(const TraceSample& t) {
+        const double th[3] = { t.gx / kLsbPerRad / kRateHz, t.gy / kLsbPerRad / kRateHz, t.gz / kLsbPerRad / kRateHz };
+        const double x = g[0], y = g[1], z = g[2];
+        g[0] = x + y * th[2] - z * th[1];
+        g[1] = y + z * th[0] - x * th[2];
+        g[2] = z + x * th[1] - y * th[0];
+        const double a[3] = { t.ax / 16384.0, t.ay / 16384.0, t.az / 16384.0 };
+        const double off = fabs(a[0] * a[0] + a[1] * a[1] + a[2] * a[2] - 1.0);
+        const double window = 256.0 * 65536 / (1 << 26);
+        calm = off < window ? calm + 1 : 0;
+        if (calm >= kRateHz / 50) {
+            const double gain = k * (1.0 - off / window);
+            for (int i = 0; i < 3; i++) g[i] += (a[i] - g[i]) * gain;
+        }
+        const double n = sqrt(g[0] * g[0] + g[1] * g[1] + g[2] * g[2]);
+        for (int i = 0; i < 3; i++) g[i] /= n;
+    }
+};
+
+static double angleDeg(const double a[3], const double b[3]) {
+    const double d = (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) /
+                     (sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]) * sqrt(b[0] * b[0] + b[1] * b[1] + b[2] * b[2]));
+    return acos(d > 1 ? 1 : (d < -1 ? -1 : d)) * 180.0 / kPi;
+}
+
+static double fusedErrorDeg(const OrientationFilter& f, const double truth[3]) {
+    const double est[3] = { (double)f.gravity(0), (double)f.gravity(1), (double)f.gravity(2) };
+    return angleDeg(est, truth);
+}
+
+static const Segment kTiltScript[] = {
+    { 1.0, 0, 0, 0, 0 },
+    { 1.5, 0.6, 0, 0, 0 },      // roll over ~50 deg
+    { 1.0, 0, -0.9, 0, 0 },     // pitch
+    { 2.0, 0, 0, 1.5, 0 },      // yaw while tilted
+    { 1.0, -1.2, 0.5, 0, 0 },
+    { 2.0, 0, 0, 0, 0 },
+};
+
+void setUp(void) { lcgState = 1; }
+void tearDown(void) {}
+
+void test_matches_float_reference(void) {
+    const double offset[3] = { 0, 0, 0 };
+    const std::vector<TraceSample> trace = makeTrace(kTiltScript, 6, offset);
+    OrientationFilter fused(kRateHz, 500);
+    FloatReference ref(0.5);
+    fused.reset(trace[0].ax, trace[0].ay, trace[0].az);
+    double worst = 0;
+    for (size_t i = 0; i < trace.size(); i++) {
+        const TraceSample& t = trace[i];
+        fused.update(t.ax, t.ay, t.az, t.gx, t.gy, t.gz);
+        ref.update(t);
+        const double d = fusedErrorDeg(fused, ref.g);
+        if (d > worst) worst = d;
+    }
+    char msg[96];
+    snprintf(msg, sizeof(msg), "worst fixed vs float: %.3f deg over %d samples", worst, (int)trace.size());
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(worst < 0.5);
+}
+
+void test_tracks_truth_while_moving(void) {
+    const double offset[3] = { 0, 0, 0 };
+    const std::vector<TraceSample> trace = makeTrace(kTiltScript, 6, offset);
+    OrientationFilter fused(kRateHz, 500);
+    fused.reset(trace[0].ax, trace[0].ay, trace[0].az);
+    for (size_t i = 0; i < trace.size(); i++) {
+        const TraceSample& t = trace[i];
+        fused.update(t.ax, t.ay, t.az, t.gx, t.gy, t.gz);
+        TEST_ASSERT_TRUE(fusedErrorDeg(fused, t.truth) < 2.0);
+    }
+}
+
+void test_rejects_shake(void) {
+    const Segment script[] = {
+        { 1.0, 0, 0, 0, 0 },
+        { 0.2, 0.8, 0, 0, 0 },      // lean ~9 deg
+        { 1.5, 0, 0, 0, 0.9 },      // shaken hard, held at the same lean
+        { 0.5, 0, 0, 0, 0 },
+    };
+    const double offset[3] = { 0, 0, 0 };
+    const std::vector<TraceSample> trace = makeTrace(script, 4, offset);
+    OrientationFilter fused(kRateHz, 500);
+    fused.reset(trace[0].ax, trace[0].ay, trace[0].az);
+    double worstFused = 0, worstRaw = 0;
+    for (size_t i = 0; i < trace.size(); i++) {
+        const TraceSample& t = trace[i];
+        fused.update(t.ax, t.ay, t.az, t.gx, t.gy, t.gz);
+        if (!t.shaking) continue;
+        const double raw[3] = { (double)t.ax, (double)t.ay, (double)t.az };
+        worstFused = fmax(worstFused, fusedErrorDeg(fused, t.truth));
+        worstRaw = fmax(worstRaw, angleDeg(raw, t.truth));
+    }
+    char msg[96];
+    snprintf(msg, sizeof(msg), "during shake: fused %.2f deg, raw accel %.2f deg", worstFused, worstRaw);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(worstRaw > 20.0);
+    TEST_ASSERT_TRUE(worstFused < 3.0);
+}
+
+void test_learns_gyro_offset(void) {
+    // 4 deg/s of uncorrected offset on every axis, device held still then turned
+    const Segment script[] = {
+        { 30.0, 0, 0, 0, 0 },
+        { 1.0, 0.7, 0.3, 0, 0 },
+        { 5.0, 0, 0, 0, 0 },
+    };
+    const double offset[3] = { 524, -524, 524 };
+    const std::vector<TraceSample> trace = makeTrace(script, 3, offset);
+    OrientationFilter fused(kRateHz, 500);
+    fused.reset(trace[0].ax, trace[0].ay, trace[0].az);
+    for (size_t i = 0; i < trace.size(); i++) {
+        const TraceSample& t = trace[i];
+        fused.update(t.ax, t.ay, t.az, t.gx, t.gy, t.gz);
+        if (i == (size_t)(30 * kRateHz) - 1) {
+            // Offset about the gravity axis (z when flat) is unobservable; x and y are
+            TEST_ASSERT_INT_WITHIN(40, -524, fused.gyroBias(0));
+            TEST_ASSERT_INT_WITHIN(40, 524, fused.gyroBias(1));
+        }
+        if (i > (size_t)(30 * kRateHz)) TEST_ASSERT_TRUE(fusedErrorDeg(fused, t.truth) < 2.0);
+    }
+    // Tilted, part of the z offset becomes observable and is still being learned
+    char msg[64];
+    snprintf(msg, sizeof(msg), "settled error %.3f deg", fusedErrorDeg(fused, trace.back().truth));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(fusedErrorDeg(fused, trace.back().truth) < 1.0);
+}
+
+void test_angles(void) {
+    OrientationFilter f(kRateHz, 500);
+    f.reset(0, 0, 16384);
+    TEST_ASSERT_INT_WITHIN(50, 0, f.roll());
+    TEST_ASSERT_INT_WITHIN(50, 0, f.pitch());
+    f.reset(0, 16384, 0);  // rolled 90 deg
+    TEST_ASSERT_INT_WITHIN(50, 16384, f.roll());
+    f.reset(-11585, 0, 11585);  // pitched 45 deg nose up
+    TEST_ASSERT_INT_WITHIN(50, 8192, f.pitch());
+    TEST_ASSERT_INT_WITHIN(5, 4500, OrientationFilter::toCentiDegrees(f.pitch()));
+
+    // atan2 against libm over the circle
+    int worst = 0;
+    for (int deg10 = -1800; deg10 < 1800; deg10 += 7) {
+        const double r = deg10 * kPi / 1800.0;
+        const int32_t y = (int32_t)lround(sin(r) * 16384), x = (int32_t)lround(cos(r) * 16384);
+        int d = OrientationFilter::atan2(y, x) - (int)lround(atan2((double)y, (double)x) * 32768 / kPi);
+        if (d > 32768) d -= 65536;
+        if (d < -32768) d += 65536;
+        if (abs(d) > worst) worst = abs(d);
+    }
+    TEST_ASSERT_TRUE(worst <= 50);  // ~0.27 deg
+
+    for (uint32_t v = 0; v < 200000; v += 37) {
+        const uint32_t r = OrientationFilter::isqrt(v);
+        TEST_ASSERT_TRUE(r * r <= v && (r + 1) * (r + 1) > v);
+    }
+}
+
+// Cost of one update (rotate, correct, normalize, roll/pitch) on this host.
+// The device figure is in the "orient" stats source (CPU cycles per sample).
+void test_benchmark_per_sample(void) {
+    const double offset[3] = { 30, -12, 5 };
+    const std::vector<TraceSample> trace = makeTrace(kTiltScript, 6, offset);
+    const int kSamples = 2000000;
+    const size_t n = trace.size();
+
+    OrientationFilter fused(kRateHz, 500);
+    int32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSamples; i++) {
+        const TraceSample& t = trace[i % n];
+        fused.update(t.ax, t.ay, t.az, t.gx, t.gy, t.gz);
+        sink += fused.roll();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    FloatReference ref(0.5);
+    auto t2 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSamples; i++) {
+        ref.update(trace[i % n]);
+    }
+    auto t3 = std::chrono::steady_clock::now();
+
+    const double fixedNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / kSamples;
+    const double floatNs = std::chrono::duration<double, std::nano>(t3 - t2).count() / kSamples;
+    char msg[160];
+    snprintf(msg, sizeof(msg), "fixed-point %.2f ns/sample, double reference %.2f ns/sample (no angles) [%g %d]",
+             fixedNs, floatNs, ref.g[0], (int)(sink & 1));
+    TEST_MESSAGE(msg);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_float_reference);
+    RUN_TEST(test_tracks_truth_while_moving);
+    RUN_TEST(test_rejects_shake);
+    RUN_TEST(test_learns_gyro_offset);
+    RUN_TEST(test_angles);
+    RUN_TEST(test_benchmark_per_sample);
+    return UNITY_END();
+}
@@ -0,0 +1,244 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "engine/Particles.h"
+
+// Host tests for the particle system (pio test -e native)
+
+static const int kWidth = 10, kHeight = 16;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Slots come off the free list lowest first and freed slots are reused first
+void test_free_list(void) {
+    ParticleSystem<8> p;
+    for (int i = 0; i < 8; i++) TEST_ASSERT_EQUAL_INT(i, p.spawn(0, 0, 0, 0));
+    TEST_ASSERT_EQUAL_INT(-1, p.spawn(0, 0, 0, 0));
+    TEST_ASSERT_EQUAL_INT(8, p.count());
+
+    p.kill(3);
+    p.kill(3);  // Twice is harmless
+    TEST_ASSERT_EQUAL_INT(7, p.count());
+    TEST_ASSERT_EQUAL_INT(3, p.spawn(0, 0, 0, 0));
+
+    // The live list stays packed: the update only visits live particles
+    for (int i = 7; i >= 2; i--) p.kill(i);
+    TEST_ASSERT_EQUAL_INT(2, p.count());
+    TEST_ASSERT_TRUE((p.slot(0) == 0 && p.slot(1) == 1) || (p.slot(0) == 1 && p.slot(1) == 0));
+    TEST_ASSERT_EQUAL_INT(2, p.step());
+
+    // Killing while walking backwards visits every particle once
+    for (int i = 0; i < 6; i++) p.spawn(0, 0, 0, 0);
+    int visited = 0;
+    for (int k = p.count() - 1; k >= 0; k--) {
+        visited++;
+        if (p.slot(k) % 2) p.kill(p.slot(k));
+    }
+    TEST_ASSERT_EQUAL_INT(8, visited);
+    TEST_ASSERT_EQUAL_INT(4, p.count());
+    for (int k = 0; k < p.count(); k++) TEST_ASSERT_EQUAL_INT(0, p.slot(k) % 2);
+
+    p.clear();
+    TEST_ASSERT_EQUAL_INT(0, p.count());
+    TEST_ASSERT_EQUAL_INT(0, p.spawn(0, 0, 0, 0));
+}
+
+// Gravity, then drag, then the move; lifetimes run down to a free slot
+void test_motion_and_life(void) {
+    ParticleSystem<4> p;
+    p.setGravity(0, 32);
+    const int a = p.spawn(256, 0, 128, 0, 3);
+    p.step();
+    TEST_ASSERT_EQUAL_INT(384, p.x(a));
+    TEST_ASSERT_EQUAL_INT(32, p.y(a));
+    p.step();
+    TEST_ASSERT_EQUAL_INT(96, p.y(a));
+    TEST_ASSERT_EQUAL_INT(64, p.vy(a));
+    TEST_ASSERT_TRUE(p.alive(a));
+    p.step();
+    TEST_ASSERT_FALSE(p.alive(a));
+
+    // Drag scales symmetrically: both signs slow (or grow) alike
+    ParticleSystem<4> d;
+    d.setDrag(192);
+    const int r = d.spawn(0, 0, 100, 0), l = d.spawn(0, 0, -100, 0);
+    d.step();
+    TEST_ASSERT_EQUAL_INT(75, d.vx(r));
+    TEST_ASSERT_EQUAL_INT(-75, d.vx(l));
+    d.setDrag(272);
+    d.step();
+    TEST_ASSERT_EQUAL_INT(80, d.vx(r));
+    TEST_ASSERT_EQUAL_INT(-80, d.vx(l));
+
+    // Forever never runs down
+    ParticleSystem<2> f;
+    const int s = f.spawn(0, 0, 0, 0);
+    for (int i = 0; i < 1000; i++) f.step();
+    TEST_ASSERT_TRUE(f.alive(s));
+}
+
+void test_bounds(void) {
+    ParticleSystem<4> p;
+    p.setBounds(kWidth, kHeight, 1);
+    const int a = p.spawn(9 * 256, 0, 256, 0);  // Off the right edge after two steps
+    const int b = p.spawn(0, 0, 0, -200);       // Off the top after two steps
+    p.step();
+    TEST_ASSERT_TRUE(p.alive(a) && p.alive(b));
+    p.step();
+    TEST_ASSERT_FALSE(p.alive(a));
+    TEST_ASSERT_FALSE(p.alive(b));
+}
+
+// Bursts honour the emitter's ranges; streams carry fractional rates
+void test_emitters(void) {
+    ParticleSystem<64> p;
+    ParticleSystem<64>::Emitter e;
+    e.x = 1280;
+    e.y = 2048;
+    e.spreadX = 256;
+    e.angleRange = 65535;
+    e.speedMin = 128;
+    e.speedMax = 384;
+    e.lifeMin = 10;
+    e.lifeMax = 20;
+    TEST_ASSERT_EQUAL_INT(40, p.burst(e, 40));
+    for (int k = 0; k < p.count(); k++) {
+        const int i = p.slot(k);
+        TEST_ASSERT_TRUE(p.x(i) >= 1280 && p.x(i) < 1536);
+        TEST_ASSERT_EQUAL_INT(2048, p.y(i));
+        TEST_ASSERT_TRUE(p.life(i) >= 10 && p.life(i) <= 20);
+        const int speed2 = p.vx(i) * p.vx(i) + p.vy(i) * p.vy(i);
+        TEST_ASSERT_TRUE(speed2 >= 126 * 126 && speed2 <= 386 * 386);
+    }
+    TEST_ASSERT_EQUAL_INT(24, p.burst(e, 40));  // Only 24 slots left
+
+    ParticleSystem<64> q;
+    ParticleSystem<64>::Emitter rain;
+    rain.rateQ8 = 77;  // 0.3 per step
+    int made = 0;
+    for (int i = 0; i < 100; i++) made += q.stream(rain);
+    TEST_ASSERT_EQUAL_INT(30, made);
+}
+
+// Row words: leftmost pixel in the top bit; trails add the previous pixel
+void test_raster(void) {
+    ParticleSystem<8> p;
+    p.spawn(0, 0, 0, 0);
+    p.spawn(9 * 256 + 200, 15 * 256 + 100, 0, 0);
+    p.spawn(-10, 3 * 256, 0, 0);      // Left of the panel
+    p.spawn(4 * 256, 16 * 256, 0, 0); // Below it
+    const int moving = p.spawn(5 * 256, 5 * 256, 0, 256);
+    p.step();
+
+    uint16_t rows[kHeight] = {};
+    p.raster(rows, kWidth, kHeight);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, rows[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0040, rows[15]);
+    TEST_ASSERT_EQUAL_HEX16(0x0400, rows[6]);
+    TEST_ASSERT_EQUAL_HEX16(0, rows[3]);
+    TEST_ASSERT_EQUAL_HEX16(0, rows[5]);
+
+    uint16_t trails[kHeight] = {};
+    p.raster(trails, kWidth, kHeight, true);
+    TEST_ASSERT_EQUAL_HEX16(0x0400, trails[5]);
+    TEST_ASSERT_EQUAL_HEX16(0x0400, trails[6]);
+    (void)moving;
+}
+
+// The loop the modes used to run: an array of structs with float physics
+// and a linear scan for free slots
+struct OldSpark {
+    float x, y, vx, vy;
+    int life;
+};
+
+static int oldFrame(OldSpark* sparks, int n, int spawn, uint16_t* rows) {
+    for (int s = 0; s < spawn; s++) {
+        for (int i = 0; i < n; i++) {
+            if (sparks[i].life > 0) continue;
+            sparks[i].x = 5;
+            sparks[i].y = 8;
+            sparks[i].vx = (rand() % 200 - 100) / 100.0f;
+            sparks[i].vy = (rand() % 200 - 100) / 100.0f;
+            sparks[i].life = 10 + rand() % 16;
+            break;
+        }
+    }
+    int updated = 0;
+    for (int i = 0; i < n; i++) {
+        if (sparks[i].life <= 0) continue;
+        sparks[i].vy += 0.2f;
+        sparks[i].vx *= 0.95f;
+        sparks[i].vy *= 0.95f;
+        sparks[i].x += sparks[i].vx;
+        sparks[i].y += sparks[i].vy;
+        sparks[i].life--;
+        updated++;
+        const int px = (int)sparks[i].x, py = (int)sparks[i].y;
+        if (px >= 0 && px < kWidth && py >= 0 && py < kHeight) rows[py] |= (uint16_t)(0x8000u >> px);
+    }
+    return updated;
+}
+
+template <int N> static int newFrame(ParticleSystem<N>& p, typename ParticleSystem<N>::Emitter& e, uint16_t* rows) {
+    p.stream(e);
+    const int updated = p.step();
+    p.raster(rows, kWidth, kHeight);
+    return updated;
+}
+
+void test_benchmark(void) {
+    static OldSpark old[160];
+    for (int i = 0; i < 160; i++) old[i].life = 0;
+    ParticleSystem<160> p;
+    p.setGravity(0, 51);
+    p.setDrag(243);
+    ParticleSystem<160>::Emitter e;
+    e.x = 5 * 256;
+    e.y = 8 * 256;
+    e.angleRange = 65535;
+    e.speedMax = 256;
+    e.lifeMin = 10;
+    e.lifeMax = 25;
+    e.rateQ8 = 8 * 256;
+
+    const int frames = 200000;
+    volatile uint32_t sink = 0;
+    uint64_t oldUpdates = 0, newUpdates = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; f++) {
+        uint16_t rows[kHeight] = {};
+        oldUpdates += oldFrame(old, 160, 8, rows);
+        sink += rows[f & 15];
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; f++) {
+        uint16_t rows[kHeight] = {};
+        newUpdates += newFrame(p, e, rows);
+        sink += rows[f & 15];
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    (void)sink;
+
+    const double oldMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    const double newMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    char msg[160];
+    snprintf(msg, sizeof(msg), "float AoS: %.0f updates/ms, %.0f live; fixed SoA: %.0f updates/ms, %.0f live (%.1fx)",
+             oldUpdates / oldMs, (double)oldUpdates / frames, newUpdates / newMs, (double)newUpdates / frames,
+             (newUpdates / newMs) / (oldUpdates / oldMs));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(newUpdates > 0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_free_list);
+    RUN_TEST(test_motion_and_life);
+    RUN_TEST(test_bounds);
+    RUN_TEST(test_emitters);
+    RUN_TEST(test_raster);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,270 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "engine/Physics2D.h"
+#include "engine/FixedMath.h"
+
+// Host tests for the fixed-step ball physics (pio test -e native)
+
+static const int kWidth = 10, kHeight = 16;
+
+// The games' speed caps (Q8 px per step), as in their modes
+static const int32_t kMarbleMax = 205, kPongMax = 256, kBreakoutMax = 128, kMazeMax = 192;
+
+static uint32_t rng = 12345;
+static int32_t randomRange(int32_t lo, int32_t hi) {  // [lo, hi]
+    return lo + (int32_t)(fixmath::xorshift32(rng) % (uint32_t)(hi - lo + 1));
+}
+
+// A closed ring of one-pixel walls from (1, 1) to (8, 14)
+static void room(uint16_t* rows) {
+    for (int y = 0; y < kHeight; y++) {
+        if (y == 1 || y == 14) rows[y] = 0x1FE;
+        else if (y > 1 && y < 14) rows[y] = (1u << 1) | (1u << 8);
+        else rows[y] = 0;
+    }
+}
+
+static bool insideRoom(const PhysicsBody& b) {
+    return b.x >= 2 * 256 && b.x + b.w <= 8 * 256 && b.y >= 2 * 256 && b.y + b.h <= 14 * 256;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Whole steps from elapsed time, remainder carried, backlog dropped after a stall
+void test_fixed_step(void) {
+    FixedStep clock(16667, 4);
+    clock.reset(1000);
+    TEST_ASSERT_EQUAL_INT(0, clock.advance(1000 + 16666));
+    TEST_ASSERT_EQUAL_INT(1, clock.advance(1000 + 16667));
+    TEST_ASSERT_EQUAL_INT(2, clock.advance(1000 + 16667 * 3));
+    int total = 0;
+    for (uint32_t t = 1000 + 16667 * 3; t < 1000 + 16667 * 3 + 1000000; t += 7000) total += clock.advance(t);
+    TEST_ASSERT_INT_WITHIN(1, 1000000 / 16667, total);
+    TEST_ASSERT_EQUAL_INT(4, clock.advance(5000000));  // Stalled: four steps, not hundreds
+    TEST_ASSERT_EQUAL_INT(0, clock.advance(5000001));
+
+    // The microsecond clock wrapping is just more elapsed time
+    clock.reset(0xFFFFF000u);
+    TEST_ASSERT_EQUAL_INT(1, clock.advance(0xFFFFF000u + 20000));
+}
+
+// A hit stops the body at the face; restitution and friction shape the bounce
+void test_hits(void) {
+    PhysicsWorld world(kWidth, kHeight);
+    uint16_t walls[kHeight] = {};
+    walls[5] = 0x3FF;  // A full row at y = 5
+    world.setWalls(walls);
+
+    PhysicsBody b;
+    b.w = b.h = 256;
+    b.x = 4 * 256;
+    b.y = 2 * 256;
+    b.vy = 600;  // Just over 2 px per step: from y = 2 into the row at 5 in one step
+    b.restitution = 0;
+    PhysicsHit hits[4];
+    TEST_ASSERT_EQUAL_INT(1, world.step(b, 0, 0, hits, 4));
+    TEST_ASSERT_EQUAL_INT(4 * 256, b.y);
+    TEST_ASSERT_EQUAL_INT(0, b.vy);
+    TEST_ASSERT_EQUAL_INT(1, hits[0].axis);
+    TEST_ASSERT_EQUAL_INT(1, hits[0].dir);
+    TEST_ASSERT_EQUAL_INT(-1, hits[0].box);
+    TEST_ASSERT_EQUAL_INT(4, hits[0].cellX);
+    TEST_ASSERT_EQUAL_INT(5, hits[0].cellY);
+    TEST_ASSERT_EQUAL_INT(600, hits[0].speed);
+
+    // Half restitution: half the speed back, and the rest of the step's travel halved too
+    b.y = 2 * 256 + 128;
+    b.vy = 512;
+    b.vx = 100;
+    b.restitution = 128;
+    b.friction = 64;
+    world.step(b, 0, 0, hits, 4);
+    TEST_ASSERT_EQUAL_INT(-256, b.vy);
+    TEST_ASSERT_EQUAL_INT(4 * 256 - 64, b.y);  // 384 to the face, 128 left over, 64 back
+    TEST_ASSERT_EQUAL_INT(75, b.vx);           // A quarter lost to friction
+
+    // Closed edges are walls; open ones let the body out
+    PhysicsWorld open(kWidth, kHeight);
+    open.setOpenEdges(PhysicsWorld::Bottom);
+    PhysicsBody c;
+    c.x = 9 * 256;
+    c.y = 15 * 256;
+    c.vx = 300;
+    c.vy = 300;
+    TEST_ASSERT_EQUAL_INT(1, open.step(c, 0, 0, hits, 4));
+    TEST_ASSERT_EQUAL_INT(-1, hits[0].box);
+    TEST_ASSERT_EQUAL_INT(10, hits[0].cellX);
+    TEST_ASSERT_TRUE(c.vx < 0);
+    TEST_ASSERT_TRUE(c.y >= 16 * 256);
+}
+
+void test_boxes(void) {
+    PhysicsWorld world(kHeight, kWidth);
+    world.setOpenEdges(PhysicsWorld::Left | PhysicsWorld::Right);
+    PhysicsBox paddle = { 15 * 256, 3 * 256, 256, 3 * 256 };
+    world.setBoxes(&paddle, 1);
+
+    PhysicsBody ball;
+    ball.w = ball.h = 256;
+    ball.x = 10 * 256;
+    ball.y = 4 * 256;
+    ball.vx = 1024;  // 4 px per step, straight at the paddle
+    PhysicsHit hits[4];
+    world.step(ball, 0, 0, hits, 4);
+    TEST_ASSERT_EQUAL_INT(14 * 256, ball.x);
+    world.step(ball, 0, 0, hits, 4);
+    TEST_ASSERT_EQUAL_INT(0, hits[0].box);
+    TEST_ASSERT_EQUAL_INT(-1024, ball.vx);
+    TEST_ASSERT_EQUAL_INT(10 * 256, ball.x);  // Met the paddle at once, then 4 px back
+
+    // Beside the paddle: straight past, out of the open edge
+    ball.x = 10 * 256;
+    ball.y = 7 * 256;
+    ball.vx = 1024;
+    for (int i = 0; i < 3; i++) TEST_ASSERT_EQUAL_INT(0, world.step(ball, 0, 0));
+    TEST_ASSERT_TRUE(ball.x >= 16 * 256);
+}
+
+// At 4x every game's top speed, in every direction, bodies stay inside a
+// ring of one-pixel walls and never end a step inside one
+void test_no_tunneling(void) {
+    uint16_t walls[kHeight];
+    room(walls);
+    PhysicsWorld world(kWidth, kHeight);
+    world.setWalls(walls);
+
+    const int32_t speeds[] = { kMarbleMax * 4, kPongMax * 4, kBreakoutMax * 4, kMazeMax * 4 };
+    const int32_t sizes[] = { 256, 256, 256, 1 };  // The maze ball is a point
+    int escapes = 0, overlaps = 0;
+    for (int g = 0; g < 4; g++) {
+        for (int run = 0; run < 200; run++) {
+            PhysicsBody b;
+            b.w = b.h = sizes[g];
+            b.x = randomRange(2 * 256, 8 * 256 - b.w);
+            b.y = randomRange(2 * 256, 14 * 256 - b.h);
+            b.vx = randomRange(-speeds[g], speeds[g]);
+            b.vy = randomRange(-speeds[g], speeds[g]);
+            b.maxSpeed = speeds[g];
+            b.restitution = g == 3 ? 0 : 256;
+            for (int s = 0; s < 500; s++) {
+                // The marble and maze are pushed around by random tilt as well
+                const int32_t ax = g == 0 || g == 3 ? randomRange(-speeds[g] / 2, speeds[g] / 2) : 0;
+                const int32_t ay = g == 0 || g == 3 ? randomRange(-speeds[g] / 2, speeds[g] / 2) : 0;
+                world.step(b, ax, ay);
+                if (!insideRoom(b)) escapes++;
+                if (world.overlaps(b)) overlaps++;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, escapes);
+    TEST_ASSERT_EQUAL_INT(0, overlaps);
+
+    // Pong at 4x: paddles that track the ball never let it out of the open ends
+    PhysicsWorld pong(kHeight, kWidth);
+    pong.setOpenEdges(PhysicsWorld::Left | PhysicsWorld::Right);
+    PhysicsBox paddles[2] = { { 0, 0, 256, 3 * 256 }, { 15 * 256, 0, 256, 3 * 256 } };
+    pong.setBoxes(paddles, 2);
+    for (int run = 0; run < 200; run++) {
+        PhysicsBody ball;
+        ball.w = ball.h = 256;
+        ball.x = 7 * 256;
+        ball.y = randomRange(0, 9 * 256);
+        ball.vx = randomRange(kPongMax, kPongMax * 4) * (run % 2 ? 1 : -1);
+        ball.vy = randomRange(-kPongMax * 4, kPongMax * 4);
+        ball.maxSpeed = kPongMax * 4;
+        for (int s = 0; s < 500; s++) {
+            for (int p = 0; p < 2; p++) {
+                const int32_t centred = ball.y - 256;
+                paddles[p].y = centred < 0 ? 0 : (centred > 7 * 256 ? 7 * 256 : centred);
+            }
+            pong.step(ball, 0, 0);
+            TEST_ASSERT_TRUE(ball.x >= 256 && ball.x + ball.w <= 15 * 256);
+        }
+    }
+
+    // Lander falling at 4x its crash speed onto one-pixel-high ground: stops on top of it
+    uint16_t ground[kHeight] = {};
+    ground[15] = 0x3FF;
+    PhysicsWorld moon(kWidth, kHeight);
+    moon.setWalls(ground);
+    moon.setOpenEdges(PhysicsWorld::Top);
+    for (int32_t vy = 1; vy <= 114 * 4; vy += 7) {
+        PhysicsBody lander;
+        lander.x = 5 * 256;
+        lander.y = 0;
+        lander.vy = vy;
+        lander.restitution = 0;
+        PhysicsHit hits[4];
+        int n = 0;
+        for (int s = 0; s <= 15 * 256 / vy && n == 0; s++) n = moon.step(lander, 0, 0, hits, 4);
+        TEST_ASSERT_EQUAL_INT(1, n);
+        TEST_ASSERT_EQUAL_INT(15 * 256 - 1, lander.y);
+        TEST_ASSERT_EQUAL_INT(vy, hits[0].speed);
+    }
+}
+
+// The old clamp-and-flip loop (move, then look at the cell it landed in)
+// against the swept step, both at 4x the maze's top speed
+void test_benchmark(void) {
+    uint16_t walls[kHeight];
+    room(walls);
+    PhysicsWorld world(kWidth, kHeight);
+    world.setWalls(walls);
+
+    const int runs = 20000, steps = 100;
+    int oldEscapes = 0, newEscapes = 0;
+    volatile int32_t sink = 0;
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int run = 0; run < runs; run++) {
+        float x = 3.5f, y = 7.5f;
+        float vx = randomRange(-768, 768) / 256.0f, vy = randomRange(-768, 768) / 256.0f;
+        for (int s = 0; s < steps; s++) {
+            const float nx = x + vx, ny = y + vy;
+            const int cx = (int)nx, cy = (int)ny;
+            if (cx >= 0 && cx < kWidth && cy >= 0 && cy < kHeight && ((walls[cy] >> cx) & 1)) {
+                vx = -vx;  // Flip, stay put
+                vy = -vy;
+            } else {
+                x = nx;
+                y = ny;
+            }
+        }
+        if (x < 2 || x >= 8 || y < 2 || y >= 14) oldEscapes++;
+        sink += (int32_t)x;
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int run = 0; run < runs; run++) {
+        PhysicsBody b;
+        b.x = 3 * 256 + 128;
+        b.y = 7 * 256 + 128;
+        b.vx = randomRange(-768, 768);
+        b.vy = randomRange(-768, 768);
+        for (int s = 0; s < steps; s++) world.step(b, 0, 0);
+        if (!insideRoom(b)) newEscapes++;
+        sink += b.x;
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    (void)sink;
+
+    const double oldNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)runs * steps);
+    const double newNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / ((double)runs * steps);
+    char msg[160];
+    snprintf(msg, sizeof(msg), "3 px/step in a walled room: old loop %.0f ns/step, %d of %d escaped; "
+             "swept %.0f ns/step, %d escaped", oldNs, oldEscapes, runs, newNs, newEscapes);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_INT(0, newEscapes);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fixed_step);
+    RUN_TEST(test_hits);
+    RUN_TEST(test_boxes);
+    RUN_TEST(test_no_tunneling);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,258 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "engine/SandGrid.h"
+
+// Host tests for the falling-sand engine (pio test -e native)
+
+static constexpr int kW = 16, kH = 10;  // Panel y along a row, panel x down the rows
+
+static uint32_t rng = 1;
+static uint32_t nextRandom() { return fixmath::xorshift32(rng); }
+
+static void scatter(SandGrid& sand, int grains) {
+    for (int placed = 0; placed < grains;) {
+        const int x = nextRandom() % kW, y = nextRandom() % kH;
+        if (sand.get(x, y)) continue;
+        sand.set(x, y, true);
+        placed++;
+    }
+}
+
+// Stand-in for the display's GFXcanvas1: 1 bit per pixel, rotation-aware,
+// drawPixel reached through a virtual call
+struct BitCanvas {
+    uint8_t buffer[16 * 2] = {};  // 10 x 16 pixels, two bytes per row
+    uint8_t rotation = 0;
+    virtual ~BitCanvas() {}
+
+    virtual void drawPixel(int x, int y, uint16_t color) {
+        if (x < 0 || x >= 10 || y < 0 || y >= 16) return;
+        if (rotation == 1) {
+            const int t = x;
+            x = 9 - y;
+            y = t;
+        }
+        if (color) buffer[y * 2 + x / 8] |= 0x80 >> (x & 7);
+        else buffer[y * 2 + x / 8] &= ~(0x80 >> (x & 7));
+    }
+    bool getPixel(int x, int y) const {
+        if (x < 0 || x >= 10 || y < 0 || y >= 16) return false;
+        if (rotation == 1) {
+            const int t = x;
+            x = 9 - y;
+            y = t;
+        }
+        return buffer[y * 2 + x / 8] & (0x80 >> (x & 7));
+    }
+};
+
+// The loop ModeFluid used to run, through the Globals.h pixel helpers:
+// four gravity directions, one getPixel/setPixel per cell
+struct OldSand {
+    BitCanvas* canvas;
+
+    bool getPixel(int x, int y) const {
+        if (x < 0 || x >= 10 || y < 0 || y >= 16) return false;
+        return canvas->getPixel(x, y);
+    }
+    void setPixel(int x, int y, bool on) {
+        if (x >= 0 && x < 10 && y >= 0 && y < 16) canvas->drawPixel(x, y, on ? 1 : 0);
+    }
+
+    void step(int accX, int accY) {
+        int dx = 0, dy = 0;
+        if (abs(accY) > abs(accX)) dy = accY > 0 ? 1 : -1;
+        else dx = accX > 0 ? 1 : -1;
+        const int startX = dx == 1 ? 9 : 0, endX = dx == 1 ? -1 : 10, stepX = dx == 1 ? -1 : 1;
+        const int startY = dy == 1 ? 15 : 0, endY = dy == 1 ? -1 : 16, stepY = dy == 1 ? -1 : 1;
+        for (int y = startY; y != endY; y += stepY) {
+            for (int x = startX; x != endX; x += stepX) {
+                if (!getPixel(x, y)) continue;
+                const int belowX = x + dx, belowY = y + dy;
+                const bool canMoveDown = belowX >= 0 && belowX < 10 && belowY >= 0 && belowY < 16;
+                if (canMoveDown && !getPixel(belowX, belowY)) {
+                    setPixel(x, y, 0);
+                    setPixel(belowX, belowY, 1);
+                    continue;
+                }
+                if (dy != 0) {
+                    if (x + 1 < 10 && !getPixel(x + 1, belowY) && canMoveDown) {
+                        setPixel(x, y, 0);
+                        setPixel(x + 1, belowY, 1);
+                    } else if (x - 1 >= 0 && !getPixel(x - 1, belowY) && canMoveDown) {
+                        setPixel(x, y, 0);
+                        setPixel(x - 1, belowY, 1);
+                    }
+                } else {
+                    if (y + 1 < 16 && !getPixel(belowX, y + 1) && canMoveDown) {
+                        setPixel(x, y, 0);
+                        setPixel(belowX, y + 1, 1);
+                    } else if (y - 1 >= 0 && !getPixel(belowX, y - 1) && canMoveDown) {
+                        setPixel(x, y, 0);
+                        setPixel(belowX, y - 1, 1);
+                    }
+                }
+            }
+        }
+    }
+};
+
+static SandGrid sand;
+
+void setUp(void) {
+    sand.configure(kW, kH);
+    sand.seed(12345);
+    rng = 1;
+}
+void tearDown(void) {}
+
+// No grain is ever lost or duplicated, whatever the gravity does
+void test_grains_conserved(void) {
+    scatter(sand, 70);
+    for (int i = 0; i < 5000; i++) {
+        sand.step((uint16_t)nextRandom());
+        TEST_ASSERT_EQUAL_UINT32(70, sand.population());
+        for (int y = 0; y < kH; y++) TEST_ASSERT_EQUAL_HEX32(0, sand.rows()[y] >> kW);
+    }
+
+    // Full board: nothing can move
+    for (int y = 0; y < kH; y++) sand.rows()[y] = 0xFFFF;
+    TEST_ASSERT_EQUAL_INT(0, sand.step(0x3000));
+    TEST_ASSERT_EQUAL_UINT32(kW * kH, sand.population());
+}
+
+// A lone grain falls one cell per step in each of the eight directions
+void test_single_grain_octants(void) {
+    for (int k = 0; k < 8; k++) {
+        sand.clear();
+        sand.set(8, 5, true);
+        TEST_ASSERT_EQUAL_INT(1, sand.stepOctant(k));
+        TEST_ASSERT_TRUE(sand.get(8 + SandGrid::octantX(k), 5 + SandGrid::octantY(k)));
+        TEST_ASSERT_EQUAL_UINT32(1, sand.population());
+    }
+
+    // Binary angles: 0 is +x, a quarter turn is +y
+    sand.clear();
+    sand.set(8, 5, true);
+    sand.step(0x4000);
+    TEST_ASSERT_TRUE(sand.get(8, 6));
+    sand.step(0xC000);
+    TEST_ASSERT_TRUE(sand.get(8, 5));
+    sand.step(0x8000);
+    TEST_ASSERT_TRUE(sand.get(7, 5));
+}
+
+// Angles between octants mix the two in proportion
+void test_angle_interpolation(void) {
+    const uint16_t angles[] = { 0x1000, 0x0800, 0x5800, 0xF000 };
+    const int expectAbove[] = { 500, 250, 750, 500 };
+    for (int a = 0; a < 4; a++) {
+        int above = 0;
+        const int below = angles[a] >> 13;
+        for (int i = 0; i < 1000; i++) {
+            const int k = sand.octantFor(angles[a]);
+            TEST_ASSERT_TRUE(k == below || k == ((below + 1) & 7));
+            above += k != below;
+        }
+        TEST_ASSERT_INT_WITHIN(2, expectAbove[a], above);
+    }
+
+    // A lone grain under 22.5 degrees drifts one cell sideways for every two down
+    sand.clear();
+    sand.set(0, 0, true);
+    for (int i = 0; i < 8; i++) sand.step(0x3000);
+    int x = -1, y = -1;
+    for (int r = 0; r < kH; r++) {
+        for (int c = 0; c < kW; c++) if (sand.get(c, r)) x = c, y = r;
+    }
+    TEST_ASSERT_EQUAL_INT(8, y);
+    TEST_ASSERT_INT_WITHIN(1, 4, x);
+}
+
+// Under straight gravity the pile settles with no grain left hanging
+void test_pile_settles(void) {
+    scatter(sand, 60);
+    int moved = 0;
+    for (int i = 0; i < 200; i++) moved = sand.step(0x4000);
+    TEST_ASSERT_EQUAL_INT(0, moved);
+    for (int y = 0; y < kH - 1; y++) {
+        for (int x = 0; x < kW; x++) {
+            if (!sand.get(x, y)) continue;
+            TEST_ASSERT_TRUE(sand.get(x, y + 1));
+            TEST_ASSERT_TRUE(x == 0 || sand.get(x - 1, y + 1));
+            TEST_ASSERT_TRUE(x == kW - 1 || sand.get(x + 1, y + 1));
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(60, sand.population());
+}
+
+// A grain landing on another slides left or right about equally often
+void test_tie_break_balanced(void) {
+    int left = 0, right = 0;
+    for (int i = 0; i < 2000; i++) {
+        sand.clear();
+        sand.set(8, kH - 1, true);
+        sand.set(8, kH - 2, true);
+        sand.step(0x4000);
+        left += sand.get(7, kH - 1);
+        right += sand.get(9, kH - 1);
+    }
+    TEST_ASSERT_EQUAL_INT(2000, left + right);
+    TEST_ASSERT_INT_WITHIN(150, 1000, left);
+
+    // Whole rows at once: a flat layer on a pyramid top spreads both ways
+    sand.clear();
+    sand.rows()[kH - 1] = 1u << 8;
+    sand.rows()[kH - 2] = 0x0FF0;
+    sand.step(0x4000);
+    TEST_ASSERT_TRUE(sand.rows()[kH - 1] & ((1u << 8) - 1));
+    TEST_ASSERT_TRUE(sand.rows()[kH - 1] >> 9);
+}
+
+void test_benchmark(void) {
+    static constexpr int kSteps = 200000;
+    uint32_t sink = 0;
+
+    BitCanvas* canvas = new BitCanvas();
+    OldSand old = { canvas };
+    rng = 7;
+    for (int i = 0; i < 60; i++) old.setPixel(nextRandom() % 10, nextRandom() % 16, 1);
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kSteps; i++) {
+        const int turn = (i / 500) & 3;  // Tip the board over every 500 steps
+        old.step(turn == 0 ? 1000 : (turn == 2 ? -1000 : 0), turn == 1 ? 1000 : (turn == 3 ? -1000 : 0));
+        sink += canvas->buffer[i & 31];
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    delete canvas;
+
+    rng = 7;
+    scatter(sand, 60);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kSteps; i++) {
+        sink += sand.step((uint16_t)(((i / 500) & 3) << 14) + 0x0400);
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    const double oldNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / kSteps;
+    const double newNs = std::chrono::duration<double, std::nano>(t3 - t2).count() / kSteps;
+    char msg[160];
+    snprintf(msg, sizeof(msg), "16x10, 60 grains: per-pixel loop %.0f ns/step, row masks %.0f ns/step (%.1fx) [%u]",
+             oldNs, newNs, oldNs / newNs, (unsigned)(sink & 1));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(newNs * 2 < oldNs);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_grains_conserved);
+    RUN_TEST(test_single_grain_octants);
+    RUN_TEST(test_angle_interpolation);
+    RUN_TEST(test_pile_settles);
+    RUN_TEST(test_tie_break_balanced);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,249 @@
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include "engine/SensorTrace.h"
+#include "engine/OrientationFilter.h"
+#include "engine/GestureRecognizer.h"
+
+// Host tests for the sensor trace format and replay (pio test -e native)
+
+using namespace sensortrace;
+
+static const uint32_t kPeriodUs = 2000;  // 500 Hz
+
+static uint32_t lcgState = 1;
+static int noise(int amplitude) {
+    lcgState = lcgState * 1664525u + 1013904223u;
+    return (int32_t)(lcgState >> 16) % (2 * amplitude + 1) - amplitude;
+}
+
+// Raw MPU6050 stream: lying still, a tilt to the right, a shake, then a press
+struct Synth {
+    std::vector<Record> records;
+
+    void sample(uint32_t tUs, int ax, int ay, int az, int gx = 0, int gy = 0, int gz = 0) {
+        Record r = {};
+        r.type = Record::Type::Sample;
+        r.tUs = tUs;
+        const int v[kAxes] = { ax, ay, az, gx, gy, gz };
+        for (int a = 0; a < kAxes; a++) r.imu[a] = (int16_t)(v[a] + noise(a < 3 ? 40 : 8));
+        records.push_back(r);
+    }
+
+    void edge(uint32_t tUs, bool pressed) {
+        Record r = {};
+        r.type = Record::Type::Edge;
+        r.tUs = tUs;
+        r.pressed = pressed;
+        records.push_back(r);
+    }
+
+    Synth() {
+        uint32_t t = 1000000;
+        for (int i = 0; i < 500; i++, t += kPeriodUs) sample(t, 0, 0, 16384);
+        for (int i = 0; i < 1500; i++, t += kPeriodUs) sample(t, 5000, 0, 15600);
+        for (int i = 0; i < 500; i++, t += kPeriodUs) {
+            const int linear = (int)(9800 * sin(2 * 3.14159265 * 6.0 * i / 500));
+            sample(t, linear, 0, 16384, 0, 0, linear / 8);
+        }
+        for (int i = 0; i < 500; i++, t += kPeriodUs) {
+            if (i == 100) edge(t - 700, true);
+            if (i == 150) edge(t - 300, false);
+            sample(t, 0, 0, 16384);
+        }
+    }
+
+    size_t write(std::vector<uint8_t>& buf, size_t capacity) const {
+        buf.assign(capacity, 0);
+        Header h = {};
+        h.sampleHz = 500;
+        h.seed = 1234;
+        h.modeIndex = 6;
+        Writer w(buf.data(), buf.size());
+        w.begin(h);
+        for (size_t i = 0; i < records.size(); i++) {
+            const Record& r = records[i];
+            const bool ok = r.type == Record::Type::Edge ? w.addEdge(r.tUs, r.pressed) : w.addSample(r.tUs, r.imu);
+            if (!ok) break;
+        }
+        return w.finish();
+    }
+};
+
+void setUp(void) { lcgState = 1; }
+void tearDown(void) {}
+
+void test_round_trip(void) {
+    Synth synth;
+    std::vector<uint8_t> buf;
+    const size_t len = synth.write(buf, 65536);
+
+    Reader reader(buf.data(), len);
+    TEST_ASSERT_TRUE(reader.valid());
+    TEST_ASSERT_EQUAL_UINT32(synth.records.size(), reader.header().records);
+    TEST_ASSERT_EQUAL_UINT32(1234, reader.header().seed);
+    TEST_ASSERT_EQUAL_UINT8(6, reader.header().modeIndex);
+    TEST_ASSERT_EQUAL_UINT32(synth.records.back().tUs - synth.records.front().tUs, reader.header().durationUs);
+
+    const uint32_t t0 = synth.records.front().tUs;
+    Record r;
+    for (size_t i = 0; i < synth.records.size(); i++) {
+        const Record& want = synth.records[i];
+        TEST_ASSERT_TRUE(reader.next(r));
+        TEST_ASSERT_TRUE(want.type == r.type);
+        TEST_ASSERT_EQUAL_UINT32(want.tUs - t0, r.tUs);
+        if (want.type == Record::Type::Edge) TEST_ASSERT_EQUAL(want.pressed, r.pressed);
+        else TEST_ASSERT_EQUAL_INT16_ARRAY(want.imu, r.imu, kAxes);
+    }
+    TEST_ASSERT_FALSE(reader.next(r));
+}
+
+void test_compact(void) {
+    Synth synth;
+    std::vector<uint8_t> buf;
+    const size_t len = synth.write(buf, 65536);
+    const float perRecord = (float)(len - sizeof(Header)) / synth.records.size();
+    char msg[64];
+    snprintf(msg, sizeof(msg), "%.2f bytes/record vs 16 raw", perRecord);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(perRecord < 11.0f);
+}
+
+void test_late_edge_keeps_order(void) {
+    // An edge reported after a later sample is stored at that sample's time
+    uint8_t buf[256];
+    Header h = {};
+    Writer w(buf, sizeof(buf));
+    w.begin(h);
+    const int16_t imu[kAxes] = { 1, 2, 3, 4, 5, 6 };
+    w.addSample(10000, imu);
+    w.addEdge(9000, true);
+    w.addSample(12000, imu);
+    const size_t len = w.finish();
+
+    Reader reader(buf, len);
+    Record r;
+    TEST_ASSERT_TRUE(reader.next(r));
+    TEST_ASSERT_TRUE(reader.next(r));
+    TEST_ASSERT_TRUE(r.type == Record::Type::Edge);
+    TEST_ASSERT_EQUAL_UINT32(0, r.tUs);
+    TEST_ASSERT_TRUE(reader.next(r));
+    TEST_ASSERT_EQUAL_UINT32(2000, r.tUs);
+}
+
+void test_full_and_invalid(void) {
+    Synth synth;
+    std::vector<uint8_t> buf;
+    const size_t len = synth.write(buf, 4096);
+    TEST_ASSERT_TRUE(len <= 4096);
+    Reader reader(buf.data(), len);
+    TEST_ASSERT_TRUE(reader.valid());
+    TEST_ASSERT_TRUE(reader.header().records > 100);
+    TEST_ASSERT_TRUE(reader.header().records < synth.records.size());
+    Record r;
+    uint32_t n = 0;
+    while (reader.next(r)) n++;
+    TEST_ASSERT_EQUAL_UINT32(reader.header().records, n);
+
+    TEST_ASSERT_FALSE(Reader(buf.data(), len - 1).valid());  // Cut short
+    TEST_ASSERT_FALSE(Reader(buf.data(), 10).valid());
+    buf[0] ^= 0xFF;
+    TEST_ASSERT_FALSE(Reader(buf.data(), len).valid());       // Foreign magic
+}
+
+// Same records in the same order whether polled every 1 ms or every 37 ms
+static std::vector<Record> play(const std::vector<uint8_t>& buf, size_t len, uint32_t stepUs) {
+    std::vector<Record> out;
+    Player player;
+    const uint32_t startUs = 0xFFF00000u;  // Clock wraps during the replay
+    TEST_ASSERT_TRUE(player.start(buf.data(), len, startUs));
+    Record r;
+    for (uint32_t now = startUs; !player.done(); now += stepUs) {
+        while (player.poll(now, r)) {
+            TEST_ASSERT_TRUE((int32_t)(now - r.tUs) >= 0);  // Never early
+            out.push_back(r);
+        }
+    }
+    return out;
+}
+
+void test_player_pacing(void) {
+    Synth synth;
+    std::vector<uint8_t> buf;
+    const size_t len = synth.write(buf, 65536);
+    const std::vector<Record> fine = play(buf, len, 1000);
+    const std::vector<Record> coarse = play(buf, len, 37000);
+    TEST_ASSERT_EQUAL_UINT32(synth.records.size(), fine.size());
+    TEST_ASSERT_EQUAL_UINT32(fine.size(), coarse.size());
+    for (size_t i = 0; i < fine.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(fine[i].tUs, coarse[i].tUs);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(fine[i].imu, coarse[i].imu, kAxes);
+    }
+}
+
+// Replays a trace through the game task's pipeline (fusion, then gestures)
+// the way main.cpp does, and returns the gestures plus button edges seen
+static std::vector<int> runPipeline(const std::vector<uint8_t>& buf, size_t len, uint32_t stepUs) {
+    std::vector<int> seen;
+    OrientationFilter orientation(500, 500);
+    GestureRecognizer gestures;
+    bool seeded = false;
+    Player player;
+    player.start(buf.data(), len, 0);
+    Record r;
+    for (uint32_t now = 0; !player.done(); now += stepUs) {
+        while (player.poll(now, r)) {
+            if (r.type == Record::Type::Edge) {
+                seen.push_back(r.pressed ? 100 : 101);
+                continue;
+            }
+            if (!seeded) {
+                orientation.reset(r.imu[0], r.imu[1], r.imu[2]);
+                seeded = true;
+            }
+            orientation.update(r.imu[0], r.imu[1], r.imu[2], r.imu[3], r.imu[4], r.imu[5]);
+            const int16_t gravity[3] = { orientation.gravity(0), orientation.gravity(1), orientation.gravity(2) };
+            gestures.update(r.tUs, gravity[0], gravity[1], r.imu, gravity);
+        }
+        Gesture g;
+        while (gestures.poll(g)) seen.push_back((int)g.type * 10 + (int)g.dir);
+    }
+    return seen;
+}
+
+void test_deterministic_replay(void) {
+    Synth synth;
+    std::vector<uint8_t> buf;
+    const size_t len = synth.write(buf, 65536);
+    const std::vector<int> first = runPipeline(buf, len, 16000);
+    const std::vector<int> second = runPipeline(buf, len, 16000);
+    const std::vector<int> jittery = runPipeline(buf, len, 5000);
+
+    TEST_ASSERT_TRUE(first.size() >= 5);
+    TEST_ASSERT_EQUAL_UINT32(first.size(), second.size());
+    TEST_ASSERT_EQUAL_INT_ARRAY(first.data(), second.data(), first.size());
+    TEST_ASSERT_EQUAL_UINT32(first.size(), jittery.size());
+    TEST_ASSERT_EQUAL_INT_ARRAY(first.data(), jittery.data(), first.size());
+
+    // Tilt right, its hold, the shake and the click all came through
+    const int wanted[] = { (int)GestureType::Tilt * 10 + (int)TiltDir::Right,
+                           (int)GestureType::TiltHold * 10 + (int)TiltDir::Right,
+                           (int)GestureType::Shake * 10, 100, 101 };
+    for (size_t w = 0; w < sizeof(wanted) / sizeof(wanted[0]); w++) {
+        bool found = false;
+        for (size_t i = 0; i < first.size(); i++) found |= first[i] == wanted[w];
+        TEST_ASSERT_TRUE(found);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_compact);
+    RUN_TEST(test_late_edge_keeps_order);
+    RUN_TEST(test_full_and_invalid);
+    RUN_TEST(test_player_pacing);
+    RUN_TEST(test_deterministic_replay);
+    return UNITY_END();
+}
@@ -0,0 +1,178 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "engine/ShallowWater.h"
+
+// Host tests for the heightfield water engine (pio test -e native)
+
+static constexpr int32_t kG = ShallowWater::kOneG;
+static constexpr int32_t kCell = ShallowWater::kCell;
+
+static ShallowWater water;
+
+void setUp(void) {
+    water.configure(10, 16);
+    water.setStiffness(38);
+    water.setDamping(7);
+}
+void tearDown(void) {}
+
+static void checkBounds() {
+    for (int i = 0; i < water.columns(); i++) {
+        TEST_ASSERT_TRUE(water.levels()[i] >= 0);
+        TEST_ASSERT_TRUE(water.levels()[i] <= water.depth() * kCell);
+    }
+}
+
+// Filling, cells and the rendered rows agree
+void test_fill_and_render(void) {
+    water.fill(10 * 4 * kCell + 10 * kCell / 2);  // Four and a half cells deep
+    TEST_ASSERT_EQUAL_INT32(10 * 4 * kCell + 10 * kCell / 2, water.volume());
+    TEST_ASSERT_EQUAL_INT32(kCell, water.cell(3, 15));
+    TEST_ASSERT_EQUAL_INT32(kCell / 2, water.cell(3, 11));
+    TEST_ASSERT_EQUAL_INT32(0, water.cell(3, 10));
+
+    uint32_t rows[10];
+    water.render(rows);
+    for (int x = 0; x < 10; x++) TEST_ASSERT_EQUAL_HEX32(0xF800, rows[x]);
+
+    // More than the box holds is capped
+    water.fill(1 << 30);
+    TEST_ASSERT_EQUAL_INT32(10 * 16 * kCell, water.volume());
+}
+
+// Volume is exact through tilts, splashes and floor changes, and no column
+// ever goes negative or over the top
+void test_volume_conserved(void) {
+    water.fill(10 * 6 * kCell + 77);
+    const int32_t volume = water.volume();
+    uint32_t s = 99;
+    int floors = 0;
+    ShallowWater::Floor last = water.floor();
+    for (int i = 0; i < 20000; i++) {
+        if (i % 40 == 0) {
+            fixmath::xorshift32(s);
+            water.setGravity((int32_t)(s % (2 * kG)) - kG, (int32_t)((s >> 16) % (2 * kG)) - kG);
+            if (i % 400 == 0) water.splash(s, 3 * kCell);
+        }
+        water.step();
+        TEST_ASSERT_EQUAL_INT32(volume, water.volume());
+        checkBounds();
+        floors += water.floor() != last;
+        last = water.floor();
+    }
+    TEST_ASSERT_TRUE(floors > 20);
+
+    // A full box stays full
+    water.fill(1 << 30);
+    water.setGravity(kG / 2, kG / 2);
+    for (int i = 0; i < 200; i++) water.step();
+    TEST_ASSERT_EQUAL_INT32(10 * 16 * kCell, water.volume());
+    checkBounds();
+}
+
+// Under a sideways pull the surface settles perpendicular to gravity
+void test_tilted_surface(void) {
+    water.fill(10 * 8 * kCell);
+    water.setGravity(kG / 4, kG);  // ~14 degrees: the surface drops 1/4 cell per column
+    for (int i = 0; i < 3000; i++) water.step();
+    TEST_ASSERT_EQUAL(ShallowWater::PosY, water.floor());
+    const int32_t* h = water.levels();
+    for (int i = 0; i + 1 < 10; i++) TEST_ASSERT_INT_WITHIN(kCell / 32, kCell / 4, h[i + 1] - h[i]);
+    TEST_ASSERT_EQUAL_INT32(10 * 8 * kCell, water.volume());
+
+    // Level again once gravity is straight
+    water.setGravity(0, kG);
+    for (int i = 0; i < 3000; i++) water.step();
+    for (int i = 0; i + 1 < 10; i++) TEST_ASSERT_INT_WITHIN(kCell / 256, 0, h[i + 1] - h[i]);
+    TEST_ASSERT_EQUAL_INT32(0, water.step());  // And perfectly still
+}
+
+// Letting go of a tilt sloshes back and forth, and the sloshing dies down
+void test_slosh_decays(void) {
+    water.fill(10 * 8 * kCell);
+    water.setGravity(kG / 3, kG);
+    for (int i = 0; i < 3000; i++) water.step();
+    water.setGravity(0, kG);
+
+    const int32_t* h = water.levels();
+    int crossings = 0;
+    int32_t last = h[9] - h[0];
+    int32_t early = 0, late = 0;
+    for (int i = 0; i < 600; i++) {
+        water.step();
+        const int32_t tilt = h[9] - h[0];
+        if ((tilt > 0) != (last > 0) && tilt != 0) crossings++;
+        last = tilt;
+        const int32_t size = tilt < 0 ? -tilt : tilt;
+        if (i < 100 && size > early) early = size;
+        if (i >= 500 && size > late) late = size;
+    }
+    TEST_ASSERT_TRUE(crossings >= 4);
+    TEST_ASSERT_TRUE(late * 3 < early);
+}
+
+// Tipping the box over moves the water to the new floor
+void test_floor_follows_gravity(void) {
+    water.fill(16 * 3 * kCell);
+    water.setGravity(kG, 0);
+    TEST_ASSERT_EQUAL(ShallowWater::PosX, water.floor());
+    TEST_ASSERT_EQUAL_INT(16, water.columns());
+    TEST_ASSERT_EQUAL_INT32(16 * 3 * kCell, water.volume());
+    for (int i = 0; i < 2000; i++) water.step();
+    uint32_t rows[10];
+    water.render(rows);
+    TEST_ASSERT_EQUAL_HEX32(0xFFFF, rows[9]);
+    TEST_ASSERT_EQUAL_HEX32(0xFFFF, rows[7]);  // Three cells deep across 16 columns
+    TEST_ASSERT_EQUAL_HEX32(0, rows[6] & 0x7FFE);
+
+    // Just past the diagonal is not enough to move it back
+    water.setGravity(kG * 7 / 10, kG * 3 / 4);
+    TEST_ASSERT_EQUAL(ShallowWater::PosX, water.floor());
+    water.setGravity(0, -kG);
+    TEST_ASSERT_EQUAL(ShallowWater::NegY, water.floor());
+    TEST_ASSERT_EQUAL_INT32(16 * 3 * kCell, water.volume());
+}
+
+void test_benchmark(void) {
+    static constexpr int kSteps = 200000;
+    const struct { int32_t gx, gy; const char* name; } runs[] = {
+        { kG / 3, kG, "10 columns" },
+        { kG, kG / 3, "16 columns" },
+    };
+    for (int r = 0; r < 2; r++) {
+        water.configure(10, 16);
+        water.setGravity(runs[r].gx, runs[r].gy);
+        water.fill(10 * 7 * kCell);
+        int64_t sink = 0;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < kSteps; i++) {
+            if (i % 200 == 0) water.splash((uint32_t)i + 1, 2 * kCell);
+            sink += water.step();
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        uint32_t rows[10];
+        auto t2 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < kSteps / 10; i++) {
+            water.render(rows);
+            sink += rows[i % 10];
+        }
+        auto t3 = std::chrono::high_resolution_clock::now();
+        char msg[160];
+        snprintf(msg, sizeof(msg), "%s: step %.0f ns, render %.0f ns (60 Hz needs 16.7 ms) [%d]", runs[r].name,
+                 std::chrono::duration<double, std::nano>(t1 - t0).count() / kSteps,
+                 std::chrono::duration<double, std::nano>(t3 - t2).count() / (kSteps / 10), (int)(sink & 1));
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fill_and_render);
+    RUN_TEST(test_volume_conserved);
+    RUN_TEST(test_tilted_surface);
+    RUN_TEST(test_slosh_decays);
+    RUN_TEST(test_floor_follows_gravity);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,209 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include "engine/Wireframe.h"
+
+// Host tests for the fixed-point wireframe renderer (pio test -e native)
+
+static const double kPi = 3.14159265358979323846;
+static const int kWidth = 10, kHeight = 16, kStride = 2;
+
+static bool lit(const uint8_t* buffer, int x, int y) { return buffer[y * kStride + x / 8] & (0x80 >> (x & 7)); }
+
+static int count(const uint8_t* buffer) {
+    int n = 0;
+    for (int y = 0; y < kHeight; y++) {
+        for (int x = 0; x < kWidth; x++) n += lit(buffer, x, y);
+    }
+    return n;
+}
+
+// Bits past column 9 in each row belong to no pixel
+static bool paddingClear(const uint8_t* buffer) {
+    for (int y = 0; y < kHeight; y++) {
+        if (buffer[y * kStride + 1] & 0x3F) return false;
+    }
+    return true;
+}
+
+// A single vertex pair, for drawing one known edge
+static int16_t gSegment[2][3];
+static const uint8_t kSegmentEdge[1][2] = { { 0, 1 } };
+static const Mesh kSegment = { "Segment", gSegment, 2, kSegmentEdge, 1 };
+
+static void segment(int x0, int y0, int z0, int x1, int y1, int z1) {
+    const int16_t v[2][3] = { { (int16_t)x0, (int16_t)y0, (int16_t)z0 }, { (int16_t)x1, (int16_t)y1, (int16_t)z1 } };
+    memcpy(gSegment, v, sizeof(v));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// The combined matrix is Rz * Ry * Rx and stays orthonormal
+void test_rotation_matrix(void) {
+    const uint16_t angles[][3] = { { 0, 0, 0 }, { 4000, 9000, 30000 }, { 16384, 0, 0 }, { 60000, 12345, 54321 } };
+    for (size_t n = 0; n < sizeof(angles) / sizeof(angles[0]); n++) {
+        const Wireframe::Matrix m = Wireframe::rotation(angles[n][0], angles[n][1], angles[n][2]);
+        const double ax = angles[n][0] * 2 * kPi / 65536, ay = angles[n][1] * 2 * kPi / 65536,
+                     az = angles[n][2] * 2 * kPi / 65536;
+        const double expected[3][3] = {
+            { cos(az) * cos(ay), cos(az) * sin(ay) * sin(ax) - sin(az) * cos(ax), cos(az) * sin(ay) * cos(ax) + sin(az) * sin(ax) },
+            { sin(az) * cos(ay), sin(az) * sin(ay) * sin(ax) + cos(az) * cos(ax), sin(az) * sin(ay) * cos(ax) - cos(az) * sin(ax) },
+            { -sin(ay), cos(ay) * sin(ax), cos(ay) * cos(ax) },
+        };
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                TEST_ASSERT_INT32_WITHIN(4, (int32_t)lround(expected[i][j] * 16384), m.m[i][j]);
+            }
+            const int32_t length = m.m[i][0] * m.m[i][0] + m.m[i][1] * m.m[i][1] + m.m[i][2] * m.m[i][2];
+            TEST_ASSERT_INT32_WITHIN(1 << 17, 1 << 28, length);
+        }
+    }
+    const Wireframe::Matrix id = Wireframe::identity();
+    const Wireframe::Matrix r = Wireframe::rotation(1000, 2000, 3000);
+    const Wireframe::Matrix same = Wireframe::multiply(r, id);
+    TEST_ASSERT_EQUAL_MEMORY(&r, &same, sizeof(r));
+}
+
+// Perspective: x * focal / z from the centre, rounded; orthographic: focal per unit
+void test_projection(void) {
+    uint8_t buffer[kHeight * kStride];
+    Wireframe wire;
+    wire.setViewport(kWidth, kHeight);
+
+    // A point one unit right at depth 4 with focal 8 lands 2 px right of (5, 8)
+    wire.setCamera(1024, 8);
+    segment(256, 0, 0, 256, 0, 0);
+    memset(buffer, 0, sizeof(buffer));
+    wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+    TEST_ASSERT_EQUAL_INT(1, count(buffer));
+    TEST_ASSERT_TRUE(lit(buffer, 7, 8));
+
+    // Farther away is closer to the centre: depth 8 gives 1 px
+    segment(256, 256, 1024, 256, 256, 1024);
+    memset(buffer, 0, sizeof(buffer));
+    wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+    TEST_ASSERT_TRUE(lit(buffer, 6, 9));
+
+    // Orthographic, 3 px per unit, y down
+    wire.setCamera(0, 3);
+    segment(-256, 512, 0, -256, 512, 0);
+    memset(buffer, 0, sizeof(buffer));
+    wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+    TEST_ASSERT_EQUAL_INT(1, count(buffer));
+    TEST_ASSERT_TRUE(lit(buffer, 2, 14));
+}
+
+// Both ends of an on-screen edge are drawn, and the line is 8-connected
+void test_line_endpoints(void) {
+    uint8_t buffer[kHeight * kStride];
+    Wireframe wire;
+    wire.setViewport(kWidth, kHeight);
+    wire.setCamera(0, 1);
+
+    const int ends[][4] = { { 0, 0, 9, 15 }, { 9, 0, 0, 15 }, { 0, 7, 9, 7 }, { 4, 15, 4, 0 }, { 1, 2, 8, 5 } };
+    for (size_t n = 0; n < sizeof(ends) / sizeof(ends[0]); n++) {
+        const int* e = ends[n];
+        // Orthographic at 1 px per unit: Q8 vertices 256 per pixel from the centre
+        segment((e[0] - 5) * 256, (e[1] - 8) * 256, 0, (e[2] - 5) * 256, (e[3] - 8) * 256, 0);
+        memset(buffer, 0, sizeof(buffer));
+        wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+        TEST_ASSERT_TRUE(lit(buffer, e[0], e[1]));
+        TEST_ASSERT_TRUE(lit(buffer, e[2], e[3]));
+        const int dx = abs(e[2] - e[0]), dy = abs(e[3] - e[1]);
+        TEST_ASSERT_EQUAL_INT((dx > dy ? dx : dy) + 1, count(buffer));
+    }
+}
+
+// Edges off screen or behind the eye are cut, never written out of bounds
+void test_clipping(void) {
+    uint8_t guarded[kHeight * kStride + 8];
+    uint8_t* buffer = guarded + 4;
+    Wireframe wire;
+    wire.setViewport(kWidth, kHeight);
+    wire.setCamera(768, 12);
+
+    // Entirely off to the side, and entirely behind the eye: nothing drawn
+    segment(2560, 0, 0, 2560, 256, 0);
+    memset(guarded, 0, sizeof(guarded));
+    wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+    segment(0, 0, -1024, 256, 256, -1024);
+    wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+    TEST_ASSERT_EQUAL_INT(0, count(buffer));
+    TEST_ASSERT_EQUAL_UINT32(2, wire.stats().culled);
+
+    // Through the near plane: cut there, still drawn, and only on screen
+    segment(64, 64, 0, 64, 64, -2000);
+    memset(guarded, 0, sizeof(guarded));
+    wire.draw(kSegment, Wireframe::identity(), 256, buffer);
+    TEST_ASSERT_TRUE(count(buffer) > 0);
+    TEST_ASSERT_EQUAL_UINT32(1, wire.stats().edges);
+
+    // Every solid, tumbling and scaled up until it overflows the panel
+    for (int m = 0; m < kMeshCount; m++) {
+        for (int frame = 0; frame < 500; frame++) {
+            memset(guarded, 0, sizeof(guarded));
+            const Wireframe::Matrix r = Wireframe::rotation((uint16_t)(frame * 700), (uint16_t)(frame * 1100), (uint16_t)(frame * 300));
+            wire.draw(kMeshes[m], r, 256 + frame * 4, buffer);
+            for (int i = 0; i < 4; i++) TEST_ASSERT_EQUAL_HEX8(0, guarded[i]);
+            for (int i = 0; i < 4; i++) TEST_ASSERT_EQUAL_HEX8(0, buffer[kHeight * kStride + i]);
+            TEST_ASSERT_TRUE(paddingClear(buffer));
+        }
+    }
+}
+
+// Tables are closed solids: every vertex is ~1.0 out and on the expected number of edges
+void test_meshes(void) {
+    const int degree[] = { 3, 4, 3, 5 };
+    for (int m = 0; m < kMeshCount; m++) {
+        const Mesh& mesh = kMeshes[m];
+        TEST_ASSERT_TRUE(mesh.vertexCount <= Wireframe::kMaxVertices);
+        TEST_ASSERT_EQUAL_INT(mesh.vertexCount * degree[m], mesh.edgeCount * 2);
+        for (int i = 0; i < mesh.vertexCount; i++) {
+            const int16_t* v = mesh.vertices[i];
+            const int32_t r2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+            TEST_ASSERT_INT32_WITHIN(1000, 65536, r2);
+            int edges = 0;
+            for (int e = 0; e < mesh.edgeCount; e++) edges += (mesh.edges[e][0] == i) + (mesh.edges[e][1] == i);
+            TEST_ASSERT_EQUAL_INT(degree[m], edges);
+        }
+    }
+}
+
+// Throughput of a full frame (matrix, transform, project, clip, raster)
+void test_benchmark(void) {
+    uint8_t buffer[kHeight * kStride];
+    const int frames = 100000;
+    for (int m = 0; m < kMeshCount; m++) {
+        Wireframe wire;
+        wire.setViewport(kWidth, kHeight);
+        wire.setCamera(768, 12);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            memset(buffer, 0, sizeof(buffer));
+            const Wireframe::Matrix r = Wireframe::rotation((uint16_t)(frame * 700), (uint16_t)(frame * 1100), (uint16_t)(frame * 300));
+            wire.draw(kMeshes[m], r, 256, buffer);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        char msg[160];
+        snprintf(msg, sizeof(msg), "%-12s %5.0f ns per frame, %6.0f vertices/ms, %6.0f edges/ms, %u culled",
+                 kMeshes[m].name, ms * 1e6 / frames, wire.stats().vertices / ms, wire.stats().edges / ms,
+                 (unsigned)wire.stats().culled);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)kMeshes[m].vertexCount * frames, wire.stats().vertices);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rotation_matrix);
+    RUN_TEST(test_projection);
+    RUN_TEST(test_line_endpoints);
+    RUN_TEST(test_clipping);
+    RUN_TEST(test_meshes);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
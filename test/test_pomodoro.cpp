@@ -42,8 +42,9 @@ void test_pomodoro_fast_forward(void) {
              ModePomodoro::onTimerTick(pomodoro);
         }
 
-        // 2. Run logic to draw to canvas
+        // 2. Run logic to draw to canvas, then hand the frame to the panel
         pomodoro->loop();
+        displayPresentCanvas();
 
         bool canvasHasData = false;
         for(int i=0; i < (MATRIX_WIDTH * MATRIX_HEIGHT); i++) {
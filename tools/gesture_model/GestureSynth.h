@@ -0,0 +1,250 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include "engine/GestureNet.h"
+
+/**
+ * @brief Synthetic training and test data for the gesture network: 500 Hz
+ * streams of linear acceleration (MPU6050 LSB, 16384 = 1 g) and gyro
+ * (131 LSB per deg/s) for each class, plus the look-alikes it must reject
+ * (single taps, bumps, shakes, slow moves and tilts). Host only; shared by
+ * train.cpp and the native test harness.
+ */
+namespace gesturesynth {
+
+static constexpr int kSampleHz = 500;
+static constexpr double kG = 16384.0;
+static constexpr double kDps = 131.0;
+static constexpr double kPi = 3.14159265358979;
+
+struct Sample {
+    int16_t linear[3];
+    int16_t gyro[3];
+};
+
+class Rng {
+public:
+    explicit Rng(uint32_t seed) : m_state(seed ? seed : 1) {}
+    uint32_t next() {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state;
+    }
+    double uniform(double lo, double hi) { return lo + (hi - lo) * (next() >> 8) / 16777216.0; }
+    int below(int n) { return (int)(next() % (uint32_t)n); }
+    double gauss() {
+        const double u = uniform(1e-9, 1.0);
+        const double v = uniform(0.0, 1.0);
+        return sqrt(-2.0 * log(u)) * cos(2 * kPi * v);
+    }
+
+private:
+    uint32_t m_state;
+};
+
+inline double sign(Rng& rng) { return rng.below(2) ? 1.0 : -1.0; }
+
+// A stream under construction, in physical units (g, deg/s)
+struct Stream {
+    std::vector<double> a[3], w[3];
+
+    explicit Stream(int n) {
+        for (int k = 0; k < 3; k++) {
+            a[k].assign(n, 0.0);
+            w[k].assign(n, 0.0);
+        }
+    }
+    int size() const { return (int)a[0].size(); }
+
+    // Hand-held background: sensor noise plus a slow wobble
+    void background(Rng& rng, double wobble) {
+        const double fa = rng.uniform(0.3, 1.5);
+        const double fw = rng.uniform(0.3, 1.5);
+        double pa[3], pw[3];
+        for (int k = 0; k < 3; k++) {
+            pa[k] = rng.uniform(0, 2 * kPi);
+            pw[k] = rng.uniform(0, 2 * kPi);
+        }
+        for (int i = 0; i < size(); i++) {
+            const double t = (double)i / kSampleHz;
+            for (int k = 0; k < 3; k++) {
+                a[k][i] += 0.004 * rng.gauss() + wobble * 0.03 * sin(2 * kPi * fa * t + pa[k]);
+                w[k][i] += 0.3 * rng.gauss() + wobble * 4.0 * sin(2 * kPi * fw * t + pw[k]);
+            }
+        }
+    }
+
+    void add(int axis, int i, double g) { if (i >= 0 && i < size()) a[axis][i] += g; }
+    void addGyro(int axis, int i, double dps) { if (i >= 0 && i < size()) w[axis][i] += dps; }
+
+    // Half-sine acceleration pulse
+    void pulse(int axis, int start, int len, double g) {
+        for (int i = 0; i < len; i++) add(axis, start + i, g * sin(kPi * (i + 0.5) / len));
+    }
+
+    std::vector<Sample> samples() const {
+        std::vector<Sample> out(size());
+        for (int i = 0; i < size(); i++) {
+            for (int k = 0; k < 3; k++) {
+                out[i].linear[k] = clamp(a[k][i] * kG);
+                out[i].gyro[k] = clamp(w[k][i] * kDps);
+            }
+        }
+        return out;
+    }
+
+    static int16_t clamp(double v) { return (int16_t)(v > 32767 ? 32767 : (v < -32768 ? -32768 : lrint(v))); }
+};
+
+// Gesture shapes. Each returns its length in samples when placed at `start`.
+inline int flick(Stream& s, Rng& rng, int start, bool right) {
+    const int len = (int)(rng.uniform(0.08, 0.16) * kSampleHz);
+    const double g = rng.uniform(0.8, 2.0) * (right ? 1 : -1);
+    const double cross = rng.uniform(-0.2, 0.2);
+    const double lift = rng.uniform(-0.2, 0.2);
+    const double twist = rng.uniform(30, 120) * (right ? -1 : 1);
+    for (int i = 0; i < len; i++) {
+        const double v = g * sin(2 * kPi * (i + 0.5) / len);  // Out and stop
+        s.add(0, start + i, v);
+        s.add(1, start + i, cross * v);
+        s.add(2, start + i, lift * v);
+        s.addGyro(2, start + i, twist * sin(kPi * (i + 0.5) / len));
+    }
+    return len;
+}
+
+// Knock on the panel face: pushes the board along -Z, then rings
+inline int tap(Stream& s, Rng& rng, int start) {
+    const int len = (int)(rng.uniform(0.010, 0.020) * kSampleHz);
+    const double g = -rng.uniform(1.5, 3.0);
+    const int crossAxis = rng.below(2);
+    const double cross = rng.uniform(-0.3, 0.3);
+    s.pulse(2, start, len, g);
+    s.pulse(2, start + len, len, -0.4 * g);  // Ringing
+    s.pulse(crossAxis, start, len, cross * g);
+    return 2 * len;
+}
+
+inline int doubleTap(Stream& s, Rng& rng, int start) {
+    tap(s, rng, start);
+    const int gap = (int)(rng.uniform(0.12, 0.32) * kSampleHz);
+    return gap + tap(s, rng, start + gap);
+}
+
+inline int circle(Stream& s, Rng& rng, int start) {
+    const int len = (int)(rng.uniform(0.5, 0.8) * kSampleHz);
+    const double g = rng.uniform(0.3, 0.8);
+    const double dir = sign(rng), phase = rng.uniform(0, 2 * kPi);
+    for (int i = 0; i < len; i++) {
+        const double t = (double)i / len;
+        const double env = t < 0.1 ? t / 0.1 : (t > 0.9 ? (1 - t) / 0.1 : 1.0);
+        const double th = 2 * kPi * t + phase;
+        s.add(0, start + i, -g * env * cos(th));
+        s.add(1, start + i, -g * env * dir * sin(th));
+        s.addGyro(2, start + i, rng.uniform(-3, 3));
+    }
+    return len;
+}
+
+// Look-alikes that must stay Idle; returns the length used
+inline int distractor(Stream& s, Rng& rng, int start) {
+    switch (rng.below(6)) {
+        case 0: return tap(s, rng, start);  // Single knock
+        case 1: {  // Bump: one broad pulse on any axis
+            const int len = (int)(rng.uniform(0.03, 0.08) * kSampleHz);
+            const int axis = rng.below(3);
+            const double g = rng.uniform(0.5, 2.0) * sign(rng);
+            s.pulse(axis, start, len, g);
+            return len;
+        }
+        case 2: {  // Shake: several fast cycles
+            const int len = (int)(rng.uniform(0.6, 0.9) * kSampleHz);
+            const double f = rng.uniform(4, 7);
+            const double g = rng.uniform(0.4, 1.0);
+            const int axis = rng.below(2);
+            for (int i = 0; i < len; i++) s.add(axis, start + i, g * sin(2 * kPi * f * i / kSampleHz));
+            return len;
+        }
+        case 3: {  // Slow move
+            const int len = (int)(rng.uniform(0.3, 0.6) * kSampleHz);
+            const int axis = rng.below(3);
+            const double g = rng.uniform(0.1, 0.3) * sign(rng);
+            for (int i = 0; i < len; i++) s.add(axis, start + i, g * sin(2 * kPi * (i + 0.5) / len));
+            return len;
+        }
+        case 4: {  // Slow tilt: rotation only
+            const int len = (int)(rng.uniform(0.3, 0.6) * kSampleHz);
+            const int axis = rng.below(3);
+            const double dps = rng.uniform(20, 80) * sign(rng);
+            for (int i = 0; i < len; i++) s.addGyro(axis, start + i, dps * sin(kPi * (i + 0.5) / len));
+            return len;
+        }
+        default:
+            return 0;  // Nothing but background
+    }
+}
+
+inline int gesture(Stream& s, Rng& rng, gesturenet::NetClass label, int start) {
+    switch (label) {
+        case gesturenet::NetClass::FlickLeft:  return flick(s, rng, start, false);
+        case gesturenet::NetClass::FlickRight: return flick(s, rng, start, true);
+        case gesturenet::NetClass::DoubleTap:  return doubleTap(s, rng, start);
+        case gesturenet::NetClass::Circle:     return circle(s, rng, start);
+        default:                               return distractor(s, rng, start);
+    }
+}
+
+// Length of a gesture without drawing it (same random draws, scratch stream)
+inline int measure(Rng rng, gesturenet::NetClass label) {
+    Stream scratch(1);
+    return gesture(scratch, rng, label, -100000);
+}
+
+// Runs samples through the device front end; returns the final window
+inline void window(const std::vector<Sample>& samples, const gesturenet::ModelHeader& h, int8_t* out) {
+    gesturenet::Window w;
+    w.configure(h, kSampleHz);
+    for (size_t i = 0; i < samples.size(); i++) w.add(samples[i].linear, samples[i].gyro);
+    w.copy(out);
+}
+
+struct Example {
+    int8_t input[gesturenet::kMaxInputs];
+    uint8_t label;
+};
+
+// One labelled window. Positives lie wholly inside it; some cut-off
+// positives (under 60% visible) are labelled Idle so early windows stay quiet.
+inline Example example(Rng& rng, const gesturenet::ModelHeader& h) {
+    const int n = h.frames * (kSampleHz / h.frameHz);
+    Example ex;
+    int label = rng.below(2) ? 1 + rng.below(gesturenet::kClasses - 1) : 0;
+    Stream s(n);
+    s.background(rng, rng.uniform(0, 1));
+    Rng shape(rng.next());  // Drawn twice: once to measure, once to place
+    gesturenet::NetClass cls = static_cast<gesturenet::NetClass>(label);
+    const int len = measure(shape, cls);
+    if (label == 0) {
+        gesture(s, shape, cls, rng.below(n > len ? n - len : 1));
+    } else if (rng.below(8) == 0) {
+        gesture(s, shape, cls, n - (int)(len * rng.uniform(0.25, 0.6)));
+        label = 0;
+    } else {
+        gesture(s, shape, cls, rng.below(n - len - 5) + 1);
+    }
+    window(s.samples(), h, ex.input);
+    ex.label = (uint8_t)label;
+    return ex;
+}
+
+inline std::vector<Example> dataset(uint32_t seed, int count, const gesturenet::ModelHeader& h) {
+    Rng rng(seed);
+    std::vector<Example> out;
+    out.reserve(count);
+    for (int i = 0; i < count; i++) out.push_back(example(rng, h));
+    return out;
+}
+
+}  // namespace gesturesynth
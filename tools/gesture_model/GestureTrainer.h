@@ -0,0 +1,249 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include "engine/GestureNet.h"
+#include "GestureSynth.h"
+
+/**
+ * @brief Float MLP for the gesture network: training (softmax cross-entropy,
+ * Adam, deterministic), the float reference forward pass, and conversion to
+ * the int8 blob the device runs (per-row weight scales, activation scales
+ * calibrated on the training set). Host only.
+ */
+namespace gesturetrainer {
+
+// Window and input scaling shared by the trainer, harness and firmware
+inline gesturenet::ModelHeader defaultHeader() {
+    gesturenet::ModelHeader h = {};
+    h.magic = gesturenet::kMagic;
+    h.version = gesturenet::kVersion;
+    h.classes = gesturenet::kClasses;
+    h.frames = 48;       // 960 ms
+    h.channels = gesturenet::kChannels;
+    h.frameHz = 50;
+    h.inputShift = 8;    // 64 LSB per g, ~0.5 LSB per deg/s
+    return h;
+}
+
+static constexpr float kInputScale = 1.0f / 64;  // Float input = int8 input * kInputScale
+
+struct DenseF {
+    int inputs, outputs;
+    bool relu;
+    std::vector<float> w, b;        // w[r * inputs + i]
+    std::vector<float> mw, vw, mb, vb;
+};
+
+class Mlp {
+public:
+    Mlp(const std::vector<int>& widths, uint32_t seed) {
+        gesturesynth::Rng rng(seed);
+        for (size_t l = 0; l + 1 < widths.size(); l++) {
+            DenseF d;
+            d.inputs = widths[l];
+            d.outputs = widths[l + 1];
+            d.relu = l + 2 < widths.size();
+            d.w.resize(d.inputs * d.outputs);
+            const float stdev = sqrtf(2.0f / d.inputs);
+            for (size_t k = 0; k < d.w.size(); k++) d.w[k] = (float)(stdev * rng.gauss());
+            d.b.assign(d.outputs, 0.0f);
+            d.mw.assign(d.w.size(), 0.0f);
+            d.vw.assign(d.w.size(), 0.0f);
+            d.mb.assign(d.outputs, 0.0f);
+            d.vb.assign(d.outputs, 0.0f);
+            layers.push_back(d);
+        }
+    }
+
+    // Activations of every layer (acts[0] = input)
+    void forward(const int8_t* input, std::vector<std::vector<float> >& acts) const {
+        acts.resize(layers.size() + 1);
+        acts[0].resize(layers[0].inputs);
+        for (int i = 0; i < layers[0].inputs; i++) acts[0][i] = input[i] * kInputScale;
+        for (size_t l = 0; l < layers.size(); l++) {
+            const DenseF& d = layers[l];
+            acts[l + 1].resize(d.outputs);
+            for (int r = 0; r < d.outputs; r++) {
+                float acc = d.b[r];
+                const float* w = &d.w[r * d.inputs];
+                for (int i = 0; i < d.inputs; i++) acc += w[i] * acts[l][i];
+                acts[l + 1][r] = d.relu && acc < 0 ? 0 : acc;
+            }
+        }
+    }
+
+    int predict(const int8_t* input) const {
+        std::vector<std::vector<float> > acts;
+        forward(input, acts);
+        const std::vector<float>& out = acts.back();
+        int best = 0;
+        for (size_t c = 1; c < out.size(); c++) if (out[c] > out[best]) best = (int)c;
+        return best;
+    }
+
+    void train(const std::vector<gesturesynth::Example>& data, int epochs, uint32_t seed) {
+        gesturesynth::Rng rng(seed);
+        std::vector<int> order(data.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = (int)i;
+        const int batch = 32;
+        std::vector<std::vector<float> > gw(layers.size()), gb(layers.size()), acts, delta(layers.size() + 1);
+        int step = 0;
+        for (int e = 0; e < epochs; e++) {
+            for (size_t i = order.size() - 1; i > 0; i--) {
+                const int j = rng.below((int)i + 1);
+                const int t = order[i]; order[i] = order[j]; order[j] = t;
+            }
+            const float lr = 0.002f * (e < epochs * 2 / 3 ? 1.0f : 0.3f);
+            for (size_t start = 0; start < order.size(); start += batch) {
+                for (size_t l = 0; l < layers.size(); l++) {
+                    gw[l].assign(layers[l].w.size(), 0.0f);
+                    gb[l].assign(layers[l].outputs, 0.0f);
+                }
+                const size_t end = start + batch < order.size() ? start + batch : order.size();
+                for (size_t k = start; k < end; k++) {
+                    const gesturesynth::Example& ex = data[order[k]];
+                    forward(ex.input, acts);
+                    backward(acts, ex.label, gw, gb, delta);
+                }
+                adam(gw, gb, lr, ++step);
+            }
+        }
+    }
+
+    std::vector<DenseF> layers;
+
+private:
+    void backward(const std::vector<std::vector<float> >& acts, int label,
+                  std::vector<std::vector<float> >& gw, std::vector<std::vector<float> >& gb,
+                  std::vector<std::vector<float> >& delta) const {
+        // Softmax cross-entropy gradient
+        const std::vector<float>& logits = acts.back();
+        float mx = logits[0], sum = 0;
+        for (size_t c = 1; c < logits.size(); c++) mx = logits[c] > mx ? logits[c] : mx;
+        std::vector<float>& top = delta[layers.size()];
+        top.resize(logits.size());
+        for (size_t c = 0; c < logits.size(); c++) sum += (top[c] = expf(logits[c] - mx));
+        for (size_t c = 0; c < logits.size(); c++) top[c] = top[c] / sum - (c == (size_t)label ? 1.0f : 0.0f);
+
+        for (int l = (int)layers.size() - 1; l >= 0; l--) {
+            const DenseF& d = layers[l];
+            std::vector<float>& dOut = delta[l + 1];
+            std::vector<float>& dIn = delta[l];
+            dIn.assign(d.inputs, 0.0f);
+            for (int r = 0; r < d.outputs; r++) {
+                if (d.relu && acts[l + 1][r] <= 0) continue;
+                const float g = dOut[r];
+                gb[l][r] += g;
+                const float* w = &d.w[r * d.inputs];
+                float* dw = &gw[l][r * d.inputs];
+                for (int i = 0; i < d.inputs; i++) {
+                    dw[i] += g * acts[l][i];
+                    dIn[i] += g * w[i];
+                }
+            }
+        }
+    }
+
+    void adam(const std::vector<std::vector<float> >& gw, const std::vector<std::vector<float> >& gb, float lr, int step) {
+        const float b1 = 0.9f, b2 = 0.999f;
+        const float c1 = 1.0f - powf(b1, (float)step), c2 = 1.0f - powf(b2, (float)step);
+        for (size_t l = 0; l < layers.size(); l++) {
+            DenseF& d = layers[l];
+            update(d.w, d.mw, d.vw, gw[l], lr, b1, b2, c1, c2);
+            update(d.b, d.mb, d.vb, gb[l], lr, b1, b2, c1, c2);
+        }
+    }
+
+    static void update(std::vector<float>& p, std::vector<float>& m, std::vector<float>& v, const std::vector<float>& g,
+                       float lr, float b1, float b2, float c1, float c2) {
+        for (size_t k = 0; k < p.size(); k++) {
+            m[k] = b1 * m[k] + (1 - b1) * g[k];
+            v[k] = b2 * v[k] + (1 - b2) * g[k] * g[k];
+            p[k] -= lr * (m[k] / c1) / (sqrtf(v[k] / c2) + 1e-7f);
+        }
+    }
+};
+
+// Splits a positive real multiplier into Q31 mantissa and right shift
+inline void quantizeMultiplier(double m, int32_t& mult, int8_t& shift) {
+    int e;
+    const double f = frexp(m, &e);  // m = f * 2^e, f in [0.5, 1)
+    int64_t q = llround(f * 2147483648.0);
+    if (q == 2147483648LL) {
+        q /= 2;
+        e++;
+    }
+    mult = (int32_t)q;
+    shift = (int8_t)(-e);
+}
+
+inline void put(std::vector<uint8_t>& blob, const void* data, size_t n) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    blob.insert(blob.end(), p, p + n);
+}
+
+inline void pad4(std::vector<uint8_t>& blob) {
+    while (blob.size() & 3) blob.push_back(0);
+}
+
+// Quantizes `net` into a device blob. Activation scales come from the
+// largest value each layer produces over `calib`.
+inline std::vector<uint8_t> quantize(const Mlp& net, const gesturenet::ModelHeader& base,
+                                     const std::vector<gesturesynth::Example>& calib) {
+    std::vector<float> peak(net.layers.size(), 1e-6f);
+    std::vector<std::vector<float> > acts;
+    for (size_t k = 0; k < calib.size(); k++) {
+        net.forward(calib[k].input, acts);
+        for (size_t l = 0; l < net.layers.size(); l++) {
+            for (size_t r = 0; r < acts[l + 1].size(); r++) {
+                const float v = fabsf(acts[l + 1][r]);
+                if (v > peak[l]) peak[l] = v;
+            }
+        }
+    }
+
+    gesturenet::ModelHeader h = base;
+    h.layers = (uint8_t)net.layers.size();
+    h.outScaleQ16 = (uint32_t)lrint(peak.back() / 127.0 * 65536.0);
+    std::vector<uint8_t> blob;
+    put(blob, &h, sizeof(h));
+
+    double inScale = kInputScale;
+    for (size_t l = 0; l < net.layers.size(); l++) {
+        const DenseF& d = net.layers[l];
+        const double outScale = peak[l] / 127.0;
+        gesturenet::LayerHeader lh = {};
+        lh.type = gesturenet::LayerDense;
+        lh.flags = d.relu ? gesturenet::LayerRelu : 0;
+        lh.inputs = (uint16_t)d.inputs;
+        lh.outputs = (uint16_t)d.outputs;
+        put(blob, &lh, sizeof(lh));
+
+        std::vector<double> rowScale(d.outputs);
+        for (int r = 0; r < d.outputs; r++) {
+            float mx = 1e-9f;
+            for (int i = 0; i < d.inputs; i++) mx = fabsf(d.w[r * d.inputs + i]) > mx ? fabsf(d.w[r * d.inputs + i]) : mx;
+            rowScale[r] = mx / 127.0;
+            for (int i = 0; i < d.inputs; i++) blob.push_back((uint8_t)(int8_t)lrint(d.w[r * d.inputs + i] / rowScale[r]));
+        }
+        pad4(blob);
+        for (int r = 0; r < d.outputs; r++) {
+            const int32_t b = (int32_t)lrint(d.b[r] / (rowScale[r] * inScale));
+            put(blob, &b, 4);
+        }
+        std::vector<int8_t> shifts(d.outputs);
+        for (int r = 0; r < d.outputs; r++) {
+            int32_t mult;
+            quantizeMultiplier(rowScale[r] * inScale / outScale, mult, shifts[r]);
+            put(blob, &mult, 4);
+        }
+        put(blob, shifts.data(), shifts.size());
+        pad4(blob);
+        inScale = outScale;
+    }
+    return blob;
+}
+
+}  // namespace gesturetrainer
@@ -0,0 +1,72 @@
+// Trains the gesture network on synthetic data and writes the int8 model
+// blob the firmware compiles in (src/engine/GestureModelData.h).
+//
+//   g++ -std=gnu++11 -O2 -Isrc tools/gesture_model/train.cpp -o /tmp/train_gesture_model
+//   /tmp/train_gesture_model > src/engine/GestureModelData.h
+//
+// Deterministic: the same build gives the same blob. Accuracy of the float
+// network and of the int8 blob (through the device kernels) goes to stderr.
+
+#include <stdio.h>
+#include "engine/GestureNet.h"
+#include "GestureSynth.h"
+#include "GestureTrainer.h"
+
+static const char* const kClassNames[gesturenet::kClasses] = { "idle", "flick left", "flick right", "double tap", "circle" };
+
+int main() {
+    const gesturenet::ModelHeader base = gesturetrainer::defaultHeader();
+    const int inputs = base.frames * base.channels;
+    const std::vector<gesturesynth::Example> train = gesturesynth::dataset(1, 12000, base);
+    // Held-out windows: the same set test_gesture_net scores, so the figure
+    // written into the header is the one the test reports
+    const int kTestSeed = 7, kTestWindows = 2000;
+    const std::vector<gesturesynth::Example> test = gesturesynth::dataset(kTestSeed, kTestWindows, base);
+
+    std::vector<int> widths;
+    widths.push_back(inputs);
+    widths.push_back(24);
+    widths.push_back(16);
+    widths.push_back(gesturenet::kClasses);
+    gesturetrainer::Mlp net(widths, 3);
+    net.train(train, 30, 4);
+    const std::vector<uint8_t> blob = gesturetrainer::quantize(net, base, train);
+
+    // Score both on held-out windows
+    static gesturenet::Model model;
+    std::vector<uint8_t> aligned(blob);
+    if (!model.load(aligned.data(), aligned.size())) {
+        fprintf(stderr, "blob failed to load\n");
+        return 1;
+    }
+    int floatOk = 0, intOk = 0, agree = 0;
+    int perClass[gesturenet::kClasses] = {}, perClassOk[gesturenet::kClasses] = {};
+    for (size_t k = 0; k < test.size(); k++) {
+        gesturenet::Result r;
+        model.classify(test[k].input, r);
+        const int f = net.predict(test[k].input);
+        floatOk += f == test[k].label;
+        intOk += (int)r.label == test[k].label;
+        agree += (int)r.label == f;
+        perClass[test[k].label]++;
+        perClassOk[test[k].label] += (int)r.label == test[k].label;
+    }
+    fprintf(stderr, "float %.1f%%  int8 %.1f%%  agreement %.1f%%  %u MACs  %u bytes\n",
+            100.0 * floatOk / test.size(), 100.0 * intOk / test.size(), 100.0 * agree / test.size(),
+            (unsigned)model.macs(), (unsigned)blob.size());
+    for (int c = 0; c < gesturenet::kClasses; c++) {
+        fprintf(stderr, "  %-12s %.1f%%\n", kClassNames[c], 100.0 * perClassOk[c] / (perClass[c] ? perClass[c] : 1));
+    }
+
+    printf("#pragma once\n#include <stdint.h>\n\n");
+    printf("// Generated by tools/gesture_model/train.cpp; do not edit.\n");
+    printf("// %d x %d frames at %d Hz -> %d-%d-%d-%d MLP, int8. Held-out synthetic accuracy %.1f%%\n",
+           base.frames, base.channels, base.frameHz, inputs, widths[1], widths[2], widths[3],
+           100.0 * intOk / test.size());
+    printf("// (%d windows, seed %d, as test_gesture_net reports it).\n", kTestWindows, kTestSeed);
+    printf("// Classes: idle, flick left, flick right, double tap, circle (gesturenet::NetClass).\n");
+    printf("alignas(4) static const uint8_t kGestureModel[%u] = {", (unsigned)blob.size());
+    for (size_t i = 0; i < blob.size(); i++) printf("%s0x%02x,", i % 16 == 0 ? "\n    " : " ", blob[i]);
+    printf("\n};\n");
+    return 0;
+}